@@ -0,0 +1,28 @@
+# PlatformIO pre script: compresses the dashboard in web/ into data/www/ for the
+# LittleFS image (pio run -t buildfs / uploadfs), the node serves the .gz files as they are.
+import gzip
+import os
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+source = os.path.join(project, "web")
+target = os.path.join(project, "data", "www")
+
+
+def compress_web():
+    os.makedirs(target, exist_ok=True)
+    for name in sorted(os.listdir(source)):
+        path = os.path.join(source, name)
+        packed = os.path.join(target, name + ".gz")
+        if os.path.exists(packed) and os.path.getmtime(packed) >= os.path.getmtime(path):
+            continue
+        with open(path, "rb") as original:
+            data = original.read()
+        # mtime 0 keeps the output, and the ETag the node derives from it, reproducible
+        with open(packed, "wb") as output:
+            output.write(gzip.compress(data, compresslevel=9, mtime=0))
+        print(f"gzip_web: {name} {len(data)} -> {os.path.getsize(packed)} bytes")
+
+
+compress_web()
@@ -0,0 +1,18 @@
+#include "Backoff.h"
+
+uint32_t Backoff::next(uint32_t random)
+{
+  uint32_t ceiling = base;
+  for (uint8_t i = 0; i < failures && ceiling < cap; i++)
+  {
+    ceiling *= 2;
+  }
+  ceiling = ceiling < cap ? ceiling : cap;
+  if (failures < UINT8_MAX)
+  {
+    failures++;
+  }
+
+  uint32_t half = ceiling / 2;
+  return half + random % (ceiling - half + 1);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+// Exponential backoff with equal jitter: the ceiling doubles with every failed
+// attempt up to cap, the delay is picked between half the ceiling and the
+// ceiling, so nodes that lost the broker together don't come back in lockstep.
+// The random number is passed in to keep it reproducible on the host.
+class Backoff
+{
+public:
+  Backoff(uint32_t base, uint32_t cap) : base(base), cap(cap) {}
+
+  // delay before the next attempt, every call counts as another failure
+  uint32_t next(uint32_t random);
+  void reset() { failures = 0; }
+  uint8_t attempts() const { return failures; }
+
+private:
+  uint32_t base;
+  uint32_t cap;
+  uint8_t failures = 0;
+};
@@ -0,0 +1,80 @@
+#include "Button.h"
+
+ButtonGesture DebouncedButton::update(bool pressed, uint32_t now)
+{
+  switch (state)
+  {
+  case State::released:
+    if (pressed)
+    {
+      state = State::pressing;
+      since = now;
+    }
+    break;
+
+  case State::pressing:
+    if (!pressed)
+    {
+      state = State::released;
+    }
+    else if (now - since >= debounceTime)
+    {
+      state = State::down;
+      pressedAt = since;
+      longReported = false;
+    }
+    break;
+
+  case State::down:
+    if (!pressed)
+    {
+      state = State::releasing;
+      since = now;
+    }
+    else if (!longReported && now - pressedAt >= longPressTime)
+    {
+      longReported = true;
+      return ButtonGesture::longPress;
+    }
+    break;
+
+  case State::releasing:
+    if (pressed)
+    {
+      // bounced, the press goes on
+      state = State::down;
+    }
+    else if (now - since >= debounceTime)
+    {
+      state = State::released;
+      if (!longReported)
+      {
+        return ButtonGesture::shortPress;
+      }
+    }
+    break;
+  }
+  return ButtonGesture::none;
+}
+
+uint32_t DebouncedButton::nextCheck(uint32_t now) const
+{
+  uint32_t due;
+  switch (state)
+  {
+  case State::pressing:
+  case State::releasing:
+    due = since + debounceTime;
+    break;
+  case State::down:
+    if (longReported)
+    {
+      return UINT32_MAX;
+    }
+    due = pressedAt + longPressTime;
+    break;
+  default:
+    return UINT32_MAX;
+  }
+  return (int32_t)(due - now) > 0 ? due - now : 0;
+}
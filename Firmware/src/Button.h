@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+enum class ButtonGesture : uint8_t
+{
+  none,
+  shortPress,
+  longPress,
+};
+
+// Debounce and gesture detection for one push button. Feed it the pressed state
+// on every edge interrupt and whenever nextCheck() asks for it, time is passed in.
+// A long press is reported as soon as the button was held long enough,
+// a short press when it is released before that.
+class DebouncedButton
+{
+public:
+  const static uint32_t debounceTime = 30;
+  const static uint32_t longPressTime = 2000;
+
+  ButtonGesture update(bool pressed, uint32_t now);
+  // ms until update() has to run again without an edge, UINT32_MAX while idle
+  uint32_t nextCheck(uint32_t now) const;
+
+private:
+  enum class State : uint8_t
+  {
+    released,
+    pressing,
+    down,
+    releasing,
+  };
+
+  State state = State::released;
+  // when the level last changed and when the press started
+  uint32_t since = 0;
+  uint32_t pressedAt = 0;
+  bool longReported = false;
+};
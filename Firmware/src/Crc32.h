@@ -0,0 +1,7 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// standard CRC-32 (zlib, gzip), pass the previous result to continue a running checksum
+uint32_t crc32(const void *data, size_t length, uint32_t crc = 0);
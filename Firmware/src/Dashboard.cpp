@@ -0,0 +1,169 @@
+#include "Dashboard.h"
+
+#include <ESPAsyncWebServer.h>
+#include <memory>
+
+#include "Crc32.h"
+
+const static char *webRoot = "/www";
+
+static const char *contentType(const char *name)
+{
+  const char *extension = strrchr(name, '.');
+  extension = extension ? extension : "";
+  if (strcmp(extension, ".html") == 0)
+  {
+    return "text/html";
+  }
+  if (strcmp(extension, ".js") == 0)
+  {
+    return "application/javascript";
+  }
+  if (strcmp(extension, ".css") == 0)
+  {
+    return "text/css";
+  }
+  if (strcmp(extension, ".svg") == 0)
+  {
+    return "image/svg+xml";
+  }
+  if (strcmp(extension, ".json") == 0)
+  {
+    return "application/json";
+  }
+  return "application/octet-stream";
+}
+
+void Dashboard::begin(AsyncWebServer &server)
+{
+  feedMutex = xSemaphoreCreateMutex();
+  File root = fs.open(webRoot);
+  for (File file = root.openNextFile(); file && assetCount < maxAssets; file = root.openNextFile())
+  {
+    // older cores report the full path, newer ones only the name
+    const char *name = strrchr(file.name(), '/');
+    name = name ? name + 1 : file.name();
+    file.close();
+    addAsset(server, name);
+  }
+  if (assetCount == 0)
+  {
+    Serial.println("no dashboard on the file system, upload it with pio run -t uploadfs");
+  }
+
+  server.on("/events", HTTP_GET, [this](AsyncWebServerRequest *request) { subscribe(request); });
+}
+
+// name is the compressed file, e.g. index.html.gz served as /index.html and /
+void Dashboard::addAsset(AsyncWebServer &server, const char *name)
+{
+  size_t length = strlen(name);
+  if (length < 4 || strcmp(name + length - 3, ".gz") != 0 || length + strlen(webRoot) + 1 >= sizeof(Asset::path))
+  {
+    return;
+  }
+
+  Asset &asset = assets[assetCount];
+  snprintf(asset.path, sizeof(asset.path), "%s/%s", webRoot, name);
+  File file = fs.open(asset.path, "r");
+  if (!file)
+  {
+    return;
+  }
+  uint8_t buffer[256];
+  uint32_t crc = 0;
+  size_t read;
+  while ((read = file.read(buffer, sizeof(buffer))) > 0)
+  {
+    crc = crc32(buffer, read, crc);
+  }
+  file.close();
+  snprintf(asset.etag, sizeof(asset.etag), "\"%08x\"", crc);
+
+  String url = String("/") + String(name).substring(0, length - 3);
+  asset.type = contentType(url.c_str());
+  uint8_t index = assetCount++;
+  server.on(url.c_str(), HTTP_GET, [this, index](AsyncWebServerRequest *request) { serve(request, assets[index]); });
+  if (url == "/index.html")
+  {
+    server.on("/", HTTP_GET, [this, index](AsyncWebServerRequest *request) { serve(request, assets[index]); });
+  }
+}
+
+void Dashboard::serve(AsyncWebServerRequest *request, const Asset &asset)
+{
+  // the browser keeps the file and asks every time, an unchanged one is answered without a body
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == asset.etag)
+  {
+    counters.notModified++;
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", asset.etag);
+    request->send(response);
+    return;
+  }
+
+  counters.files++;
+  AsyncWebServerResponse *response = request->beginResponse(fs, asset.path, asset.type);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+void Dashboard::subscribe(AsyncWebServerRequest *request)
+{
+  // the browser is told to come back later and the connection is closed right away
+  if (activeFeeds.fetch_add(1) >= maxClients)
+  {
+    activeFeeds--;
+    counters.refusedClients++;
+    request->send(200, "text/event-stream", "retry: " + String(reconnectDelay) + "\n\n");
+    return;
+  }
+  struct Subscription
+  {
+    LiveFeed::Cursor cursor;
+    std::atomic<uint8_t> &active;
+    ~Subscription() { active--; }
+  };
+  std::shared_ptr<Subscription> subscription(new Subscription{{}, activeFeeds});
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse(
+      "text/event-stream",
+      [this, subscription](uint8_t *buffer, size_t maxLength, size_t index) -> size_t {
+        // like the history downloads, the AsyncTCP task asks again instead of waiting
+        if (xSemaphoreTake(feedMutex, 0) != pdTRUE)
+        {
+          return RESPONSE_TRY_AGAIN;
+        }
+        size_t length = feed.next(subscription->cursor, (char *)buffer, maxLength);
+        xSemaphoreGive(feedMutex);
+        // 0 would end the response, the feed stays open until the browser leaves
+        return length > 0 ? length : RESPONSE_TRY_AGAIN;
+      });
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+void Dashboard::publish(const Sample &sample)
+{
+  if (!feedMutex)
+  {
+    return;
+  }
+  xSemaphoreTake(feedMutex, portMAX_DELAY);
+  feed.publish(sample);
+  xSemaphoreGive(feedMutex);
+}
+
+LiveFeed::Stats Dashboard::feedStats()
+{
+  if (!feedMutex)
+  {
+    return {};
+  }
+  xSemaphoreTake(feedMutex, portMAX_DELAY);
+  LiveFeed::Stats stats = feed.stats();
+  xSemaphoreGive(feedMutex);
+  return stats;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "LiveFeed.h"
+#include "Sample.h"
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+
+// Serves the dashboard from /www on the file system and pushes every sample to
+// the browsers as Server-Sent Events on /events.
+// The files are gzipped at build time (gzip_web.py) and sent as they are. Their
+// ETag is the crc32 of the compressed file, computed once at boot, so a reload
+// only costs a 304. Browsers beyond maxClients are turned away and retry later,
+// a slow one only loses messages, the sender never waits for it.
+// publish() only leaves the sample in the LiveFeed. Every browser's feed
+// is a chunked response that takes it from there when AsyncTCP polls it, so the
+// connections are only ever written from the AsyncTCP task.
+class Dashboard
+{
+public:
+  const static uint8_t maxAssets = 8;
+  const static uint8_t maxClients = 8;
+  // browsers reconnect after this long when the feed was closed or refused
+  const static uint32_t reconnectDelay = 10 * 1000;
+
+  struct Stats
+  {
+    uint32_t files;
+    uint32_t notModified;
+    uint32_t refusedClients;
+  };
+
+  Dashboard(fs::FS &fs) : fs(fs), feed(reconnectDelay) {}
+
+  void begin(AsyncWebServer &server);
+  // hands the sample to every connected browser, safe from any task
+  void publish(const Sample &sample);
+  uint8_t clients() const { return activeFeeds; }
+
+  const Stats &stats() const { return counters; }
+  LiveFeed::Stats feedStats();
+
+private:
+  struct Asset
+  {
+    char path[32];
+    char etag[12];
+    const char *type;
+  };
+
+  void addAsset(AsyncWebServer &server, const char *name);
+  void serve(AsyncWebServerRequest *request, const Asset &asset);
+  void subscribe(AsyncWebServerRequest *request);
+
+  fs::FS &fs;
+  Asset assets[maxAssets];
+  uint8_t assetCount = 0;
+  // guards the feed between the network task and the AsyncTCP task
+  SemaphoreHandle_t feedMutex = nullptr;
+  LiveFeed feed;
+  std::atomic<uint8_t> activeFeeds{0};
+  Stats counters = {};
+};
@@ -0,0 +1,41 @@
+#include "Deadband.h"
+
+bool Deadband::shouldPublish(int32_t value, uint32_t now) const
+{
+  if (!hasPublished || now - lastPublish >= config.maxSilence)
+  {
+    return true;
+  }
+
+  int64_t change = (int64_t)value - lastValue;
+  change = change < 0 ? -change : change;
+  int64_t magnitude = lastValue < 0 ? -(int64_t)lastValue : lastValue;
+  return change > config.absolute && change * 1000 > magnitude * config.relativePerMille;
+}
+
+void Deadband::published(int32_t value, uint32_t now)
+{
+  hasPublished = true;
+  lastValue = value;
+  lastPublish = now;
+  held = {};
+  counters.sent++;
+}
+
+void Deadband::suppress(int32_t value)
+{
+  if (held.count == 0 || value < held.min)
+  {
+    held.min = value;
+  }
+  if (held.count == 0 || value > held.max)
+  {
+    held.max = value;
+  }
+  if (held.count < UINT16_MAX)
+  {
+    held.count++;
+    held.sum += value;
+  }
+  counters.suppressed++;
+}
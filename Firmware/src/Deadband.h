@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+
+struct DeadbandConfig
+{
+  // a value is only published once it moved by more than both bands from the
+  // last published one, 0 turns a band off
+  int32_t absolute;
+  uint16_t relativePerMille;
+  // published anyway after this long, so subscribers can tell the node is alive
+  uint32_t maxSilence;
+};
+
+// Report by exception for one live value: decides whether a new value is worth
+// publishing and summarises the values that were held back in between.
+// Time is passed in, the class runs on the host with a fake clock.
+class Deadband
+{
+public:
+  // the values suppressed since the last publish
+  struct Window
+  {
+    uint16_t count;
+    int32_t min;
+    int32_t max;
+    int64_t sum;
+  };
+
+  struct Stats
+  {
+    uint32_t sent;
+    uint32_t suppressed;
+  };
+
+  Deadband(const DeadbandConfig &config) : config(config) {}
+
+  bool shouldPublish(int32_t value, uint32_t now) const;
+  // starts a new window, the held back values went out with this one
+  void published(int32_t value, uint32_t now);
+  void suppress(int32_t value);
+
+  const Window &window() const { return held; }
+  const Stats &stats() const { return counters; }
+
+private:
+  DeadbandConfig config;
+  bool hasPublished = false;
+  int32_t lastValue = 0;
+  uint32_t lastPublish = 0;
+  Window held = {};
+  Stats counters = {};
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+// Load the TFT definitions before including the library main header.
+// Every file that draws has to go through here so they all agree on the setup.
+#include <User_Setups/Setup25_TTGO_T_Display.h>
+#define USER_SETUP_LOADED 1
+#include <TFT_eSPI.h>
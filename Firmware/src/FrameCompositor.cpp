@@ -0,0 +1,72 @@
+#include "FrameCompositor.h"
+
+FrameCompositor::FrameCompositor(TFT_eSPI &display)
+    : display(display), sprite(&display)
+{
+}
+
+bool FrameCompositor::begin()
+{
+  sprite.setColorDepth(16);
+  frame = (uint16_t *)sprite.createSprite(display.width(), display.height());
+  if (!frame)
+  {
+    return false;
+  }
+  if (!display.initDMA())
+  {
+    sprite.deleteSprite();
+    frame = nullptr;
+    return false;
+  }
+  panelStale = true;
+  return true;
+}
+
+TFT_eSPI &FrameCompositor::canvas()
+{
+  return enabled() ? (TFT_eSPI &)sprite : display;
+}
+
+void FrameCompositor::push(int16_t top, int16_t bottom)
+{
+  if (!enabled())
+  {
+    return;
+  }
+
+  uint32_t pushStart = micros();
+  if (panelStale)
+  {
+    top = 0;
+    bottom = sprite.height() - 1;
+    panelStale = false;
+  }
+  if (top < 0)
+  {
+    top = 0;
+  }
+  if (bottom >= sprite.height())
+  {
+    bottom = sprite.height() - 1;
+  }
+  if (bottom < top)
+  {
+    return;
+  }
+
+  // whole rows are contiguous in the sprite, so a band can go out in one transfer
+  const int16_t width = sprite.width();
+  const int16_t rows = bottom - top + 1;
+  display.startWrite();
+  display.pushImageDMA(0, top, width, rows, frame + top * width);
+  // the task sleeps until the transfer is done and releases the bus it took
+  uint32_t waitStart = micros();
+  display.dmaWait();
+  display.endWrite();
+
+  pushStats.frames++;
+  pushStats.rowsPushed += rows;
+  pushStats.lastWaitMicros = micros() - waitStart;
+  pushStats.lastPushMicros = micros() - pushStart;
+}
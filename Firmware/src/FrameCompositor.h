@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Display.h"
+
+// Renders into an off-screen sprite and sends the changed rows to the panel
+// with DMA. The pushing task blocks until the transfer is done, so the CPU is
+// free for the other tasks meanwhile, and it ends the SPI transaction it
+// started itself; frames drawn by different tasks can't interleave on the bus.
+// A 240x135 16 bit frame takes about 64kB of DMA capable RAM; if that can't
+// be allocated the compositor falls back to drawing on the panel directly.
+class FrameCompositor
+{
+public:
+  struct Stats
+  {
+    uint32_t frames;
+    uint32_t rowsPushed;
+    // the whole push and the part of it spent blocked on the transfer
+    uint32_t lastPushMicros;
+    uint32_t lastWaitMicros;
+  };
+
+  FrameCompositor(TFT_eSPI &display);
+
+  bool begin();
+  bool enabled() const { return frame != nullptr; }
+  TFT_eSPI &canvas();
+  // the same canvas as a sprite, nullptr while drawing on the panel
+  TFT_eSprite *frameSprite() { return enabled() ? &sprite : nullptr; }
+
+  // sends rows top..bottom of the frame, everything if the panel was drawn over
+  void push(int16_t top, int16_t bottom);
+  // something else drew on the panel, the next push sends the whole frame
+  void invalidatePanel() { panelStale = true; }
+
+  const Stats &stats() const { return pushStats; }
+
+private:
+  TFT_eSPI &display;
+  TFT_eSprite sprite;
+  uint16_t *frame = nullptr;
+  bool panelStale = true;
+  Stats pushStats = {};
+};
@@ -0,0 +1,185 @@
+#include "Gzip.h"
+
+#include <string.h>
+
+#include "Crc32.h"
+
+const static uint16_t maxDistance = 32768;
+const static uint16_t minMatch = 3;
+const static uint16_t maxMatch = 258;
+
+// base and extra bits of the deflate length codes 257..285 and distance codes 0..29
+const static uint16_t lengthBase[] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27,
+                                      31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const static uint8_t lengthExtra[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                      2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const static uint16_t distanceBase[] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                        193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const static uint8_t distanceExtra[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                        6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+static uint16_t hashTriple(const uint8_t *data, uint8_t bits)
+{
+  uint32_t triple = data[0] | data[1] << 8 | data[2] << 16;
+  return (triple * 2654435761u) >> (32 - bits);
+}
+
+size_t GzipCompressor::compress(const uint8_t *input, size_t length, uint8_t *output, size_t capacity)
+{
+  if (length > maxInput)
+  {
+    return 0;
+  }
+  out = output;
+  outCapacity = capacity;
+  outLength = 0;
+  bitBuffer = 0;
+  bitCount = 0;
+  overflow = false;
+  memset(head, 0, sizeof(head));
+
+  // magic, deflate, no flags, no time, no extra flags, unknown OS
+  const uint8_t header[] = {0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF};
+  for (uint8_t byte : header)
+  {
+    writeByte(byte);
+  }
+
+  // a single final block with the fixed codes
+  writeBits(1, 1);
+  writeBits(1, 2);
+
+  size_t pos = 0;
+  while (pos < length && !overflow)
+  {
+    uint16_t matchLength = 0;
+    size_t candidate = 0;
+    if (pos + minMatch <= length)
+    {
+      uint16_t hash = hashTriple(input + pos, hashBits);
+      candidate = head[hash];
+      head[hash] = pos + 1;
+      if (candidate > 0 && pos - (candidate - 1) <= maxDistance)
+      {
+        candidate--;
+        size_t limit = length - pos < maxMatch ? length - pos : maxMatch;
+        while (matchLength < limit && input[candidate + matchLength] == input[pos + matchLength])
+        {
+          matchLength++;
+        }
+      }
+    }
+
+    if (matchLength < minMatch)
+    {
+      writeLiteral(input[pos]);
+      pos++;
+      continue;
+    }
+
+    writeMatch(matchLength, pos - candidate);
+    // the positions inside the match are hashed as well, later lines find them
+    for (size_t end = pos + matchLength, next = pos + 1; next < end && next + minMatch <= length; next++)
+    {
+      head[hashTriple(input + next, hashBits)] = next + 1;
+    }
+    pos += matchLength;
+  }
+  writeLiteral(256);
+  flushBits();
+
+  uint32_t crc = crc32(input, length);
+  uint32_t size = length;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    writeByte(crc >> (8 * i));
+  }
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    writeByte(size >> (8 * i));
+  }
+  return overflow ? 0 : outLength;
+}
+
+// deflate packs bits starting at the least significant one
+void GzipCompressor::writeBits(uint32_t bits, uint8_t count)
+{
+  bitBuffer |= bits << bitCount;
+  bitCount += count;
+  while (bitCount >= 8)
+  {
+    writeByte(bitBuffer);
+    bitBuffer >>= 8;
+    bitCount -= 8;
+  }
+}
+
+// Huffman codes go out most significant bit first
+void GzipCompressor::writeCode(uint16_t code, uint8_t count)
+{
+  uint16_t reversed = 0;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    reversed = (reversed << 1) | ((code >> i) & 1);
+  }
+  writeBits(reversed, count);
+}
+
+void GzipCompressor::writeLiteral(uint16_t value)
+{
+  if (value < 144)
+  {
+    writeCode(0x30 + value, 8);
+  }
+  else if (value < 256)
+  {
+    writeCode(0x190 + value - 144, 9);
+  }
+  else if (value < 280)
+  {
+    writeCode(value - 256, 7);
+  }
+  else
+  {
+    writeCode(0xC0 + value - 280, 8);
+  }
+}
+
+void GzipCompressor::writeMatch(uint16_t length, uint16_t distance)
+{
+  uint8_t code = sizeof(lengthBase) / sizeof(lengthBase[0]) - 1;
+  while (lengthBase[code] > length)
+  {
+    code--;
+  }
+  writeLiteral(257 + code);
+  writeBits(length - lengthBase[code], lengthExtra[code]);
+
+  code = sizeof(distanceBase) / sizeof(distanceBase[0]) - 1;
+  while (distanceBase[code] > distance)
+  {
+    code--;
+  }
+  writeCode(code, 5);
+  writeBits(distance - distanceBase[code], distanceExtra[code]);
+}
+
+void GzipCompressor::writeByte(uint8_t value)
+{
+  if (outLength >= outCapacity)
+  {
+    overflow = true;
+    return;
+  }
+  out[outLength++] = value;
+}
+
+void GzipCompressor::flushBits()
+{
+  if (bitCount > 0)
+  {
+    writeByte(bitBuffer);
+  }
+  bitBuffer = 0;
+  bitCount = 0;
+}
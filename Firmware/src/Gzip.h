@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Compresses a whole buffer into one gzip member: LZ77 over a single entry hash
+// table and the fixed Huffman codes of deflate. Far from zlib's ratio, but line
+// protocol repeats itself so much that it still shrinks to a fraction, without
+// any heap and with a fixed 8kB table.
+// Only depends on the standard headers, the output can be checked with gunzip on the host.
+class GzipCompressor
+{
+public:
+  const static size_t maxInput = UINT16_MAX;
+
+  // the size of the gzip member in output, 0 if it didn't fit or the input is too long
+  size_t compress(const uint8_t *input, size_t length, uint8_t *output, size_t capacity);
+
+private:
+  const static uint8_t hashBits = 12;
+
+  void writeBits(uint32_t bits, uint8_t count);
+  void writeCode(uint16_t code, uint8_t count);
+  void writeLiteral(uint16_t value);
+  void writeMatch(uint16_t length, uint16_t distance);
+  void writeByte(uint8_t value);
+  void flushBits();
+
+  // position + 1 of the last occurrence of every hashed triple, 0 if none
+  uint16_t head[1 << hashBits];
+  uint8_t *out = nullptr;
+  size_t outCapacity = 0;
+  size_t outLength = 0;
+  uint32_t bitBuffer = 0;
+  uint8_t bitCount = 0;
+  bool overflow = false;
+};
@@ -0,0 +1,243 @@
+#include "HistoryLog.h"
+
+#include "Crc32.h"
+
+static const char *historyDirectory = "/history";
+static const char *snapshotPath = "/history/snapshot.bin";
+static const char *snapshotTempPath = "/history/snapshot.tmp";
+static const uint32_t snapshotMagic = 0x41544D48; // "HMTA"
+static const uint16_t snapshotVersion = 1;
+
+HistoryLog::HistoryLog(fs::FS &fs, HistoryRegion *regions, uint8_t regionCount)
+    : fs(fs), regions(regions), regionCount(regionCount)
+{
+}
+
+bool HistoryLog::restore(void (*replay)(const HistoryRecord &record))
+{
+  if (!fs.exists(historyDirectory))
+  {
+    fs.mkdir(historyDirectory);
+  }
+
+  bool hasSnapshot = loadSnapshot();
+
+  // find the range of segments that survived the last compaction
+  bool hasSegments = false;
+  uint32_t lastSegment = 0;
+  File dir = fs.open(historyDirectory);
+  for (File file = dir.openNextFile(); file; file = dir.openNextFile())
+  {
+    const char *name = strrchr(file.name(), '/');
+    name = name ? name + 1 : file.name();
+    if (!strstr(name, ".log"))
+    {
+      continue;
+    }
+    uint32_t segment = strtoul(name, nullptr, 10);
+    if (!hasSegments || segment < firstSegment)
+    {
+      firstSegment = segment;
+    }
+    if (!hasSegments || segment > lastSegment)
+    {
+      lastSegment = segment;
+    }
+    hasSegments = true;
+  }
+
+  replayed = 0;
+  if (hasSegments)
+  {
+    for (uint32_t segment = firstSegment; segment <= lastSegment; segment++)
+    {
+      replaySegment(segment, replay);
+    }
+    // never append behind a possibly torn tail
+    currentSegment = lastSegment + 1;
+  }
+  else
+  {
+    firstSegment = 0;
+    currentSegment = 0;
+  }
+  currentSegmentEntries = 0;
+
+  return hasSnapshot || replayed > 0;
+}
+
+bool HistoryLog::loadSnapshot()
+{
+  File file = fs.open(snapshotPath, "r");
+  if (!file)
+  {
+    return false;
+  }
+
+  SnapshotHeader header;
+  if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      header.magic != snapshotMagic ||
+      header.version != snapshotVersion ||
+      header.regionCount != regionCount ||
+      header.size != regionsSize())
+  {
+    Serial.println("history snapshot doesn't match this firmware, ignoring it");
+    return false;
+  }
+
+  uint32_t crc = 0;
+  bool complete = true;
+  for (uint8_t i = 0; i < regionCount; i++)
+  {
+    complete &= file.read((uint8_t *)regions[i].data, regions[i].size) == regions[i].size;
+    crc = crc32(regions[i].data, regions[i].size, crc);
+  }
+
+  if (!complete || crc != header.crc)
+  {
+    Serial.println("history snapshot is corrupt, ignoring it");
+    for (uint8_t i = 0; i < regionCount; i++)
+    {
+      memset(regions[i].data, 0, regions[i].size);
+    }
+    return false;
+  }
+
+  sequence = header.sequence;
+  return true;
+}
+
+void HistoryLog::replaySegment(uint32_t segment, void (*replay)(const HistoryRecord &record))
+{
+  char path[32];
+  segmentPath(path, sizeof(path), segment);
+  File file = fs.open(path, "r");
+  if (!file)
+  {
+    return;
+  }
+
+  Entry entry;
+  while (file.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry))
+  {
+    if (crc32(&entry, offsetof(Entry, crc)) != entry.crc)
+    {
+      Serial.printf("history segment %u is damaged, skipping its tail\n", segment);
+      return;
+    }
+    // the snapshot already contains everything up to its sequence
+    if (entry.sequence <= sequence)
+    {
+      continue;
+    }
+    replay(entry.record);
+    sequence = entry.sequence;
+    replayed++;
+  }
+}
+
+void HistoryLog::append(const HistoryRecord &record)
+{
+  Entry &entry = pending[pendingCount++];
+  entry.sequence = ++sequence;
+  entry.record = record;
+  entry.crc = crc32(&entry, offsetof(Entry, crc));
+
+  if (pendingCount >= batchSize)
+  {
+    flush();
+  }
+}
+
+void HistoryLog::flush()
+{
+  if (pendingCount == 0)
+  {
+    return;
+  }
+
+  if (currentSegmentEntries + pendingCount > entriesPerSegment)
+  {
+    currentSegment++;
+    currentSegmentEntries = 0;
+  }
+
+  char path[32];
+  segmentPath(path, sizeof(path), currentSegment);
+  File file = fs.open(path, "a");
+  if (!file)
+  {
+    Serial.println("failed to open history segment");
+    pendingCount = 0;
+    return;
+  }
+  file.write((const uint8_t *)pending, pendingCount * sizeof(Entry));
+  file.close();
+  currentSegmentEntries += pendingCount;
+  pendingCount = 0;
+
+  if (currentSegment - firstSegment + 1 > maxSegments)
+  {
+    compact();
+  }
+}
+
+void HistoryLog::compact()
+{
+  SnapshotHeader header;
+  header.magic = snapshotMagic;
+  header.version = snapshotVersion;
+  header.regionCount = regionCount;
+  header.size = regionsSize();
+  header.sequence = sequence;
+  header.crc = 0;
+  for (uint8_t i = 0; i < regionCount; i++)
+  {
+    header.crc = crc32(regions[i].data, regions[i].size, header.crc);
+  }
+
+  File file = fs.open(snapshotTempPath, "w");
+  if (!file)
+  {
+    Serial.println("failed to write history snapshot");
+    return;
+  }
+  file.write((const uint8_t *)&header, sizeof(header));
+  for (uint8_t i = 0; i < regionCount; i++)
+  {
+    file.write((const uint8_t *)regions[i].data, regions[i].size);
+  }
+  file.close();
+
+  // the rename is atomic, until then the old snapshot and all segments stay valid
+  if (!fs.rename(snapshotTempPath, snapshotPath))
+  {
+    Serial.println("failed to replace history snapshot");
+    return;
+  }
+
+  char path[32];
+  for (uint32_t segment = firstSegment; segment <= currentSegment; segment++)
+  {
+    segmentPath(path, sizeof(path), segment);
+    fs.remove(path);
+  }
+  firstSegment = currentSegment + 1;
+  currentSegment = firstSegment;
+  currentSegmentEntries = 0;
+}
+
+void HistoryLog::segmentPath(char *dst, size_t len, uint32_t segment) const
+{
+  snprintf(dst, len, "%s/%u.log", historyDirectory, segment);
+}
+
+size_t HistoryLog::regionsSize() const
+{
+  size_t size = 0;
+  for (uint8_t i = 0; i < regionCount; i++)
+  {
+    size += regions[i].size;
+  }
+  return size;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "HistoryRecord.h"
+
+// memory that goes into a snapshot byte by byte, e.g. a TieredHistory.
+// An all zero region has to be a valid empty state.
+struct HistoryRegion
+{
+  void *data;
+  size_t size;
+};
+
+// Append-only log of history records on a flash file system.
+// Records are buffered in RAM and written in batches into fixed size segment
+// files, each one carrying a sequence number and a checksum. When too many
+// segments pile up, the regions are written to a snapshot and the segments
+// are dropped. Restoring loads the snapshot and replays the newer records,
+// a torn write at the end of a segment only loses that segment's tail.
+class HistoryLog
+{
+public:
+  const static uint8_t batchSize = 10;
+  const static size_t segmentSize = 4000;
+  const static uint8_t maxSegments = 8;
+
+  HistoryLog(fs::FS &fs, HistoryRegion *regions, uint8_t regionCount);
+
+  // returns false if neither a snapshot nor any record could be loaded
+  bool restore(void (*replay)(const HistoryRecord &record));
+  void append(const HistoryRecord &record);
+  // writes buffered records, call before restarting
+  void flush();
+
+  uint32_t restoredRecords() const { return replayed; }
+
+private:
+  struct Entry
+  {
+    uint32_t sequence;
+    HistoryRecord record;
+    uint32_t crc;
+  };
+
+  struct SnapshotHeader
+  {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t regionCount;
+    uint32_t size;
+    uint32_t sequence;
+    uint32_t crc;
+  };
+
+  const static uint16_t entriesPerSegment = segmentSize / sizeof(Entry);
+
+  bool loadSnapshot();
+  void replaySegment(uint32_t segment, void (*replay)(const HistoryRecord &record));
+  void compact();
+  void segmentPath(char *dst, size_t len, uint32_t segment) const;
+  size_t regionsSize() const;
+
+  fs::FS &fs;
+  HistoryRegion *regions;
+  uint8_t regionCount;
+
+  Entry pending[batchSize];
+  uint8_t pendingCount = 0;
+  uint32_t sequence = 0;
+  uint32_t replayed = 0;
+
+  uint32_t firstSegment = 0;
+  uint32_t currentSegment = 0;
+  uint16_t currentSegmentEntries = 0;
+};
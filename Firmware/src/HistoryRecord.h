@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+// one minute of all charted metrics as it is stored in the log
+struct HistoryRecord
+{
+  uint16_t co2;
+  uint16_t pm010;
+  uint16_t pm025;
+  uint16_t pm100;
+  float lux;
+};
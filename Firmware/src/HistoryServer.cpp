@@ -0,0 +1,113 @@
+#include "HistoryServer.h"
+
+#include <ESPAsyncWebServer.h>
+#include <memory>
+
+HistoryServer::HistoryServer(const Metric *metrics, uint8_t metricCount, uint32_t (*unixTime)())
+    : metrics(metrics), metricCount(metricCount), unixTime(unixTime)
+{
+}
+
+void HistoryServer::begin(SemaphoreHandle_t mutex, uint16_t port)
+{
+  this->mutex = mutex;
+  server = new AsyncWebServer(port);
+  server->on("/history", HTTP_GET, [this](AsyncWebServerRequest *request) { handleHistory(request); });
+  server->begin();
+}
+
+void HistoryServer::handleHistory(AsyncWebServerRequest *request)
+{
+  counters.requests++;
+  const Metric *metric = request->hasParam("metric") ? findMetric(request->getParam("metric")->value()) : nullptr;
+  if (!metric)
+  {
+    String names;
+    for (uint8_t i = 0; i < metricCount; i++)
+    {
+      names += i > 0 ? ", " : "";
+      names += metrics[i].name;
+    }
+    request->send(400, "text/plain", "metric is one of " + names + "\n");
+    return;
+  }
+
+  HistoryTier tier = HistoryTier::minute;
+  if (request->hasParam("tier"))
+  {
+    const String &name = request->getParam("tier")->value();
+    if (name == "hour")
+    {
+      tier = HistoryTier::hour;
+    }
+    else if (name == "day")
+    {
+      tier = HistoryTier::day;
+    }
+    else if (name == "week")
+    {
+      tier = HistoryTier::week;
+    }
+    else if (name != "minute")
+    {
+      request->send(400, "text/plain", "tier is minute, hour, day or week\n");
+      return;
+    }
+  }
+  long from = request->hasParam("from") ? request->getParam("from")->value().toInt() : 0;
+  long count = request->hasParam("count") ? request->getParam("count")->value().toInt() : UINT16_MAX;
+  if (from < 0 || from > UINT16_MAX || count < 0)
+  {
+    request->send(400, "text/plain", "from and count are slot counts\n");
+    return;
+  }
+  bool json = request->hasParam("format") && request->getParam("format")->value() == "json";
+
+  // every stream only holds its cursor, a cap on the streams caps the memory
+  if (activeStreams.fetch_add(1) >= maxStreams)
+  {
+    activeStreams--;
+    counters.rejected++;
+    request->send(503, "text/plain", "too many history downloads\n");
+    return;
+  }
+  struct Transfer
+  {
+    HistoryStream stream;
+    std::atomic<uint8_t> &active;
+    ~Transfer() { active--; }
+  };
+  std::shared_ptr<Transfer> transfer(new Transfer{
+      HistoryStream(*metric->source, metric->name, tier, from, count > UINT16_MAX ? UINT16_MAX : count,
+                    json ? HistoryFormat::json : HistoryFormat::csv, unixTime()),
+      activeStreams});
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse(
+      json ? "application/json" : "text/csv",
+      [this, transfer](uint8_t *buffer, size_t maxLength, size_t index) -> size_t {
+        // the AsyncTCP task must not wait, it asks again while a measurement is added
+        if (xSemaphoreTake(mutex, 0) != pdTRUE)
+        {
+          return RESPONSE_TRY_AGAIN;
+        }
+        uint16_t rowsBefore = transfer->stream.rowsWritten();
+        size_t length = transfer->stream.read(buffer, maxLength);
+        xSemaphoreGive(mutex);
+        counters.rows += transfer->stream.rowsWritten() - rowsBefore;
+        counters.bytes += length;
+        return length;
+      });
+  request->send(response);
+}
+
+const HistoryServer::Metric *HistoryServer::findMetric(const String &name) const
+{
+  for (uint8_t i = 0; i < metricCount; i++)
+  {
+    if (name == metrics[i].name)
+    {
+      return &metrics[i];
+    }
+  }
+  return nullptr;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "HistoryStream.h"
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+
+// Serves the histories over HTTP:
+//   GET /history?metric=pm25&tier=hour&from=0&count=24&format=json
+// tier is minute, hour, day or week, from and count select slots by age and
+// format is csv (default) or json. Responses are chunked and formatted while
+// the client reads, the histories are only locked for one chunk at a time.
+// Kept out of main.cpp, the async server can't share a translation unit with
+// the WiFiManager's synchronous one.
+class HistoryServer
+{
+public:
+  const static uint8_t maxStreams = 4;
+
+  struct Metric
+  {
+    const char *name;
+    const HistorySource *source;
+  };
+
+  struct Stats
+  {
+    uint32_t requests;
+    uint32_t rejected;
+    uint32_t rows;
+    uint64_t bytes;
+  };
+
+  HistoryServer(const Metric *metrics, uint8_t metricCount, uint32_t (*unixTime)());
+
+  // mutex guards the histories against the task adding measurements
+  void begin(SemaphoreHandle_t mutex, uint16_t port = 80);
+  // further pages share the server, e.g. the dashboard
+  AsyncWebServer &webServer() { return *server; }
+
+  const Stats &stats() const { return counters; }
+
+private:
+  void handleHistory(AsyncWebServerRequest *request);
+  const Metric *findMetric(const String &name) const;
+
+  const Metric *metrics;
+  uint8_t metricCount;
+  uint32_t (*unixTime)();
+  SemaphoreHandle_t mutex = nullptr;
+  AsyncWebServer *server = nullptr;
+  std::atomic<uint8_t> activeStreams{0};
+  Stats counters = {};
+};
@@ -0,0 +1,110 @@
+#include "HistoryStream.h"
+
+#include <stdio.h>
+#include <string.h>
+
+HistoryStream::HistoryStream(const HistorySource &source, const char *metric, HistoryTier tier,
+                             uint16_t first, uint16_t count, HistoryFormat format, uint32_t newestTime)
+    : source(source), metric(metric), tier(tier), format(format), newestTime(newestTime)
+{
+  uint16_t size = source.size(tier);
+  uint32_t end = (uint32_t)first + count;
+  age = (end < size ? end : size) - 1;
+  lastAge = first;
+}
+
+size_t HistoryStream::read(uint8_t *buffer, size_t capacity)
+{
+  size_t filled = 0;
+  while (filled < capacity)
+  {
+    if (pendingSent == pendingLength)
+    {
+      if (part == Part::done)
+      {
+        break;
+      }
+      formatNext();
+      continue;
+    }
+    size_t chunk = pendingLength - pendingSent;
+    chunk = chunk < capacity - filled ? chunk : capacity - filled;
+    memcpy(buffer + filled, pending + pendingSent, chunk);
+    pendingSent += chunk;
+    filled += chunk;
+  }
+  return filled;
+}
+
+void HistoryStream::formatNext()
+{
+  int length = 0;
+  pendingSent = 0;
+  switch (part)
+  {
+  case Part::header:
+    length = format == HistoryFormat::csv
+                 ? snprintf(pending, sizeof(pending), "time,min,max,mean,count\n")
+                 : snprintf(pending, sizeof(pending), "{\"metric\":\"%s\",\"tier\":\"%s\",\"columns\":[\"time\",\"min\",\"max\",\"mean\",\"count\"],\"rows\":[",
+                            metric, tierName(tier));
+    part = Part::rows;
+    break;
+
+  case Part::rows:
+  {
+    if (age < lastAge)
+    {
+      part = Part::footer;
+      break;
+    }
+    HistoryBucket<float> bucket = source.at(tier, age);
+    uint32_t time = newestTime > 0 ? newestTime - age * slotSeconds(tier) : 0;
+    const char *rowFormat = format == HistoryFormat::csv ? "%u,%g,%g,%.2f,%u\n" : "%s[%u,%g,%g,%.2f,%u]";
+    length = format == HistoryFormat::csv
+                 ? snprintf(pending, sizeof(pending), rowFormat, time, bucket.min, bucket.max, bucket.mean, bucket.count)
+                 : snprintf(pending, sizeof(pending), rowFormat, written > 0 ? "," : "", time, bucket.min, bucket.max, bucket.mean, bucket.count);
+    written++;
+    age--;
+    break;
+  }
+
+  case Part::footer:
+    length = format == HistoryFormat::json ? snprintf(pending, sizeof(pending), "]}\n") : 0;
+    part = Part::done;
+    break;
+
+  case Part::done:
+    break;
+  }
+  pendingLength = length > 0 ? (length < (int)sizeof(pending) ? length : sizeof(pending) - 1) : 0;
+}
+
+uint32_t HistoryStream::slotSeconds(HistoryTier tier)
+{
+  switch (tier)
+  {
+  case HistoryTier::minute:
+    return 60;
+  case HistoryTier::hour:
+    return 60 * 60;
+  case HistoryTier::day:
+    return 24 * 60 * 60;
+  default:
+    return 7 * 24 * 60 * 60;
+  }
+}
+
+const char *HistoryStream::tierName(HistoryTier tier)
+{
+  switch (tier)
+  {
+  case HistoryTier::minute:
+    return "minute";
+  case HistoryTier::hour:
+    return "hour";
+  case HistoryTier::day:
+    return "day";
+  default:
+    return "week";
+  }
+}
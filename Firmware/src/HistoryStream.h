@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TieredHistory.h"
+
+// the tiers of one metric as a stream sees them, the histories differ in their value type
+class HistorySource
+{
+public:
+  virtual uint16_t size(HistoryTier tier) const = 0;
+  virtual HistoryBucket<float> at(HistoryTier tier, uint16_t age) const = 0;
+};
+
+template <typename History>
+class HistorySourceOf : public HistorySource
+{
+public:
+  HistorySourceOf(const History &history) : history(history) {}
+
+  uint16_t size(HistoryTier tier) const override { return history.size(tier); }
+
+  HistoryBucket<float> at(HistoryTier tier, uint16_t age) const override
+  {
+    const typename History::Bucket &bucket = history.at(tier, age);
+    HistoryBucket<float> converted;
+    converted.min = bucket.min;
+    converted.max = bucket.max;
+    converted.mean = bucket.mean;
+    converted.count = bucket.count;
+    return converted;
+  }
+
+private:
+  const History &history;
+};
+
+enum class HistoryFormat : uint8_t
+{
+  csv,
+  json,
+};
+
+// Formats a range of one tier as CSV or JSON while it is read, a row at a time,
+// so a response of any length only needs the stream itself and the caller's buffer.
+// Rows go from the oldest to the newest slot, every row holds the estimated end
+// of its slot in unix seconds, taking the newest slot as ending at newestTime.
+// The source is read on every call, the caller keeps it from changing meanwhile.
+class HistoryStream
+{
+public:
+  // the slots from age first up to, not including, first + count
+  HistoryStream(const HistorySource &source, const char *metric, HistoryTier tier,
+                uint16_t first, uint16_t count, HistoryFormat format, uint32_t newestTime);
+
+  // fills buffer with the next part of the document, 0 once it is complete
+  size_t read(uint8_t *buffer, size_t capacity);
+  uint16_t rowsWritten() const { return written; }
+
+  static uint32_t slotSeconds(HistoryTier tier);
+  static const char *tierName(HistoryTier tier);
+
+private:
+  enum class Part : uint8_t
+  {
+    header,
+    rows,
+    footer,
+    done,
+  };
+
+  void formatNext();
+
+  const HistorySource &source;
+  const char *metric;
+  HistoryTier tier;
+  HistoryFormat format;
+  uint32_t newestTime;
+  // counts down to the newest slot of the range
+  int32_t age;
+  int32_t lastAge;
+  uint16_t written = 0;
+  Part part = Part::header;
+
+  char pending[128];
+  uint8_t pendingLength = 0;
+  uint8_t pendingSent = 0;
+};
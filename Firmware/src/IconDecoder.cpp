@@ -0,0 +1,38 @@
+#include "IconDecoder.h"
+
+uint32_t drawIcon(TFT_eSPI &canvas, int32_t x, int32_t y, const CompressedIcon &icon)
+{
+  uint16_t row[UINT8_MAX];
+  const uint8_t *data = icon.data;
+  uint32_t decodeMicros = 0;
+
+  for (uint8_t line = 0; line < icon.height; line++)
+  {
+    uint32_t decodeStart = micros();
+    uint8_t column = 0;
+    while (column < icon.width)
+    {
+      uint8_t control = *data++;
+      if (control < 128)
+      {
+        for (uint8_t i = 0; i <= control && column < icon.width; i++)
+        {
+          row[column++] = icon.palette[*data++];
+        }
+      }
+      else
+      {
+        uint16_t color = icon.palette[*data++];
+        for (uint8_t i = 0; i < control - 126 && column < icon.width; i++)
+        {
+          row[column++] = color;
+        }
+      }
+    }
+    decodeMicros += micros() - decodeStart;
+
+    canvas.pushImage(x, y + line, icon.width, 1, row);
+  }
+
+  return decodeMicros;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Display.h"
+#include "assets/CompressedIcon.h"
+
+// Decodes the icon one row at a time into a small stack buffer and pushes every
+// row as soon as it is complete, so the full image never sits in RAM.
+// Returns the time spent decoding (without the pushes) in microseconds.
+uint32_t drawIcon(TFT_eSPI &canvas, int32_t x, int32_t y, const CompressedIcon &icon);
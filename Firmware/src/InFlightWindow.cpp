@@ -0,0 +1,72 @@
+#include "InFlightWindow.h"
+
+void InFlightWindow::add(uint16_t packetId, uint16_t samples)
+{
+  if (full())
+  {
+    return;
+  }
+  entries[(head + count) % maxSize] = {packetId, samples, false};
+  count++;
+  sampleCount += samples;
+}
+
+uint16_t InFlightWindow::acknowledge(uint16_t packetId)
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Entry &entry = entries[(head + i) % maxSize];
+    if (entry.packetId == packetId)
+    {
+      entry.acknowledged = true;
+      break;
+    }
+  }
+
+  uint16_t delivered = 0;
+  while (count > 0 && entries[head].acknowledged)
+  {
+    delivered += entries[head].samples;
+    sampleCount -= entries[head].samples;
+    head = (head + 1) % maxSize;
+    count--;
+  }
+  unsentCount = unsentCount < count ? unsentCount : count;
+  return delivered;
+}
+
+void InFlightWindow::dropFront(uint16_t samples)
+{
+  while (count > 0 && samples > 0)
+  {
+    Entry &entry = entries[head];
+    if (samples < entry.samples)
+    {
+      // the rest of the publish still has to be delivered, its ack only covers that
+      entry.samples -= samples;
+      sampleCount -= samples;
+      break;
+    }
+    samples -= entry.samples;
+    sampleCount -= entry.samples;
+    head = (head + 1) % maxSize;
+    count--;
+  }
+  unsentCount = unsentCount < count ? unsentCount : count;
+}
+
+void InFlightWindow::clear()
+{
+  head = 0;
+  count = 0;
+  sampleCount = 0;
+  unsentCount = 0;
+}
+
+void InFlightWindow::resent()
+{
+  if (unsentCount > 0)
+  {
+    unsentCount--;
+  }
+}
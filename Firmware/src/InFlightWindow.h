@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+// QoS 1 publishes that went out but weren't acknowledged yet, oldest first.
+// Every publish carries the next few samples from the front of the outbox, so
+// the samples covered by the window are always the first samples() of it.
+// Acknowledgements may come in any order, the outbox is only advanced over the
+// acknowledged prefix. After a reconnect everything still in the window is
+// sent again with the same packet ids, oldest first; a resend that doesn't get
+// through is picked up where it stopped.
+class InFlightWindow
+{
+public:
+  const static uint8_t maxSize = 8;
+
+  InFlightWindow(uint8_t size) : capacity(size < maxSize ? size : maxSize) {}
+
+  bool full() const { return count >= capacity; }
+  uint8_t size() const { return count; }
+  uint16_t samples() const { return sampleCount; }
+
+  void add(uint16_t packetId, uint16_t samples);
+  // returns how many samples at the front of the outbox are delivered now
+  uint16_t acknowledge(uint16_t packetId);
+  // the outbox dropped samples from its front, publishes left without samples are forgotten
+  void dropFront(uint16_t samples);
+  void clear();
+
+  // after a reconnect every publish has to go out again
+  void resendAll() { unsentCount = count; }
+  // publishes still to be sent again, they are the newest ones
+  uint8_t unsent() const { return unsentCount; }
+  void resent();
+
+  // index 0 is the oldest publish
+  uint16_t packetIdAt(uint8_t index) const { return entries[(head + index) % maxSize].packetId; }
+  uint16_t samplesAt(uint8_t index) const { return entries[(head + index) % maxSize].samples; }
+
+private:
+  struct Entry
+  {
+    uint16_t packetId;
+    uint16_t samples;
+    bool acknowledged;
+  };
+
+  uint8_t capacity;
+  Entry entries[maxSize];
+  uint8_t head = 0;
+  uint8_t count = 0;
+  uint16_t sampleCount = 0;
+  uint8_t unsentCount = 0;
+};
@@ -0,0 +1,69 @@
+#include "InfluxHttpWriter.h"
+
+const static uint16_t httpTimeout = 5000;
+
+InfluxHttpWriter::InfluxHttpWriter(uint8_t *scratch, size_t scratchSize, uint32_t backoffBase, uint32_t backoffCap)
+    : backoff(backoffBase, backoffCap), scratch(scratch), scratchSize(scratchSize)
+{
+}
+
+void InfluxHttpWriter::begin(const char *url)
+{
+  strlcpy(this->url, url, sizeof(this->url));
+  http.setReuse(true);
+  http.setTimeout(httpTimeout);
+  static const char *headers[] = {"Retry-After"};
+  http.collectHeaders(headers, 1);
+}
+
+InfluxHttpWriter::Result InfluxHttpWriter::write(const char *lines, size_t length, uint32_t now)
+{
+  // random data would grow, it goes out as it is
+  size_t compressed = gzip.compress((const uint8_t *)lines, length, scratch, scratchSize);
+  bool useGzip = compressed > 0 && compressed < length;
+
+  // begin() only parses the url, an open connection to the same host is reused
+  if (!http.begin(client, url))
+  {
+    Serial.printf("invalid influx url %s\n", url);
+    retryLater(now, 0);
+    return Result::retryLater;
+  }
+  http.addHeader("Content-Type", "text/plain; charset=utf-8");
+  if (useGzip)
+  {
+    http.addHeader("Content-Encoding", "gzip");
+  }
+
+  int status = useGzip ? http.POST(scratch, compressed) : http.POST((uint8_t *)lines, length);
+  uint32_t serverDelay = http.header("Retry-After").toInt() * 1000;
+  http.end();
+
+  counters.posts++;
+  counters.lastStatus = status;
+  if (status >= 200 && status < 300)
+  {
+    counters.rawBytes += length;
+    counters.sentBytes += useGzip ? compressed : length;
+    backoff.reset();
+    return Result::written;
+  }
+  if (status == HTTP_CODE_BAD_REQUEST || status == HTTP_CODE_PAYLOAD_TOO_LARGE)
+  {
+    counters.rejected++;
+    return Result::rejected;
+  }
+
+  // connection errors are negative, 401, 404, 429 and 5xx may all go away
+  Serial.printf("influx write failed: %d %s\n", status, http.errorToString(status).c_str());
+  retryLater(now, serverDelay);
+  return Result::retryLater;
+}
+
+void InfluxHttpWriter::retryLater(uint32_t now, uint32_t serverDelay)
+{
+  counters.failures++;
+  uint32_t delay = backoff.next(esp_random());
+  counters.lastBackoff = delay > serverDelay ? delay : serverDelay;
+  retryAt = now + counters.lastBackoff;
+}
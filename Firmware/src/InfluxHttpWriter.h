@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+
+#include "Backoff.h"
+#include "Gzip.h"
+
+// Posts line protocol straight to the /write endpoint of InfluxDB, so no MQTT
+// bridge is needed. Bodies are gzip compressed into a caller supplied buffer
+// whenever that is smaller, the connection is kept open between posts.
+// A failed post is retried after a jittered exponential backoff or the
+// server's Retry-After, whichever is longer. A batch the server refuses as
+// malformed is reported as rejected, retrying it would only block the rest.
+class InfluxHttpWriter
+{
+public:
+  enum class Result : uint8_t
+  {
+    written,
+    retryLater,
+    rejected,
+  };
+
+  struct Stats
+  {
+    uint32_t posts;
+    uint32_t failures;
+    uint32_t rejected;
+    uint64_t rawBytes;
+    uint64_t sentBytes;
+    int16_t lastStatus;
+    uint32_t lastBackoff;
+  };
+
+  InfluxHttpWriter(uint8_t *scratch, size_t scratchSize, uint32_t backoffBase = 2 * 1000, uint32_t backoffCap = 5 * 60 * 1000);
+
+  // e.g. http://influx:8086/write?db=atmonode, an empty url turns the writer off
+  void begin(const char *url);
+  bool enabled() const { return url[0] != '\0'; }
+  // false while backing off after a failed post
+  bool ready(uint32_t now) const { return (int32_t)(now - retryAt) >= 0; }
+  Result write(const char *lines, size_t length, uint32_t now);
+
+  const Stats &stats() const { return counters; }
+
+private:
+  void retryLater(uint32_t now, uint32_t serverDelay);
+
+  WiFiClient client;
+  HTTPClient http;
+  GzipCompressor gzip;
+  Backoff backoff;
+  uint8_t *scratch;
+  size_t scratchSize;
+  char url[96] = "";
+  uint32_t retryAt = 0;
+  Stats counters = {};
+};
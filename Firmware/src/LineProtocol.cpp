@@ -0,0 +1,187 @@
+#include "LineProtocol.h"
+
+#include <math.h>
+
+LineProtocolWriter::LineProtocolWriter(char *buffer, size_t capacity)
+    : buffer(buffer), capacity(capacity)
+{
+  clear();
+}
+
+void LineProtocolWriter::clear()
+{
+  pos = 0;
+  committed = 0;
+  lines = 0;
+  hasFields = false;
+  overflow = false;
+  if (capacity > 0)
+  {
+    buffer[0] = '\0';
+  }
+}
+
+LineProtocolWriter &LineProtocolWriter::beginLine(const char *measurement)
+{
+  commitLine();
+  if (lines > 0)
+  {
+    append('\n');
+  }
+  appendEscaped(measurement, ", ");
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::tag(const char *key, const char *value)
+{
+  append(',');
+  appendEscaped(key, ",= ");
+  append('=');
+  appendEscaped(value, ",= ");
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::field(const char *key, int32_t value)
+{
+  beginField(key);
+  if (value < 0)
+  {
+    append('-');
+    appendUnsigned(-(uint32_t)value);
+  }
+  else
+  {
+    appendUnsigned(value);
+  }
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::field(const char *key, uint32_t value)
+{
+  beginField(key);
+  appendUnsigned(value);
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::field(const char *key, float value, uint8_t precision)
+{
+  if (isnan(value) || isinf(value))
+  {
+    return *this;
+  }
+
+  beginField(key);
+  if (value < 0)
+  {
+    append('-');
+    value = -value;
+  }
+
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < precision; i++)
+  {
+    scale *= 10;
+  }
+  uint64_t scaled = (uint64_t)(value * scale + 0.5f);
+  appendUnsigned(scaled / scale);
+  if (precision > 0)
+  {
+    append('.');
+    uint32_t fraction = scaled % scale;
+    for (uint32_t digit = scale / 10; digit > 0; digit /= 10)
+    {
+      append('0' + (fraction / digit) % 10);
+    }
+  }
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::timestamp(uint64_t milliseconds)
+{
+  append(' ');
+  appendUnsigned(milliseconds);
+  append("000000");
+  return *this;
+}
+
+LineProtocolWriter &LineProtocolWriter::end()
+{
+  commitLine();
+  return *this;
+}
+
+void LineProtocolWriter::beginField(const char *key)
+{
+  append(hasFields ? ',' : ' ');
+  hasFields = true;
+  appendEscaped(key, ",= ");
+  append('=');
+}
+
+// a line only counts once it has at least one field and fit into the buffer completely
+void LineProtocolWriter::commitLine()
+{
+  if (!overflow && hasFields && pos > committed)
+  {
+    committed = pos;
+    lines++;
+  }
+  pos = committed;
+  hasFields = false;
+  if (capacity > 0)
+  {
+    buffer[committed] = '\0';
+  }
+}
+
+void LineProtocolWriter::append(char c)
+{
+  // keep one byte for the terminator
+  if (overflow || pos + 1 >= capacity)
+  {
+    overflow = true;
+    return;
+  }
+  buffer[pos++] = c;
+  buffer[pos] = '\0';
+}
+
+void LineProtocolWriter::append(const char *text)
+{
+  while (*text)
+  {
+    append(*text++);
+  }
+}
+
+void LineProtocolWriter::appendEscaped(const char *text, const char *special)
+{
+  for (; *text; text++)
+  {
+    for (const char *s = special; *s; s++)
+    {
+      if (*text == *s)
+      {
+        append('\\');
+        break;
+      }
+    }
+    append(*text);
+  }
+}
+
+void LineProtocolWriter::appendUnsigned(uint64_t value)
+{
+  char digits[20];
+  uint8_t count = 0;
+  do
+  {
+    digits[count++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+
+  while (count > 0)
+  {
+    append(digits[--count]);
+  }
+}
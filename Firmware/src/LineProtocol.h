@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Builds InfluxDB line protocol into a caller supplied buffer without touching the heap.
+// Lines are separated by '\n', so several points can share one buffer.
+// Once the buffer is full the writer stops, keeps the last complete line and reports the overflow.
+// Non finite floats can't be represented in line protocol and are skipped.
+class LineProtocolWriter
+{
+public:
+  LineProtocolWriter(char *buffer, size_t capacity);
+
+  LineProtocolWriter &beginLine(const char *measurement);
+  LineProtocolWriter &tag(const char *key, const char *value);
+  LineProtocolWriter &field(const char *key, int32_t value);
+  LineProtocolWriter &field(const char *key, uint32_t value);
+  LineProtocolWriter &field(const char *key, float value, uint8_t precision = 2);
+  // unix time in milliseconds, written with influx' default nanosecond precision
+  LineProtocolWriter &timestamp(uint64_t milliseconds);
+  // finishes the current line, a line without any field is discarded
+  LineProtocolWriter &end();
+
+  void clear();
+  const char *c_str() const { return buffer; }
+  size_t length() const { return committed; }
+  size_t capacityLeft() const { return capacity - committed - 1; }
+  size_t lineCount() const { return lines; }
+  bool overflowed() const { return overflow; }
+
+private:
+  void commitLine();
+  void append(char c);
+  void append(const char *text);
+  void appendEscaped(const char *text, const char *special);
+  void appendUnsigned(uint64_t value);
+  void beginField(const char *key);
+
+  char *buffer;
+  size_t capacity;
+  size_t pos = 0;
+  // everything before this index belongs to finished lines
+  size_t committed = 0;
+  size_t lines = 0;
+  bool hasFields = false;
+  bool overflow = false;
+};
@@ -0,0 +1,46 @@
+#include "LiveFeed.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+void LiveFeed::publish(const Sample &sample)
+{
+  eventId++;
+  int length = snprintf(event, sizeof(event),
+                        "id: %" PRIu32 "\nevent: sample\n"
+                        "data: {\"time\":%" PRIu64 ",\"co2\":%d,\"co2Temp\":%d,\"lux\":%.1f,\"pm10\":%u,\"pm25\":%u,\"pm100\":%u}\n\n",
+                        eventId, sample.timestamp, sample.co2, sample.co2Temp, sample.lux,
+                        sample.pms.pm10_standard, sample.pms.pm25_standard, sample.pms.pm100_standard);
+  eventLength = length > 0 && length < (int)sizeof(event) ? length : 0;
+  counters.samples++;
+}
+
+size_t LiveFeed::next(Cursor &cursor, char *buffer, size_t capacity)
+{
+  if (!cursor.greeted)
+  {
+    // the browser starts counting at the current sample, it waits for the next one
+    char greeting[64];
+    int length = snprintf(greeting, sizeof(greeting), "retry: %" PRIu32 "\nid: %" PRIu32 "\ndata: hello\n\n",
+                          reconnectDelay, eventId);
+    if (length <= 0 || (size_t)length > capacity)
+    {
+      return 0;
+    }
+    memcpy(buffer, greeting, length);
+    cursor.greeted = true;
+    cursor.sentId = eventId;
+    return length;
+  }
+
+  if (cursor.sentId == eventId || eventLength == 0 || eventLength > capacity)
+  {
+    return 0;
+  }
+  memcpy(buffer, event, eventLength);
+  counters.events++;
+  counters.skipped += eventId - cursor.sentId - 1;
+  cursor.sentId = eventId;
+  return eventLength;
+}
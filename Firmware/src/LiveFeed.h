@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Sample.h"
+
+// The newest sample as a Server-Sent Event, for any number of browser feeds.
+// publish() replaces the event, every feed picks it up at its own pace and
+// keeps the id of the last event it got. A feed that falls behind only gets
+// the newest sample, the gap in the ids tells the browser how many it missed.
+// Not synchronised, the caller locks around it; only depends on the standard headers.
+class LiveFeed
+{
+public:
+  // where a feed is, it starts zeroed
+  struct Cursor
+  {
+    uint32_t sentId;
+    bool greeted;
+  };
+
+  struct Stats
+  {
+    uint32_t samples;
+    uint32_t events;
+    // samples a feed never got because a newer one replaced them first
+    uint32_t skipped;
+  };
+
+  LiveFeed(uint32_t reconnectDelay) : reconnectDelay(reconnectDelay) {}
+
+  void publish(const Sample &sample);
+  // the next part of a feed into buffer: the greeting with the reconnect delay,
+  // then every new sample. 0 if there is nothing new or it doesn't fit yet
+  size_t next(Cursor &cursor, char *buffer, size_t capacity);
+
+  const Stats &stats() const { return counters; }
+
+private:
+  uint32_t reconnectDelay;
+  char event[224];
+  size_t eventLength = 0;
+  uint32_t eventId = 0;
+  Stats counters = {};
+};
@@ -0,0 +1,80 @@
+#include "MqttLink.h"
+
+#include <WiFi.h>
+
+MqttLink::MqttLink(AsyncMqttClient &client, uint32_t backoffBase, uint32_t backoffCap)
+    : client(client), backoff(backoffBase, backoffCap)
+{
+}
+
+void MqttLink::begin()
+{
+  client.onConnect([this](bool sessionPresent) { connectedEvent = true; });
+  client.onDisconnect([this](AsyncMqttClientDisconnectReason reason) { disconnectedEvent = true; });
+}
+
+bool MqttLink::service(uint32_t now)
+{
+  if (disconnectedEvent.exchange(false) && state != State::idle)
+  {
+    if (state == State::connected)
+    {
+      counters.disconnects++;
+      Serial.println("MQTT connection lost");
+    }
+    else
+    {
+      counters.failedAttempts++;
+    }
+    state = State::idle;
+    retryLater(now);
+  }
+  if (connectedEvent.exchange(false) && state == State::connecting)
+  {
+    state = State::connected;
+    counters.connects++;
+    backoff.reset();
+    reconnected = true;
+  }
+
+  switch (state)
+  {
+  case State::idle:
+    if (WiFi.status() == WL_CONNECTED && (int32_t)(now - retryAt) >= 0)
+    {
+      state = State::connecting;
+      attemptStart = now;
+      client.connect();
+    }
+    break;
+
+  case State::connecting:
+    if (now - attemptStart > connectTimeout)
+    {
+      // the disconnect callback of the aborted attempt finds the link idle already
+      state = State::idle;
+      counters.failedAttempts++;
+      client.disconnect(true);
+      retryLater(now);
+    }
+    break;
+
+  case State::connected:
+    break;
+  }
+  return state == State::connected;
+}
+
+bool MqttLink::takeReconnected()
+{
+  bool result = reconnected;
+  reconnected = false;
+  return result;
+}
+
+void MqttLink::retryLater(uint32_t now)
+{
+  counters.lastBackoff = backoff.next(esp_random());
+  retryAt = now + counters.lastBackoff;
+  Serial.printf("MQTT not connected, next attempt in %u ms\n", counters.lastBackoff);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncMqttClient.h>
+#include <atomic>
+
+#include "Backoff.h"
+
+// Keeps an AsyncMqttClient connected without ever blocking the caller.
+// The handshake runs in the AsyncTCP task, its callbacks only raise flags that
+// service() picks up on the network task. Failed attempts and lost connections
+// are retried after a jittered exponential backoff, an attempt that hangs is
+// aborted after connectTimeout.
+class MqttLink
+{
+public:
+  const static uint32_t connectTimeout = 10 * 1000;
+
+  struct Stats
+  {
+    uint32_t connects;
+    uint32_t disconnects;
+    uint32_t failedAttempts;
+    uint32_t lastBackoff;
+  };
+
+  MqttLink(AsyncMqttClient &client, uint32_t backoffBase = 1000, uint32_t backoffCap = 5 * 60 * 1000);
+
+  // registers the callbacks, call once before the first service()
+  void begin();
+  // starts or checks on a connection attempt, returns true while connected
+  bool service(uint32_t now);
+  bool connected() const { return state == State::connected; }
+  // true once after every new connection, e.g. to resend what wasn't acknowledged
+  bool takeReconnected();
+
+  const Stats &stats() const { return counters; }
+
+private:
+  enum class State : uint8_t
+  {
+    idle,
+    connecting,
+    connected,
+  };
+
+  void retryLater(uint32_t now);
+
+  AsyncMqttClient &client;
+  Backoff backoff;
+  State state = State::idle;
+  uint32_t attemptStart = 0;
+  uint32_t retryAt = 0;
+  bool reconnected = false;
+  std::atomic<bool> connectedEvent{false};
+  std::atomic<bool> disconnectedEvent{false};
+  Stats counters = {};
+};
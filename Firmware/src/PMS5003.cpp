@@ -0,0 +1,101 @@
+#include "PMS5003.h"
+
+const static uint8_t commandChangeMode = 0xE1;
+const static uint8_t commandRead = 0xE2;
+const static uint8_t commandSleep = 0xE4;
+
+PMS5003::Status PMS5003::begin(SerialTransport *transport, uint32_t timeout)
+{
+  this->transport = transport;
+  parser.reset();
+  // after power up the sensor is in active mode, but it may have been left passive
+  setMode(PmsMode::active);
+  return waitForFrame(timeout);
+}
+
+void PMS5003::setMode(PmsMode mode)
+{
+  sendCommand(commandChangeMode, (uint16_t)mode);
+}
+
+void PMS5003::sleep()
+{
+  sendCommand(commandSleep, 0);
+}
+
+void PMS5003::wake()
+{
+  sendCommand(commandSleep, 1);
+}
+
+uint8_t PMS5003::poll()
+{
+  uint8_t frames = 0;
+  uint8_t buffer[PmsFrameParser::frameSize];
+  size_t count;
+  while ((count = transport->read(buffer, sizeof(buffer))) > 0)
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      if (parser.feed(buffer[i]))
+      {
+        averager.add(parser.result());
+        frames++;
+      }
+    }
+  }
+  return frames;
+}
+
+PMS5003::Status PMS5003::getReading(PMSResult *result, uint32_t timeout)
+{
+  // drop stale frames, the answer to this request is wanted
+  poll();
+  PMSResult stale;
+  averager.take(stale);
+  sendCommand(commandRead, 0);
+  if (waitForFrame(timeout) != readSuccess)
+  {
+    return readTimeout;
+  }
+  averager.take(*result);
+  return readSuccess;
+}
+
+uint16_t PMS5003::takeAverage(PMSResult &result)
+{
+  poll();
+  uint16_t frames = averager.take(result);
+  if (frames == 0)
+  {
+    result = parser.result();
+  }
+  return frames;
+}
+
+void PMS5003::sendCommand(uint8_t command, uint16_t data)
+{
+  uint8_t frame[7] = {0x42, 0x4D, command, (uint8_t)(data >> 8), (uint8_t)data};
+  uint16_t sum = 0;
+  for (uint8_t i = 0; i < 5; i++)
+  {
+    sum += frame[i];
+  }
+  frame[5] = sum >> 8;
+  frame[6] = sum;
+  transport->write(frame, sizeof(frame));
+}
+
+PMS5003::Status PMS5003::waitForFrame(uint32_t timeout)
+{
+  uint32_t start = millis();
+  while (millis() - start < timeout)
+  {
+    if (poll() > 0)
+    {
+      return readSuccess;
+    }
+    delay(10);
+  }
+  return readTimeout;
+}
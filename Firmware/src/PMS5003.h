@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "PmsFrameParser.h"
+#include "SerialTransport.h"
+
+enum class PmsMode : uint8_t
+{
+  passive = 0,
+  active = 1,
+};
+
+// Driver for the Plantower PMS5003. Bytes are only ever taken from what the
+// transport already buffered, parsing happens in PmsFrameParser.
+// In active mode the sensor streams a frame about every second; poll() often
+// enough to keep the serial buffer from overflowing and takeAverage() once per
+// sample period to report the mean of all frames since the last call.
+class PMS5003
+{
+public:
+  enum Status : uint8_t
+  {
+    readSuccess,
+    readTimeout,
+  };
+
+  // waits for the first valid frame to make sure the sensor is there
+  Status begin(SerialTransport *transport, uint32_t timeout = 3000);
+  void setMode(PmsMode mode);
+  void sleep();
+  void wake();
+
+  // parses whatever arrived, returns the number of completed data frames
+  uint8_t poll();
+  // passive mode: requests one frame and waits for it
+  Status getReading(PMSResult *result, uint32_t timeout = 1500);
+  // writes the mean of the frames since the last call, the last frame if there were none
+  uint16_t takeAverage(PMSResult &result);
+
+  const PmsFrameParser::Stats &stats() const { return parser.stats(); }
+
+private:
+  void sendCommand(uint8_t command, uint16_t data);
+  Status waitForFrame(uint32_t timeout);
+
+  SerialTransport *transport = nullptr;
+  PmsFrameParser parser;
+  PmsAverager averager;
+};
@@ -0,0 +1,493 @@
+#include "ParticleChart.h"
+
+#define VALUE_FONT &Orbitron_Light_24
+
+static const uint8_t paddingL = 25;
+static const uint8_t paddingR = 10;
+static const uint8_t paddingT = 35;
+static const uint8_t paddingB = 20;
+
+// widest screen the dirty column map is sized for
+static const int16_t maxWidth = 320;
+
+// the hour tier leaves out its oldest slot
+const ParticleChart::Tier ParticleChart::tiers[tierCount] = {
+    {HistoryTier::hour, ParticleHistory::hourSlots, 0, 0, hourColumns},
+    {HistoryTier::minute, ParticleHistory::minuteSlots, ParticleHistory::hourSlots, hourColumns, ParticleHistory::minuteSlots},
+};
+
+static void markColumn(uint8_t *dirty, int16_t x)
+{
+  if (x >= 0 && x < maxWidth)
+  {
+    dirty[x / 8] |= 1 << (x % 8);
+  }
+}
+
+static const uint16_t backgroundColor = 0x10A3;
+static const uint16_t seriesColors[] = {0x854E, 0xDDAA, 0x865A};
+static const char *seriesLabels[] = {"1.0", "2.5", "10"};
+
+static const uint16_t pmWarnThreshold = 10;
+static const uint16_t pmDangerThreshold = 25;
+
+static uint16_t textColorValue(uint16_t value)
+{
+  if (value >= pmDangerThreshold)
+  {
+    return TFT_RED;
+  }
+  else if (value >= pmWarnThreshold)
+  {
+    return TFT_YELLOW;
+  }
+  else
+  {
+    return TFT_GREEN;
+  }
+}
+
+ParticleChart::ParticleChart(TFT_eSPI &canvas, const ParticleHistory &pm010, const ParticleHistory &pm025, const ParticleHistory &pm100)
+    : canvas(&canvas), histories{&pm010, &pm025, &pm100}
+{
+  memset(drawnPoints, 0, sizeof(drawnPoints));
+  memset(drawnValues, 0, sizeof(drawnValues));
+  memset(drawnRects, 0, sizeof(drawnRects));
+  dirtyTop = 0;
+  dirtyBottom = -1;
+}
+
+void ParticleChart::setCanvas(TFT_eSPI &canvas, TFT_eSprite *frame)
+{
+  this->canvas = &canvas;
+  this->frame = frame;
+  valid = false;
+}
+
+bool ParticleChart::dirtyRows(int16_t &top, int16_t &bottom) const
+{
+  top = dirtyTop;
+  bottom = dirtyBottom;
+  return dirtyBottom >= dirtyTop;
+}
+
+void ParticleChart::markRows(int16_t top, int16_t bottom)
+{
+  dirtyTop = top < dirtyTop ? top : dirtyTop;
+  dirtyBottom = bottom > dirtyBottom ? bottom : dirtyBottom;
+}
+
+void ParticleChart::render()
+{
+  uint32_t renderStart = micros();
+  dirtyTop = INT16_MAX;
+  dirtyBottom = -1;
+  renderStats.dirtyColumns = 0;
+  renderStats.scrolledColumns = 0;
+  renderStats.dirtyHeaders = 0;
+  renderStats.plotRedrawn = false;
+  renderStats.fullRedraw = !valid;
+
+  const uint32_t maxParticleVal = histories[0]->getMaxValue() + histories[1]->getMaxValue() + histories[2]->getMaxValue();
+  const uint32_t minParticleVal = histories[0]->getMinValue() + histories[1]->getMinValue() + histories[2]->getMinValue();
+  const uint32_t graphLowerBound = (minParticleVal / 10) * 10;
+  const uint32_t graphUpperBound = ((maxParticleVal / 10) + 1) * 10;
+  bool boundsMoved = graphLowerBound != lowerBound || graphUpperBound != upperBound;
+  lowerBound = graphLowerBound;
+  upperBound = graphUpperBound;
+
+  // all three histories are updated together, their rings move in step
+  uint16_t heads[tierCount];
+  for (uint8_t tier = 0; tier < tierCount; tier++)
+  {
+    heads[tier] = histories[0]->newestSlot(tiers[tier].tier);
+  }
+  int16_t points[seriesCount][slotCount];
+  computePoints(heads, points);
+
+  if (!valid)
+  {
+    canvas->fillScreen(backgroundColor);
+    markRows(0, canvas->height() - 1);
+
+    // the time axis never changes, only draw it with the full screen
+    const uint8_t hourBarWidth = (canvas->width() - 60 - (paddingL + paddingR)) / (ParticleHistory::hourSlots);
+    canvas->setTextFont(2);
+    canvas->setTextColor(TFT_DARKGREY, backgroundColor);
+    canvas->setTextDatum(TC_DATUM);
+    for (uint8_t lx = 0; lx <= ParticleHistory::hourSlots / 6; lx++)
+    {
+      auto legendX = paddingL + ((lx)*hourBarWidth * 6);
+      auto timeOffset = ParticleHistory::hourSlots - (6 * lx) + 1;
+      String label = String("-") + String(timeOffset) + "h";
+      canvas->drawString(label, legendX, (canvas->height() - paddingB) + 2);
+    }
+  }
+
+  if (!valid || boundsMoved)
+  {
+    memcpy(drawnPoints, points, sizeof(points));
+    memcpy(drawnHeads, heads, sizeof(heads));
+    renderPlot();
+    renderStats.plotRedrawn = true;
+  }
+  else
+  {
+    uint8_t dirty[maxWidth / 8] = {0};
+    for (uint8_t tier = 0; tier < tierCount; tier++)
+    {
+      uint16_t shift = (heads[tier] + tiers[tier].slots - drawnHeads[tier]) % tiers[tier].slots;
+      if (shift > 0)
+      {
+        scrollTier(tier, shift, dirty);
+      }
+      drawnHeads[tier] = heads[tier];
+    }
+
+    // the points already on screen moved with the scroll, only slots with new data are drawn,
+    // a point covers three pixel columns, so do its neighbours
+    for (uint8_t tier = 0; tier < tierCount; tier++)
+    {
+      for (uint16_t slot = 0; slot < tiers[tier].slots; slot++)
+      {
+        bool changed = false;
+        for (uint8_t series = 0; series < seriesCount; series++)
+        {
+          changed |= points[series][tiers[tier].firstSlot + slot] != drawnPoints[series][tiers[tier].firstSlot + slot];
+        }
+        int16_t column = columnOf(tier, slot, heads[tier]);
+        if (!changed || column < 0)
+        {
+          continue;
+        }
+        for (int16_t x = columnX(column) - 1; x <= columnX(column) + 1; x++)
+        {
+          markColumn(dirty, x);
+        }
+      }
+    }
+
+    memcpy(drawnPoints, points, sizeof(points));
+    for (int16_t x = 0; x < canvas->width() && x < maxWidth; x++)
+    {
+      if (dirty[x / 8] & (1 << (x % 8)))
+      {
+        renderColumnStrip(x);
+        renderStats.dirtyColumns++;
+      }
+    }
+  }
+
+  renderHeaders(!valid);
+  valid = true;
+
+  renderStats.frames++;
+  renderStats.lastMicros = micros() - renderStart;
+  if (renderStats.lastMicros > renderStats.maxMicros)
+  {
+    renderStats.maxMicros = renderStats.lastMicros;
+  }
+}
+
+void ParticleChart::computePoints(const uint16_t (&heads)[tierCount], int16_t (&points)[seriesCount][slotCount]) const
+{
+  const int16_t yMax = canvas->height();
+  const float unit = (canvas->height() - (paddingT + paddingB)) / ((float)upperBound - lowerBound);
+
+  for (uint8_t tier = 0; tier < tierCount; tier++)
+  {
+    for (uint16_t slot = 0; slot < tiers[tier].slots; slot++)
+    {
+      uint16_t age = (heads[tier] + tiers[tier].slots - slot) % tiers[tier].slots;
+      for (uint8_t series = 0; series < seriesCount; series++)
+      {
+        const ParticleHistory::Bucket &bucket = histories[series]->at(tiers[tier].tier, age);
+        int16_t &point = points[series][tiers[tier].firstSlot + slot];
+        // slots without data yet are left empty
+        if (bucket.count == 0)
+        {
+          point = noPoint;
+          continue;
+        }
+        point = yMax - (int16_t)(paddingB + (bucket.mean - lowerBound) * unit);
+      }
+    }
+  }
+}
+
+// every slot of the tier got older by shift, so its points move left on the screen.
+// In a frame buffer the pixels are moved, what remains to draw is the newest columns,
+// the oldest ones where the slots that dropped out leave a rest and the grid lines
+// that moved along. Drawing on the panel directly, the whole tier is drawn again.
+void ParticleChart::scrollTier(uint8_t tier, uint16_t shift, uint8_t *dirty)
+{
+  const Tier &layout = tiers[tier];
+  const int16_t left = columnX(layout.firstColumn) - 1;
+  const int16_t right = columnX(layout.firstColumn + layout.columns - 1) + 1;
+  if (!frame || shift >= layout.columns)
+  {
+    for (int16_t x = left; x <= right; x++)
+    {
+      markColumn(dirty, x);
+    }
+    return;
+  }
+
+  const int16_t chartHeight = canvas->height() - (paddingT + paddingB);
+  const int16_t distance = columnX(layout.firstColumn + shift) - columnX(layout.firstColumn);
+  frame->setScrollRect(left, paddingT - 1, right - left + 1, chartHeight + 3, backgroundColor);
+  frame->scroll(-distance, 0);
+  markRows(paddingT - 1, paddingT + chartHeight + 1);
+  renderStats.scrolledColumns += right - left + 1 - distance;
+
+  for (int16_t x = left; x <= left + distance + 1; x++)
+  {
+    markColumn(dirty, x);
+  }
+  for (int16_t x = right - distance - 1; x <= right; x++)
+  {
+    markColumn(dirty, x);
+  }
+  const uint8_t hourBarWidth = (canvas->width() - 60 - (paddingL + paddingR)) / (ParticleHistory::hourSlots);
+  for (uint8_t lx = 0; lx <= ParticleHistory::hourSlots / 6; lx++)
+  {
+    int16_t gridX = paddingL + lx * hourBarWidth * 6;
+    if (gridX >= left && gridX <= right)
+    {
+      markColumn(dirty, gridX);
+    }
+    if (gridX - distance >= left && gridX <= right)
+    {
+      markColumn(dirty, gridX - distance);
+    }
+  }
+}
+
+// the point of a screen column as it was drawn last
+int16_t ParticleChart::pointAt(uint8_t series, uint8_t column) const
+{
+  uint8_t tier = column < hourColumns ? 0 : 1;
+  const Tier &layout = tiers[tier];
+  uint16_t age = layout.firstColumn + layout.columns - 1 - column;
+  uint16_t slot = (drawnHeads[tier] + layout.slots - age) % layout.slots;
+  return drawnPoints[series][layout.firstSlot + slot];
+}
+
+// -1 for slots too old for the chart
+int16_t ParticleChart::columnOf(uint8_t tier, uint16_t slot, uint16_t head) const
+{
+  const Tier &layout = tiers[tier];
+  uint16_t age = (head + layout.slots - slot) % layout.slots;
+  if (age >= layout.columns)
+  {
+    return -1;
+  }
+  return layout.firstColumn + layout.columns - 1 - age;
+}
+
+// grid, value axis and all points, used whenever the scale changes
+void ParticleChart::renderPlot()
+{
+  const int16_t chartHeight = canvas->height() - (paddingT + paddingB);
+  const uint8_t hourBarWidth = (canvas->width() - 60 - (paddingL + paddingR)) / (ParticleHistory::hourSlots);
+
+  // points reach one pixel over the grid on both ends
+  canvas->fillRect(0, paddingT - 1, canvas->width(), chartHeight + 3, backgroundColor);
+  markRows(paddingT - 1, paddingT + chartHeight + 1);
+
+  // draw a grid line dividing 6 hour steps
+  for (uint8_t lx = 0; lx <= ParticleHistory::hourSlots / 6; lx++)
+  {
+    auto legendX = paddingL + ((lx)*hourBarWidth * 6);
+    canvas->drawLine(legendX, paddingT, legendX, canvas->height() - paddingB, TFT_DARKGREY);
+  }
+
+  //draw horizontal grid lines to divide the chart in 5 spaces
+  canvas->setTextFont(2);
+  canvas->setTextColor(TFT_DARKGREY, backgroundColor);
+  canvas->setTextDatum(MR_DATUM);
+  for (uint8_t ly = 0; ly < 5; ly++)
+  {
+    auto lineY = paddingT + (chartHeight / 5) * ly;
+    canvas->drawLine(paddingL, lineY, canvas->width() - paddingR, lineY, TFT_DARKGREY);
+    uint16_t value = (((upperBound - lowerBound) / 5) * (5 - ly)) + lowerBound;
+    canvas->drawString(String(value), paddingL - 2, lineY + 5);
+  }
+
+  for (uint8_t column = 0; column < columnCount; column++)
+  {
+    for (uint8_t series = 0; series < seriesCount; series++)
+    {
+      int16_t point = pointAt(series, column);
+      if (point != noPoint)
+      {
+        canvas->fillCircle(columnX(column), point, 1, seriesColors[series]);
+      }
+    }
+  }
+}
+
+// redraws a single pixel column of the plot, clipped so neighbours stay untouched
+void ParticleChart::renderColumnStrip(int16_t x)
+{
+  const int16_t chartHeight = canvas->height() - (paddingT + paddingB);
+  const uint8_t hourBarWidth = (canvas->width() - 60 - (paddingL + paddingR)) / (ParticleHistory::hourSlots);
+
+  canvas->setViewport(x, paddingT - 1, 1, chartHeight + 3, false);
+  canvas->fillRect(x, paddingT - 1, 1, chartHeight + 3, backgroundColor);
+  markRows(paddingT - 1, paddingT + chartHeight + 1);
+
+  for (uint8_t lx = 0; lx <= ParticleHistory::hourSlots / 6; lx++)
+  {
+    if (paddingL + ((lx)*hourBarWidth * 6) == x)
+    {
+      canvas->drawLine(x, paddingT, x, canvas->height() - paddingB, TFT_DARKGREY);
+    }
+  }
+  if (x >= paddingL && x <= canvas->width() - paddingR)
+  {
+    for (uint8_t ly = 0; ly < 5; ly++)
+    {
+      canvas->drawPixel(x, paddingT + (chartHeight / 5) * ly, TFT_DARKGREY);
+    }
+  }
+
+  for (uint8_t column = 0; column < columnCount; column++)
+  {
+    if (abs(columnX(column) - x) > 1)
+    {
+      continue;
+    }
+    for (uint8_t series = 0; series < seriesCount; series++)
+    {
+      int16_t point = pointAt(series, column);
+      if (point != noPoint)
+      {
+        canvas->fillCircle(columnX(column), point, 1, seriesColors[series]);
+      }
+    }
+  }
+
+  canvas->resetViewport();
+}
+
+void ParticleChart::renderHeaders(bool force)
+{
+  char values[seriesCount][8];
+  bool dirty[seriesCount];
+  Rect rects[seriesCount];
+  for (uint8_t i = 0; i < seriesCount; i++)
+  {
+    utoa(histories[i]->lastValue(), values[i], 10);
+    dirty[i] = force || strcmp(values[i], drawnValues[i]) != 0;
+    rects[i] = headerRect(i, values[i]);
+  }
+
+  // clearing a value can cut into a neighbour that moved close to it
+  for (uint8_t pass = 0; pass < seriesCount; pass++)
+  {
+    for (uint8_t i = 0; i < seriesCount; i++)
+    {
+      for (uint8_t j = 0; j < seriesCount; j++)
+      {
+        if (!dirty[i] || dirty[j])
+        {
+          continue;
+        }
+        int16_t left = drawnRects[i].left < rects[i].left ? drawnRects[i].left : rects[i].left;
+        int16_t right = drawnRects[i].right > rects[i].right ? drawnRects[i].right : rects[i].right;
+        if (left <= drawnRects[j].right && right >= drawnRects[j].left)
+        {
+          dirty[j] = true;
+        }
+      }
+    }
+  }
+
+  for (uint8_t i = 0; i < seriesCount; i++)
+  {
+    if (dirty[i] && !force)
+    {
+      canvas->fillRect(drawnRects[i].left, 0, drawnRects[i].right - drawnRects[i].left + 1, paddingT - 1, backgroundColor);
+    }
+  }
+  for (uint8_t i = 0; i < seriesCount; i++)
+  {
+    if (dirty[i])
+    {
+      drawHeader(i, values[i]);
+      strcpy(drawnValues[i], values[i]);
+      drawnRects[i] = rects[i];
+      renderStats.dirtyHeaders++;
+      markRows(0, paddingT - 1);
+    }
+  }
+}
+
+// PM 1.0 sits on the left, 2.5 in the center and 10 on the right
+ParticleChart::Rect ParticleChart::headerRect(uint8_t index, const char *value)
+{
+  canvas->setFreeFont(VALUE_FONT);
+  int16_t valueWidth = canvas->textWidth(value);
+  int16_t labelX = 13;
+  if (index == 1)
+  {
+    labelX = (canvas->width() - (valueWidth + 30)) / 2;
+  }
+  else if (index == 2)
+  {
+    labelX = canvas->width() - (valueWidth + 30);
+  }
+
+  Rect rect;
+  rect.left = labelX > 13 ? labelX - 13 : 0;
+  rect.right = index == 0 ? labelX + 17 + valueWidth : labelX + 30 + valueWidth / 2;
+  if (rect.right >= canvas->width())
+  {
+    rect.right = canvas->width() - 1;
+  }
+  return rect;
+}
+
+void ParticleChart::drawHeader(uint8_t index, const char *value)
+{
+  canvas->setFreeFont(VALUE_FONT);
+  int16_t valueWidth = canvas->textWidth(value);
+
+  canvas->setTextFont(2);
+  canvas->setTextDatum(TC_DATUM);
+  canvas->setTextColor(seriesColors[index], backgroundColor);
+  int16_t labelX = 13;
+  if (index == 1)
+  {
+    labelX = (canvas->width() - (valueWidth + 30)) / 2;
+  }
+  else if (index == 2)
+  {
+    labelX = canvas->width() - (valueWidth + 30);
+  }
+  canvas->drawString("PM", labelX, 0);
+  canvas->drawString(seriesLabels[index], labelX, canvas->fontHeight());
+
+  canvas->setFreeFont(VALUE_FONT);
+  canvas->setTextColor(textColorValue(histories[index]->lastValue()), backgroundColor);
+  if (index == 0)
+  {
+    canvas->setTextDatum(TL_DATUM);
+    canvas->drawString(value, 30, 1);
+  }
+  else
+  {
+    canvas->drawString(value, labelX + 30, 1);
+  }
+}
+
+int16_t ParticleChart::columnX(uint8_t column) const
+{
+  const uint8_t hourBarWidth = (canvas->width() - 60 - (paddingL + paddingR)) / (ParticleHistory::hourSlots);
+  if (column < hourColumns)
+  {
+    return paddingL + column * hourBarWidth;
+  }
+  return paddingL + hourColumns * hourBarWidth + (column - hourColumns);
+}
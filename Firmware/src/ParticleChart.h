@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Display.h"
+#include "TieredHistory.h"
+
+typedef TieredHistory<uint16_t> ParticleHistory;
+
+// Draws the PM header values and the 24h particle chart.
+// The chart remembers what is on screen and only redraws what changed:
+// pixel columns whose points moved, header values whose text changed and
+// the plot with its axis labels when the bounds move. Anything else that
+// draws over the screen has to call invalidate(). The rows touched by the
+// last frame are reported so an off-screen canvas can push just those.
+// Points are remembered per ring slot of the history, so a new minute only
+// changes one slot. On a frame buffer the plot is scrolled by the age
+// of the slots and just the newest and oldest columns are drawn again.
+class ParticleChart
+{
+public:
+  struct Stats
+  {
+    uint32_t frames;
+    uint32_t lastMicros;
+    uint32_t maxMicros;
+    uint16_t dirtyColumns;
+    // pixel columns that were moved in the frame buffer instead
+    uint16_t scrolledColumns;
+    uint8_t dirtyHeaders;
+    bool plotRedrawn;
+    bool fullRedraw;
+  };
+
+  ParticleChart(TFT_eSPI &canvas, const ParticleHistory &pm010, const ParticleHistory &pm025, const ParticleHistory &pm100);
+
+  void render();
+  void invalidate() { valid = false; }
+  // a frame to scroll in, the canvas itself if it is a sprite
+  void setCanvas(TFT_eSPI &canvas, TFT_eSprite *frame = nullptr);
+  // false if the last frame didn't change anything
+  bool dirtyRows(int16_t &top, int16_t &bottom) const;
+  const Stats &stats() const { return renderStats; }
+
+private:
+  const static uint8_t seriesCount = 3;
+  const static uint8_t hourColumns = ParticleHistory::hourSlots - 1;
+  const static uint8_t columnCount = hourColumns + ParticleHistory::minuteSlots;
+  // the hour slots come first
+  const static uint8_t slotCount = ParticleHistory::hourSlots + ParticleHistory::minuteSlots;
+  const static uint8_t tierCount = 2;
+  const static int16_t noPoint = -1;
+
+  struct Tier
+  {
+    HistoryTier tier;
+    uint16_t slots;
+    uint8_t firstSlot;
+    uint8_t firstColumn;
+    uint8_t columns;
+  };
+  static const Tier tiers[tierCount];
+
+  struct Rect
+  {
+    int16_t left;
+    int16_t right;
+  };
+
+  void computePoints(const uint16_t (&heads)[tierCount], int16_t (&points)[seriesCount][slotCount]) const;
+  void scrollTier(uint8_t tier, uint16_t shift, uint8_t *dirty);
+  int16_t pointAt(uint8_t series, uint8_t column) const;
+  int16_t columnOf(uint8_t tier, uint16_t slot, uint16_t head) const;
+  void renderPlot();
+  void renderColumnStrip(int16_t x);
+  void renderHeaders(bool force);
+  Rect headerRect(uint8_t index, const char *value);
+  void drawHeader(uint8_t index, const char *value);
+  int16_t columnX(uint8_t column) const;
+  void markRows(int16_t top, int16_t bottom);
+
+  TFT_eSPI *canvas;
+  TFT_eSprite *frame = nullptr;
+  const ParticleHistory *histories[seriesCount];
+
+  bool valid = false;
+  uint32_t lowerBound = 0;
+  uint32_t upperBound = 0;
+  int16_t drawnPoints[seriesCount][slotCount];
+  uint16_t drawnHeads[tierCount] = {};
+  char drawnValues[seriesCount][8];
+  Rect drawnRects[seriesCount];
+  int16_t dirtyTop;
+  int16_t dirtyBottom;
+
+  Stats renderStats = {};
+};
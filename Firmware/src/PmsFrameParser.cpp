@@ -0,0 +1,134 @@
+#include "PmsFrameParser.h"
+
+#include <string.h>
+
+const static uint8_t startByte1 = 0x42;
+const static uint8_t startByte2 = 0x4D;
+
+bool PmsFrameParser::feed(uint8_t byte)
+{
+  return accept(byte);
+}
+
+size_t PmsFrameParser::feed(const uint8_t *bytes, size_t length)
+{
+  size_t frames = 0;
+  for (size_t i = 0; i < length; i++)
+  {
+    if (accept(bytes[i]))
+    {
+      frames++;
+    }
+  }
+  return frames;
+}
+
+bool PmsFrameParser::accept(uint8_t byte)
+{
+  if (position == 0 && byte != startByte1)
+  {
+    counters.skippedBytes++;
+    return false;
+  }
+  if (position == 1 && byte != startByte2)
+  {
+    counters.skippedBytes++;
+    // a repeated start byte may be the real start
+    position = byte == startByte1 ? 1 : 0;
+    return false;
+  }
+
+  frame[position++] = byte;
+
+  if (position == 4)
+  {
+    uint16_t length = (frame[2] << 8) | frame[3];
+    // every frame carries at least the checksum and fits into the buffer
+    if (length < 2 || length > frameSize - 4)
+    {
+      resync();
+    }
+    return false;
+  }
+  if (position > 4 && position == 4 + ((frame[2] << 8) | frame[3]))
+  {
+    return complete();
+  }
+  return false;
+}
+
+bool PmsFrameParser::complete()
+{
+  uint8_t checksumAt = position - 2;
+  uint16_t sum = 0;
+  for (uint8_t i = 0; i < checksumAt; i++)
+  {
+    sum += frame[i];
+  }
+  uint16_t checksum = (frame[checksumAt] << 8) | frame[checksumAt + 1];
+  if (sum != checksum)
+  {
+    counters.checksumErrors++;
+    resync();
+    return false;
+  }
+
+  uint16_t length = (frame[2] << 8) | frame[3];
+  position = 0;
+  if (length != dataLength)
+  {
+    counters.otherFrames++;
+    return false;
+  }
+
+  uint16_t *fields = (uint16_t *)&lastResult;
+  for (uint8_t i = 0; i < sizeof(PMSResult) / sizeof(uint16_t); i++)
+  {
+    fields[i] = (frame[4 + 2 * i] << 8) | frame[5 + 2 * i];
+  }
+  counters.frames++;
+  return true;
+}
+
+void PmsFrameParser::resync()
+{
+  // replay everything after the rejected start byte, no data frame can
+  // complete in there because it is shorter than a full frame
+  uint8_t pending[frameSize];
+  uint8_t pendingLength = position - 1;
+  memcpy(pending, frame + 1, pendingLength);
+  position = 0;
+  counters.skippedBytes++;
+  for (uint8_t i = 0; i < pendingLength; i++)
+  {
+    accept(pending[i]);
+  }
+}
+
+void PmsAverager::add(const PMSResult &result)
+{
+  const uint16_t *fields = (const uint16_t *)&result;
+  for (uint8_t i = 0; i < fieldCount; i++)
+  {
+    sums[i] += fields[i];
+  }
+  frames++;
+}
+
+uint16_t PmsAverager::take(PMSResult &result)
+{
+  uint16_t averaged = frames;
+  if (averaged == 0)
+  {
+    return 0;
+  }
+
+  uint16_t *fields = (uint16_t *)&result;
+  for (uint8_t i = 0; i < fieldCount; i++)
+  {
+    fields[i] = (sums[i] + averaged / 2) / averaged;
+    sums[i] = 0;
+  }
+  frames = 0;
+  return averaged;
+}
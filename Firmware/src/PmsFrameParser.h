@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// one data frame of the PMS5003, concentrations in ug/m3 and particles per 0.1l air
+struct PMSResult
+{
+  uint16_t pm10_standard;
+  uint16_t pm25_standard;
+  uint16_t pm100_standard;
+  uint16_t pm10_env;
+  uint16_t pm25_env;
+  uint16_t pm100_env;
+  uint16_t particles_03um;
+  uint16_t particles_05um;
+  uint16_t particles_10um;
+  uint16_t particles_25um;
+  uint16_t particles_50um;
+  uint16_t particles_100um;
+};
+
+// Incremental parser for the PMS5003 protocol, fed one byte at a time so it can
+// run from a UART interrupt or a polling task without ever blocking.
+// Frames are 0x42 0x4D, a 16 bit length, the payload and a 16 bit sum of all
+// bytes before it. On a bad length or checksum the parser restarts at the next
+// 0x42 inside the rejected bytes, so a frame that starts within garbage is not lost.
+// Only depends on the standard integer types, recorded streams can be fed on the host.
+class PmsFrameParser
+{
+public:
+  const static uint8_t frameSize = 32;
+  const static uint8_t dataLength = 28;
+
+  struct Stats
+  {
+    uint32_t frames;
+    uint32_t checksumErrors;
+    uint32_t skippedBytes;
+    // valid frames that are not data frames, e.g. the answers to commands
+    uint32_t otherFrames;
+  };
+
+  // returns true when the byte completed a valid data frame
+  bool feed(uint8_t byte);
+  // feeds a whole buffer, returns the number of data frames completed
+  size_t feed(const uint8_t *bytes, size_t length);
+  void reset() { position = 0; }
+
+  const PMSResult &result() const { return lastResult; }
+  const Stats &stats() const { return counters; }
+
+private:
+  bool accept(uint8_t byte);
+  bool complete();
+  void resync();
+
+  uint8_t frame[frameSize];
+  uint8_t position = 0;
+  PMSResult lastResult = {};
+  Stats counters = {};
+};
+
+// Sums up frames so a whole sample period can be reported as one reading.
+class PmsAverager
+{
+public:
+  void add(const PMSResult &result);
+  uint16_t count() const { return frames; }
+  // writes the rounded mean and starts over, leaves result alone if nothing was added
+  uint16_t take(PMSResult &result);
+
+private:
+  const static uint8_t fieldCount = sizeof(PMSResult) / sizeof(uint16_t);
+
+  uint32_t sums[fieldCount] = {};
+  uint16_t frames = 0;
+};
@@ -0,0 +1,133 @@
+#include "RtcState.h"
+
+#include <string.h>
+
+#include "Crc32.h"
+
+void RtcState::reset()
+{
+  memset(static_cast<void *>(this), 0, sizeof(RtcState));
+  header = magic;
+  layoutVersion = version;
+  layoutSize = sizeof(RtcState);
+  phase = Phase::warmUp;
+}
+
+bool RtcState::valid() const
+{
+  return header == magic && layoutVersion == version && layoutSize == sizeof(RtcState) &&
+         checksum == computeChecksum();
+}
+
+void RtcState::seal()
+{
+  checksum = computeChecksum();
+}
+
+void RtcState::pushPending(const Sample &sample)
+{
+  if (pendingCount == pendingCapacity)
+  {
+    popPending(1);
+    droppedSamples++;
+  }
+  pending[(pendingHead + pendingCount) % pendingCapacity] = sample;
+  pendingCount++;
+}
+
+const Sample &RtcState::pendingAt(uint8_t index) const
+{
+  return pending[(pendingHead + index) % pendingCapacity];
+}
+
+Sample &RtcState::pendingAt(uint8_t index)
+{
+  return pending[(pendingHead + index) % pendingCapacity];
+}
+
+void RtcState::popPending(uint8_t count)
+{
+  count = count < pendingCount ? count : pendingCount;
+  pendingHead = (pendingHead + count) % pendingCapacity;
+  pendingCount -= count;
+}
+
+void RtcState::addMinute(const HistoryRecord &record)
+{
+  minuteHead = (minuteHead + 1) % minuteCapacity;
+  minutes[minuteHead] = record;
+  if (minuteCount < minuteCapacity)
+  {
+    minuteCount++;
+  }
+  if (unreplayedMinutes < UINT16_MAX)
+  {
+    unreplayedMinutes++;
+  }
+
+  if (++minutesInHour < minuteCapacity)
+  {
+    return;
+  }
+  minutesInHour = 0;
+
+  uint32_t co2 = 0, pm010 = 0, pm025 = 0, pm100 = 0;
+  float lux = 0;
+  for (uint8_t age = 0; age < minuteCapacity; age++)
+  {
+    const HistoryRecord &minute = minuteAt(age);
+    co2 += minute.co2;
+    pm010 += minute.pm010;
+    pm025 += minute.pm025;
+    pm100 += minute.pm100;
+    lux += minute.lux;
+  }
+  hourHead = (hourHead + 1) % hourCapacity;
+  hours[hourHead] = {(uint16_t)(co2 / minuteCapacity), (uint16_t)(pm010 / minuteCapacity),
+                     (uint16_t)(pm025 / minuteCapacity), (uint16_t)(pm100 / minuteCapacity), lux / minuteCapacity};
+  if (hourCount < hourCapacity)
+  {
+    hourCount++;
+  }
+}
+
+const HistoryRecord &RtcState::minuteAt(uint8_t age) const
+{
+  return minutes[(minuteHead + minuteCapacity - age) % minuteCapacity];
+}
+
+const HistoryRecord &RtcState::hourAt(uint8_t age) const
+{
+  return hours[(hourHead + hourCapacity - age) % hourCapacity];
+}
+
+void RtcState::replayHistory(void (*replay)(const HistoryRecord &record))
+{
+  for (uint16_t age = unreplayedMinutes; age-- > 0;)
+  {
+    if (age < minuteCount)
+    {
+      replay(minuteAt(age));
+      continue;
+    }
+    // the open hour is still in the minutes, so every older minute is in a completed hour
+    uint16_t hour = (age - minutesInHour) / minuteCapacity;
+    if (hour < hourCount)
+    {
+      replay(hourAt(hour));
+    }
+  }
+  unreplayedMinutes = 0;
+}
+
+void RtcState::recordWakeToPublish(uint32_t micros)
+{
+  lastWakeToPublish = micros;
+  maxWakeToPublish = micros > maxWakeToPublish ? micros : maxWakeToPublish;
+  publishes++;
+}
+
+uint32_t RtcState::computeChecksum() const
+{
+  return crc32(this, offsetof(RtcState, checksum));
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+
+#include "HistoryRecord.h"
+#include "Sample.h"
+#include "TimeSync.h"
+
+// Everything the battery build keeps across deep sleep in RTC slow memory:
+// the config needed to publish without mounting the file system, a WiFi hint
+// for a fast reconnect, the clock, the samples that weren't published yet and a
+// compact history of the last hour by minute and the last day by hour.
+// The header is checked on every wake up, a different version or size, e.g.
+// after flashing a new layout, or a bad checksum starts over with a full boot.
+// Only depends on the standard headers so the layout can be checked on the host.
+struct RtcState
+{
+  const static uint32_t magic = 0x41544D53;
+  const static uint16_t version = 3;
+
+  const static uint8_t pendingCapacity = 24;
+  const static uint8_t minuteCapacity = 60;
+  const static uint8_t hourCapacity = 24;
+
+  enum class Phase : uint8_t
+  {
+    // the PMS sleeps, the next wake up starts its fan
+    warmUp,
+    // the PMS had time to settle, the next wake up samples and publishes
+    sample,
+  };
+
+  // has to stay the first member so any layout can be recognised
+  uint32_t header;
+  uint16_t layoutVersion;
+  uint16_t layoutSize;
+
+  uint32_t wakeups;
+  Phase phase;
+
+  char room[40];
+  char mqttServer[40];
+  char ssid[33];
+  char passphrase[65];
+  uint8_t bssid[6];
+  // 0 while there is no hint from a previous connect
+  uint8_t channel;
+
+  // the monotonic clock runs on across deep sleep: its reading at this wake up,
+  // with the SNTP mapping, boot id and epoch of the full boot it started at
+  uint64_t clockBase;
+  TimeSync::State timeSync;
+  uint32_t bootId;
+  uint64_t bootEpochMicros;
+
+  Sample pending[pendingCapacity];
+  uint8_t pendingHead;
+  uint8_t pendingCount;
+  uint32_t droppedSamples;
+
+  HistoryRecord minutes[minuteCapacity];
+  HistoryRecord hours[hourCapacity];
+  uint8_t minuteHead;
+  uint8_t minuteCount;
+  uint8_t hourHead;
+  uint8_t hourCount;
+  // minutes added since the last hour was rolled up
+  uint8_t minutesInHour;
+  // minutes added since the history was last replayed on a full boot
+  uint16_t unreplayedMinutes;
+
+  // from the wake up until the broker took the last sample, in microseconds
+  uint32_t lastWakeToPublish;
+  uint32_t maxWakeToPublish;
+  uint32_t publishes;
+
+  uint32_t checksum;
+
+  void reset();
+  bool valid() const;
+  // updates the checksum, call right before going to sleep
+  void seal();
+
+  // the oldest sample is dropped when the queue is full
+  void pushPending(const Sample &sample);
+  const Sample &pendingAt(uint8_t index) const;
+  Sample &pendingAt(uint8_t index);
+  void popPending(uint8_t count);
+
+  void addMinute(const HistoryRecord &record);
+  // age 0 is the newest
+  const HistoryRecord &minuteAt(uint8_t age) const;
+  const HistoryRecord &hourAt(uint8_t age) const;
+  // hands every minute since the last replay to replay, oldest first. Minutes that were
+  // rolled up already come as the mean of their hour, those older than the hours are gone
+  void replayHistory(void (*replay)(const HistoryRecord &record));
+
+  void recordWakeToPublish(uint32_t micros);
+
+private:
+  uint32_t computeChecksum() const;
+};
+
+static_assert(std::is_trivially_copyable<RtcState>::value, "RTC state is kept byte by byte");
+// a constructor would run on every wake up and overwrite what the last one kept
+static_assert(std::is_trivially_default_constructible<RtcState>::value, "RTC state must not be initialised at boot");
+static_assert(offsetof(RtcState, header) == 0 && offsetof(RtcState, layoutVersion) == 4 && offsetof(RtcState, layoutSize) == 6,
+              "the header has to stay where every version expects it");
+// RTC slow memory has 8kB, ULP code and the core need some of it
+static_assert(sizeof(RtcState) <= 4096, "RTC state doesn't fit into RTC slow memory");
+static_assert(sizeof(RtcState) < UINT16_MAX, "layoutSize can't hold the size of the state");
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "PmsFrameParser.h"
+
+// one complete reading of all sensors, passed by value through the task queues
+struct Sample
+{
+  PMSResult pms;
+  int co2;
+  int co2Temp;
+  float lux;
+  // unix time of the acquisition in milliseconds, 0 if the clock was not set yet
+  uint64_t timestamp;
+  // monotonic time of the acquisition and the boot it belongs to,
+  // a sample taken before the first SNTP update is stamped once the time is known
+  uint64_t acquiredAt;
+  uint32_t bootId;
+};
@@ -0,0 +1,292 @@
+#include "SampleCodec.h"
+
+#include <string.h>
+
+// CBOR major types and the additional information used here
+const static uint8_t majorUnsigned = 0;
+const static uint8_t majorNegative = 1;
+const static uint8_t majorText = 3;
+const static uint8_t majorArray = 4;
+const static uint8_t majorSimple = 7;
+const static uint8_t indefiniteArray = 0x9F;
+const static uint8_t breakCode = 0xFF;
+const static uint8_t float32Code = 0xFA;
+const static uint8_t float64Code = 0xFB;
+
+SampleEncoder::SampleEncoder(uint8_t *buffer, size_t capacity)
+    : buffer(buffer), capacity(capacity)
+{
+}
+
+bool SampleEncoder::begin(const char *room)
+{
+  used = 0;
+  records = 0;
+  overflow = false;
+
+  size_t roomLength = strlen(room);
+  // header, the record array, the version and the break at the end
+  if (capacity < 1 + 1 + 9 + roomLength + 1)
+  {
+    overflow = true;
+    return false;
+  }
+  buffer[used++] = indefiniteArray;
+  appendHead(majorUnsigned, schemaVersion);
+  appendHead(majorText, roomLength);
+  memcpy(buffer + used, room, roomLength);
+  used += roomLength;
+  return true;
+}
+
+bool SampleEncoder::add(const Sample &sample)
+{
+  // one byte stays free for the break
+  if (overflow || capacity - used < maxRecordSize + 1)
+  {
+    return false;
+  }
+
+  const PMSResult &pms = sample.pms;
+  appendHead(majorArray, recordFields);
+  appendInt(sample.timestamp);
+  appendInt(sample.co2);
+  appendInt(sample.co2Temp);
+  appendFloat(sample.lux);
+  const uint16_t values[] = {pms.pm10_standard, pms.pm25_standard, pms.pm100_standard,
+                             pms.pm10_env, pms.pm25_env, pms.pm100_env,
+                             pms.particles_03um, pms.particles_05um, pms.particles_10um,
+                             pms.particles_25um, pms.particles_50um, pms.particles_100um};
+  for (uint16_t value : values)
+  {
+    appendHead(majorUnsigned, value);
+  }
+  records++;
+  return true;
+}
+
+bool SampleEncoder::finish()
+{
+  if (overflow || used >= capacity)
+  {
+    return false;
+  }
+  buffer[used++] = breakCode;
+  return true;
+}
+
+// the shortest head for the value, big endian as CBOR wants it
+void SampleEncoder::appendHead(uint8_t major, uint64_t value)
+{
+  uint8_t type = major << 5;
+  uint8_t bytes;
+  if (value < 24)
+  {
+    buffer[used++] = type | value;
+    return;
+  }
+  else if (value <= UINT8_MAX)
+  {
+    buffer[used++] = type | 24;
+    bytes = 1;
+  }
+  else if (value <= UINT16_MAX)
+  {
+    buffer[used++] = type | 25;
+    bytes = 2;
+  }
+  else if (value <= UINT32_MAX)
+  {
+    buffer[used++] = type | 26;
+    bytes = 4;
+  }
+  else
+  {
+    buffer[used++] = type | 27;
+    bytes = 8;
+  }
+  for (int8_t i = bytes - 1; i >= 0; i--)
+  {
+    buffer[used++] = value >> (8 * i);
+  }
+}
+
+void SampleEncoder::appendInt(int64_t value)
+{
+  if (value < 0)
+  {
+    appendHead(majorNegative, -1 - value);
+  }
+  else
+  {
+    appendHead(majorUnsigned, value);
+  }
+}
+
+void SampleEncoder::appendFloat(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  buffer[used++] = float32Code;
+  for (int8_t i = 3; i >= 0; i--)
+  {
+    buffer[used++] = bits >> (8 * i);
+  }
+}
+
+bool SampleDecoder::begin(char *room, size_t roomSize)
+{
+  pos = 0;
+  error = true;
+
+  uint8_t major;
+  uint64_t value;
+  if (length == 0 || data[pos++] != indefiniteArray)
+  {
+    return false;
+  }
+  if (!readHead(major, value) || major != majorUnsigned || value != SampleEncoder::schemaVersion)
+  {
+    return false;
+  }
+  if (!readHead(major, value) || major != majorText || value > length - pos)
+  {
+    return false;
+  }
+
+  size_t copied = value < roomSize ? value : roomSize - 1;
+  memcpy(room, data + pos, copied);
+  room[copied] = '\0';
+  pos += value;
+  error = false;
+  return true;
+}
+
+bool SampleDecoder::next(Sample &sample)
+{
+  if (error || pos >= length)
+  {
+    error = true;
+    return false;
+  }
+  if (data[pos] == breakCode)
+  {
+    pos++;
+    return false;
+  }
+
+  uint8_t major;
+  uint64_t count;
+  error = true;
+  if (!readHead(major, count) || major != majorArray || count != SampleEncoder::recordFields)
+  {
+    return false;
+  }
+
+  sample = {};
+  int64_t timestamp, co2, co2Temp;
+  if (!readInt(timestamp) || !readInt(co2) || !readInt(co2Temp) || !readFloat(sample.lux) || timestamp < 0)
+  {
+    return false;
+  }
+  sample.timestamp = timestamp;
+  sample.co2 = co2;
+  sample.co2Temp = co2Temp;
+
+  uint16_t *values[] = {&sample.pms.pm10_standard, &sample.pms.pm25_standard, &sample.pms.pm100_standard,
+                        &sample.pms.pm10_env, &sample.pms.pm25_env, &sample.pms.pm100_env,
+                        &sample.pms.particles_03um, &sample.pms.particles_05um, &sample.pms.particles_10um,
+                        &sample.pms.particles_25um, &sample.pms.particles_50um, &sample.pms.particles_100um};
+  for (uint16_t *value : values)
+  {
+    int64_t read;
+    if (!readInt(read) || read < 0 || read > UINT16_MAX)
+    {
+      return false;
+    }
+    *value = read;
+  }
+  error = false;
+  return true;
+}
+
+bool SampleDecoder::readHead(uint8_t &major, uint64_t &value)
+{
+  if (pos >= length)
+  {
+    return false;
+  }
+  uint8_t initial = data[pos++];
+  major = initial >> 5;
+  uint8_t info = initial & 0x1F;
+  if (info < 24)
+  {
+    value = info;
+    return true;
+  }
+  if (info > 27)
+  {
+    return false;
+  }
+
+  uint8_t bytes = 1 << (info - 24);
+  if (bytes > length - pos)
+  {
+    return false;
+  }
+  value = 0;
+  for (uint8_t i = 0; i < bytes; i++)
+  {
+    value = (value << 8) | data[pos++];
+  }
+  return true;
+}
+
+bool SampleDecoder::readInt(int64_t &value)
+{
+  uint8_t major;
+  uint64_t raw;
+  if (!readHead(major, raw) || raw > INT64_MAX)
+  {
+    return false;
+  }
+  if (major == majorUnsigned)
+  {
+    value = raw;
+    return true;
+  }
+  if (major == majorNegative)
+  {
+    value = -1 - (int64_t)raw;
+    return true;
+  }
+  return false;
+}
+
+// float32 as written by the encoder, float64 from other producers
+bool SampleDecoder::readFloat(float &value)
+{
+  uint8_t major;
+  uint64_t bits;
+  if (pos >= length || (data[pos] != float32Code && data[pos] != float64Code))
+  {
+    return false;
+  }
+  bool single = data[pos] == float32Code;
+  if (!readHead(major, bits) || major != majorSimple)
+  {
+    return false;
+  }
+  if (single)
+  {
+    uint32_t bits32 = bits;
+    memcpy(&value, &bits32, sizeof(value));
+  }
+  else
+  {
+    double wide;
+    memcpy(&wide, &bits, sizeof(wide));
+    value = wide;
+  }
+  return true;
+}
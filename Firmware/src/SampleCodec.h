@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Sample.h"
+
+// Compact binary alternative to the influx lines: one CBOR message per batch,
+// an indefinite array of the schema version, the room and one record per sample
+//   [_ 1, "room", [timestamp, co2, co2Temp, lux, pm10_standard, ... particles_100um], ...]
+// The record is a definite array of 16 items in the order of Sample and PMSResult,
+// the timestamp is unix time in milliseconds or 0, lux a single precision float.
+// A new field or a changed meaning needs a new schema version.
+// Only depends on the standard headers, the decoder is meant for the host as well.
+class SampleEncoder
+{
+public:
+  const static uint8_t schemaVersion = 1;
+  const static uint8_t recordFields = 16;
+  // the largest encoding of a record
+  const static size_t maxRecordSize = 1 + 9 + 3 * 5 + 12 * 3;
+
+  SampleEncoder(uint8_t *buffer, size_t capacity);
+
+  // starts a new message, false if even the header doesn't fit
+  bool begin(const char *room);
+  // false if the record doesn't fit, the message stays valid without it
+  bool add(const Sample &sample);
+  // closes the array, the message is complete and length() bytes long
+  bool finish();
+
+  const uint8_t *data() const { return buffer; }
+  size_t length() const { return used; }
+  size_t capacityLeft() const { return capacity - used; }
+  uint16_t recordCount() const { return records; }
+
+private:
+  void appendHead(uint8_t major, uint64_t value);
+  void appendInt(int64_t value);
+  void appendFloat(float value);
+
+  uint8_t *buffer;
+  size_t capacity;
+  size_t used = 0;
+  uint16_t records = 0;
+  bool overflow = false;
+};
+
+class SampleDecoder
+{
+public:
+  SampleDecoder(const uint8_t *data, size_t length) : data(data), length(length) {}
+
+  // reads the header, false if the message is malformed or of another schema version
+  bool begin(char *room, size_t roomSize);
+  // the next record, false at the end of the message or on an error
+  bool next(Sample &sample);
+  // the message ended in the middle or held something unexpected
+  bool failed() const { return error; }
+
+private:
+  bool readHead(uint8_t &major, uint64_t &value);
+  bool readInt(int64_t &value);
+  bool readFloat(float &value);
+
+  const uint8_t *data;
+  size_t length;
+  size_t pos = 0;
+  bool error = false;
+};
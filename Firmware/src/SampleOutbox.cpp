@@ -0,0 +1,228 @@
+#include "SampleOutbox.h"
+
+static const char *outboxDirectory = "/outbox";
+// segments written by a firmware with a different Sample layout are discarded
+static const uint32_t segmentMagic = 0x584F4200 | (sizeof(Sample) & 0xFF);
+
+void SampleOutbox::begin(fs::FS *fs)
+{
+  this->fs = fs;
+  if (!fs)
+  {
+    return;
+  }
+  if (!fs->exists(outboxDirectory))
+  {
+    fs->mkdir(outboxDirectory);
+  }
+
+  // pick up whatever wasn't delivered before the restart
+  bool found = false;
+  File dir = fs->open(outboxDirectory);
+  for (File file = dir.openNextFile(); file; file = dir.openNextFile())
+  {
+    const char *name = strrchr(file.name(), '/');
+    uint32_t segment = strtoul(name ? name + 1 : file.name(), nullptr, 10);
+    if (!found || segment < firstSegment)
+    {
+      firstSegment = segment;
+    }
+    if (!found || segment > lastSegment)
+    {
+      lastSegment = segment;
+    }
+    found = true;
+  }
+
+  flashCount = 0;
+  if (!found)
+  {
+    return;
+  }
+  for (uint32_t segment = firstSegment; segment <= lastSegment; segment++)
+  {
+    flashCount += segmentSamples(segment);
+  }
+  firstSegmentRead = 0;
+  firstSegmentSize = segmentSamples(firstSegment);
+  skipEmptySegments();
+  if (flashCount > 0)
+  {
+    Serial.printf("outbox holds %u undelivered samples\n", flashCount);
+  }
+}
+
+void SampleOutbox::push(const Sample &sample)
+{
+  if (ramCount == ramCapacity)
+  {
+    spill();
+  }
+  if (ramCount == ramCapacity)
+  {
+    // nowhere to spill to, drop the oldest
+    ramHead = (ramHead + 1) % ramCapacity;
+    ramCount--;
+    droppedSamples++;
+    // with samples in flash the oldest in RAM are in the middle of the queue
+    if (flashCount == 0)
+    {
+      frontDrops++;
+    }
+  }
+  ram[(ramHead + ramCount) % ramCapacity] = sample;
+  ramCount++;
+}
+
+uint16_t SampleOutbox::available() const
+{
+  if (flashCount > 0)
+  {
+    return firstSegmentSize - firstSegmentRead;
+  }
+  return ramCount;
+}
+
+bool SampleOutbox::peek(uint16_t index, Sample &sample)
+{
+  if (index >= available())
+  {
+    return false;
+  }
+  if (flashCount == 0)
+  {
+    sample = ram[(ramHead + index) % ramCapacity];
+    return true;
+  }
+
+  char path[32];
+  segmentPath(path, sizeof(path), firstSegment);
+  File file = fs->open(path, "r");
+  if (!file || !file.seek(sizeof(segmentMagic) + (firstSegmentRead + index) * sizeof(Sample)))
+  {
+    return false;
+  }
+  return file.read((uint8_t *)&sample, sizeof(Sample)) == sizeof(Sample);
+}
+
+void SampleOutbox::pop(uint16_t count)
+{
+  while (count > 0 && size() > 0)
+  {
+    uint16_t step = min(count, available());
+    count -= step;
+    if (flashCount == 0)
+    {
+      ramHead = (ramHead + step) % ramCapacity;
+      ramCount -= step;
+      continue;
+    }
+
+    firstSegmentRead += step;
+    flashCount -= step;
+    if (firstSegmentRead >= firstSegmentSize)
+    {
+      removeFirstSegment();
+    }
+  }
+}
+
+void SampleOutbox::removeFirstSegment()
+{
+  char path[32];
+  segmentPath(path, sizeof(path), firstSegment);
+  fs->remove(path);
+  firstSegment++;
+  firstSegmentRead = 0;
+  firstSegmentSize = flashCount > 0 ? segmentSamples(firstSegment) : 0;
+  skipEmptySegments();
+}
+
+// segments that went missing or were discarded must not block the queue
+void SampleOutbox::skipEmptySegments()
+{
+  while (flashCount > 0 && firstSegmentSize == 0 && firstSegment < lastSegment)
+  {
+    firstSegment++;
+    firstSegmentSize = segmentSamples(firstSegment);
+  }
+}
+
+uint32_t SampleOutbox::size() const
+{
+  return flashCount + ramCount;
+}
+
+void SampleOutbox::spill()
+{
+  if (!fs)
+  {
+    return;
+  }
+  if (flashCount > 0 && lastSegment - firstSegment + 1 >= maxSegments)
+  {
+    dropOldestSegment();
+  }
+
+  uint32_t segment = lastSegment + 1;
+  char path[32];
+  segmentPath(path, sizeof(path), segment);
+  File file = fs->open(path, "w");
+  if (!file)
+  {
+    Serial.println("failed to spill outbox to flash");
+    return;
+  }
+  file.write((const uint8_t *)&segmentMagic, sizeof(segmentMagic));
+  for (uint8_t i = 0; i < ramCount; i++)
+  {
+    file.write((const uint8_t *)&ram[(ramHead + i) % ramCapacity], sizeof(Sample));
+  }
+  file.close();
+
+  if (flashCount == 0)
+  {
+    firstSegment = segment;
+    firstSegmentRead = 0;
+    firstSegmentSize = ramCount;
+  }
+  lastSegment = segment;
+  flashCount += ramCount;
+  ramHead = 0;
+  ramCount = 0;
+}
+
+void SampleOutbox::dropOldestSegment()
+{
+  uint16_t remaining = firstSegmentSize - firstSegmentRead;
+  Serial.printf("outbox full, dropping %u samples\n", remaining);
+  droppedSamples += remaining;
+  frontDrops += remaining;
+  flashCount -= remaining;
+  removeFirstSegment();
+}
+
+void SampleOutbox::segmentPath(char *dst, size_t len, uint32_t segment) const
+{
+  snprintf(dst, len, "%s/%u.bin", outboxDirectory, segment);
+}
+
+uint16_t SampleOutbox::segmentSamples(uint32_t segment) const
+{
+  char path[32];
+  segmentPath(path, sizeof(path), segment);
+  File file = fs->open(path, "r");
+  if (!file)
+  {
+    return 0;
+  }
+
+  uint32_t magic = 0;
+  if (file.read((uint8_t *)&magic, sizeof(magic)) != sizeof(magic) || magic != segmentMagic)
+  {
+    file.close();
+    fs->remove(path);
+    return 0;
+  }
+  return (file.size() - sizeof(magic)) / sizeof(Sample);
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "Sample.h"
+
+// Bounded store-and-forward queue for samples that haven't been delivered yet.
+// New samples go into a RAM ring; when it is full the whole ring is spilled
+// into a segment file, so flash only sees one write per ramCapacity samples.
+// The oldest samples always come out first, from flash before RAM. When the
+// flash budget is used up the oldest segment is dropped.
+class SampleOutbox
+{
+public:
+  const static uint8_t ramCapacity = 32;
+  const static uint8_t maxSegments = 48;
+
+  // without a file system the outbox only buffers in RAM
+  void begin(fs::FS *fs);
+
+  void push(const Sample &sample);
+  // samples at the front that can be read with peek() without crossing a segment
+  uint16_t available() const;
+  bool peek(uint16_t index, Sample &sample);
+  void pop(uint16_t count);
+
+  uint32_t size() const;
+  bool empty() const { return size() == 0; }
+  uint32_t dropped() const { return droppedSamples; }
+  // the part of dropped() that came off the front, where the samples in flight are
+  uint32_t droppedAtFront() const { return frontDrops; }
+
+private:
+  void spill();
+  void dropOldestSegment();
+  void removeFirstSegment();
+  void skipEmptySegments();
+  void segmentPath(char *dst, size_t len, uint32_t segment) const;
+  uint16_t segmentSamples(uint32_t segment) const;
+
+  fs::FS *fs = nullptr;
+
+  Sample ram[ramCapacity];
+  uint8_t ramHead = 0;
+  uint8_t ramCount = 0;
+
+  // segments firstSegment..lastSegment exist while flashCount > 0
+  uint32_t firstSegment = 0;
+  uint32_t lastSegment = 0;
+  uint16_t firstSegmentRead = 0;
+  uint16_t firstSegmentSize = 0;
+  uint32_t flashCount = 0;
+
+  uint32_t droppedSamples = 0;
+  uint32_t frontDrops = 0;
+};
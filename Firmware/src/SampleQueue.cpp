@@ -0,0 +1,26 @@
+#include "SampleQueue.h"
+
+void SampleQueue::begin()
+{
+  queue = xQueueCreate(length, sizeof(Sample));
+}
+
+void SampleQueue::push(const Sample &sample)
+{
+  if (xQueueSend(queue, &sample, 0) == pdTRUE)
+  {
+    return;
+  }
+  // the consumer may have taken one in between, then nothing is lost
+  Sample oldest;
+  if (xQueueReceive(queue, &oldest, 0) == pdTRUE)
+  {
+    droppedSamples++;
+  }
+  xQueueSend(queue, &sample, 0);
+}
+
+bool SampleQueue::pop(Sample &sample, TickType_t timeout)
+{
+  return xQueueReceive(queue, &sample, timeout) == pdTRUE;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#include "Sample.h"
+
+// Hands the samples of the scheduler task to one consumer task. The producer
+// never waits: when the consumer stalls, the oldest sample is dropped for the
+// new one, so a slow display or network can't delay the sensor readings.
+class SampleQueue
+{
+public:
+  explicit SampleQueue(uint8_t length) : length(length) {}
+
+  void begin();
+  // only called from one task
+  void push(const Sample &sample);
+  // waits up to timeout ticks for the oldest sample
+  bool pop(Sample &sample, TickType_t timeout);
+
+  uint32_t dropped() const { return droppedSamples; }
+
+private:
+  uint8_t length;
+  QueueHandle_t queue = nullptr;
+  uint32_t droppedSamples = 0;
+};
@@ -0,0 +1,65 @@
+#include "Scheduler.h"
+
+int8_t Scheduler::addJob(const char *name, uint32_t period, uint32_t deadline, JobFunction function, uint32_t firstDelay)
+{
+  if (count >= maxJobs || period == 0)
+  {
+    return -1;
+  }
+  jobs[count] = {name, period, deadline, function, clock() + firstDelay, {}};
+  return count++;
+}
+
+uint32_t Scheduler::runDue()
+{
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if ((int32_t)(clock() - jobs[i].nextDue) >= 0)
+    {
+      run(jobs[i]);
+    }
+  }
+
+  uint32_t now = clock();
+  uint32_t wait = UINT32_MAX;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    int32_t left = (int32_t)(jobs[i].nextDue - now);
+    if (left <= 0)
+    {
+      return 0;
+    }
+    if ((uint32_t)left < wait)
+    {
+      wait = left;
+    }
+  }
+  return wait;
+}
+
+void Scheduler::run(Job &job)
+{
+  uint32_t start = clock();
+  job.function();
+  uint32_t end = clock();
+
+  JobStats &stats = job.stats;
+  stats.runs++;
+  uint32_t latency = start - job.nextDue;
+  uint32_t runtime = end - start;
+  stats.maxLatency = latency > stats.maxLatency ? latency : stats.maxLatency;
+  stats.maxRuntime = runtime > stats.maxRuntime ? runtime : stats.maxRuntime;
+  if (end - job.nextDue > job.deadline)
+  {
+    stats.overruns++;
+  }
+
+  // stay on the original grid, but never run a job twice in a row to catch up
+  job.nextDue += job.period;
+  if ((int32_t)(end - job.nextDue) >= 0)
+  {
+    uint32_t missed = (end - job.nextDue) / job.period + 1;
+    stats.skipped += missed;
+    job.nextDue += missed * job.period;
+  }
+}
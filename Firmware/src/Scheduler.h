@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+
+// Cooperative scheduler for periodic jobs. runDue() runs every job that is due
+// and tells the caller how long it may sleep until the next one, so the CPU
+// idles in between instead of polling.
+// A job has to be finished deadline ms after it became due, otherwise it counts
+// as an overrun. Periods that were missed completely are skipped, not caught up.
+// Time comes from the clock passed in, all arithmetic survives the millis() wrap.
+class Scheduler
+{
+public:
+  typedef void (*JobFunction)();
+  typedef uint32_t (*Clock)();
+
+  const static uint8_t maxJobs = 10;
+
+  struct JobStats
+  {
+    uint32_t runs;
+    uint32_t overruns;
+    uint32_t skipped;
+    // how late the job started and how long it ran, in clock units
+    uint32_t maxLatency;
+    uint32_t maxRuntime;
+  };
+
+  Scheduler(Clock clock) : clock(clock) {}
+
+  // returns the job index or -1 if there is no room left
+  int8_t addJob(const char *name, uint32_t period, uint32_t deadline, JobFunction function, uint32_t firstDelay = 0);
+  uint32_t runDue();
+
+  uint8_t jobCount() const { return count; }
+  const char *jobName(uint8_t job) const { return jobs[job].name; }
+  const JobStats &jobStats(uint8_t job) const { return jobs[job].stats; }
+
+private:
+  struct Job
+  {
+    const char *name;
+    uint32_t period;
+    uint32_t deadline;
+    JobFunction function;
+    uint32_t nextDue;
+    JobStats stats;
+  };
+
+  void run(Job &job);
+
+  Clock clock;
+  Job jobs[maxJobs];
+  uint8_t count = 0;
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Byte pipe to a sensor. The drivers only talk to this interface, so the
+// same driver runs on a hardware UART on the device and on a recording in the host tests.
+class SerialTransport
+{
+public:
+  struct Stats
+  {
+    uint32_t bytesRead;
+    uint32_t bytesWritten;
+    // CPU time spent inside the transport calls
+    uint32_t busyMicros;
+  };
+
+  virtual ~SerialTransport() {}
+
+  virtual void begin(uint32_t baud) = 0;
+  virtual size_t available() = 0;
+  // never waits, returns what was already received up to length
+  virtual size_t read(uint8_t *buffer, size_t length) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t length) = 0;
+
+  const Stats &stats() const { return counters; }
+
+protected:
+  Stats counters = {};
+};
@@ -0,0 +1,57 @@
+#include "SleepPlanner.h"
+
+void SleepPlanner::plan(uint32_t now)
+{
+  if (started)
+  {
+    counters.awakeMillis += now - lastWake;
+  }
+  started = true;
+  windowStart = now;
+  hasDeadline = false;
+}
+
+void SleepPlanner::wakeAt(uint32_t due)
+{
+  if (!hasDeadline || (int32_t)(due - earliest) < 0)
+  {
+    earliest = due;
+    hasDeadline = true;
+  }
+}
+
+void SleepPlanner::wakeIn(uint32_t delay)
+{
+  if (delay != never)
+  {
+    wakeAt(windowStart + delay);
+  }
+}
+
+uint32_t SleepPlanner::window() const
+{
+  if (!hasDeadline)
+  {
+    return never;
+  }
+  int32_t left = (int32_t)(earliest - windowStart);
+  return left > 0 ? left : 0;
+}
+
+void SleepPlanner::woke(uint32_t now)
+{
+  uint32_t idle = now - windowStart;
+  counters.idleMillis += idle;
+  counters.windows++;
+  if (idle < window())
+  {
+    counters.earlyWakeups++;
+  }
+  lastWake = now;
+}
+
+uint16_t SleepPlanner::idleShare() const
+{
+  uint64_t total = counters.awakeMillis + counters.idleMillis;
+  return total > 0 ? counters.idleMillis * 1000 / total : 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+// Works out how long a task may block so that it wakes exactly for the next
+// thing it has to do, e.g. a scheduled job or the MQTT keepalive, and accounts
+// how much of its time the task spent awake and how much blocked.
+// With automatic light sleep the chip sleeps whenever every task is blocked,
+// so the blocked time is what it can sleep at most.
+// Time is passed in, the class runs on the host with a fake clock.
+class SleepPlanner
+{
+public:
+  const static uint32_t never = UINT32_MAX;
+
+  struct Stats
+  {
+    uint64_t awakeMillis;
+    uint64_t idleMillis;
+    uint32_t windows;
+    // woken by an event before the window was over
+    uint32_t earlyWakeups;
+  };
+
+  // starts a new window at now, the time since the last wake up counts as awake
+  void plan(uint32_t now);
+  // the task has to be up again at due, the earliest deadline wins
+  void wakeAt(uint32_t due);
+  // same as wakeAt(), relative to the start of the window, never is ignored
+  void wakeIn(uint32_t delay);
+  // how long the task may block, 0 if a deadline already passed, never without one
+  uint32_t window() const;
+  void woke(uint32_t now);
+
+  const Stats &stats() const { return counters; }
+  // per mille of the time spent blocked
+  uint16_t idleShare() const;
+
+private:
+  uint32_t windowStart = 0;
+  uint32_t lastWake = 0;
+  uint32_t earliest = 0;
+  bool hasDeadline = false;
+  bool started = false;
+  Stats counters = {};
+};
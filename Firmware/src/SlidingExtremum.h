@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdint.h>
+
+// Minimum or maximum over the last Window pushed values.
+// Monotonic deque: values that can never become the extremum again are
+// dropped on push, so push is amortised O(1) and value() is O(1).
+template <typename T, uint16_t Window, bool Maximum>
+class SlidingExtremum
+{
+public:
+  void push(T value)
+  {
+    total++;
+    // forget the candidate that just left the window
+    if (count > 0 && (uint16_t)(total - entries[first].sequence) >= Window)
+    {
+      first = (first + 1) % Window;
+      count--;
+    }
+
+    while (count > 0 && !beats(entries[last()].value, value))
+    {
+      count--;
+    }
+
+    Entry &entry = entries[(first + count) % Window];
+    entry.sequence = total;
+    entry.value = value;
+    count++;
+  }
+
+  bool empty() const { return count == 0; }
+  T value() const { return count > 0 ? entries[first].value : T(); }
+
+private:
+  struct Entry
+  {
+    // wraps around, only differences below Window are ever compared
+    uint16_t sequence;
+    T value;
+  };
+
+  static bool beats(T candidate, T value)
+  {
+    return Maximum ? candidate > value : candidate < value;
+  }
+
+  uint16_t last() const { return (first + count - 1) % Window; }
+
+  Entry entries[Window];
+  uint16_t total = 0;
+  uint16_t first = 0;
+  uint16_t count = 0;
+};
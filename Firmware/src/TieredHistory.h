@@ -0,0 +1,229 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "SlidingExtremum.h"
+
+enum class HistoryTier : uint8_t
+{
+  minute,
+  hour,
+  day,
+  week
+};
+
+// aggregate of all measurements that fell into one slot of a tier
+template <typename T>
+struct HistoryBucket
+{
+  T min = 0;
+  T max = 0;
+  float mean = 0;
+  uint16_t count = 0;
+
+  void add(const HistoryBucket &other)
+  {
+    if (other.count == 0)
+    {
+      return;
+    }
+    if (count == 0)
+    {
+      *this = other;
+      return;
+    }
+    min = other.min < min ? other.min : min;
+    max = other.max > max ? other.max : max;
+    uint32_t total = (uint32_t)count + other.count;
+    mean = (mean * count + other.mean * other.count) / total;
+    count = total > UINT16_MAX ? UINT16_MAX : total;
+  }
+};
+
+// Keeps measurements at minute, hour, day and week resolution.
+// Every tier is a fixed ring buffer, the next coarser bucket is accumulated
+// while the finer one fills up, so adding a measurement is O(1) including
+// the roll-up. Age 0 always is the newest completed slot of a tier.
+template <typename T, uint16_t MinuteSlots = 60, uint16_t HourSlots = 24, uint16_t DaySlots = 35, uint16_t WeekSlots = 8>
+class TieredHistory
+{
+public:
+  typedef HistoryBucket<T> Bucket;
+
+  const static uint16_t minuteSlots = MinuteSlots;
+  const static uint16_t hourSlots = HourSlots;
+  const static uint16_t daySlots = DaySlots;
+  const static uint16_t weekSlots = WeekSlots;
+
+  void addMeasurement(T value)
+  {
+    Bucket bucket;
+    bucket.min = value;
+    bucket.max = value;
+    bucket.mean = value;
+    bucket.count = 1;
+
+    lastData = value;
+    minutes.push(bucket);
+    minuteLowest.push(value);
+    minuteHighest.push(value);
+
+    openHour.add(bucket);
+    if (++minutesInHour < 60)
+    {
+      return;
+    }
+    hours.push(openHour);
+    hourLowest.push(openHour.min);
+    hourHighest.push(openHour.max);
+    openDay.add(openHour);
+    openHour = Bucket();
+    minutesInHour = 0;
+
+    if (++hoursInDay < 24)
+    {
+      return;
+    }
+    days.push(openDay);
+    openWeek.add(openDay);
+    openDay = Bucket();
+    hoursInDay = 0;
+
+    if (++daysInWeek < 7)
+    {
+      return;
+    }
+    weeks.push(openWeek);
+    openWeek = Bucket();
+    daysInWeek = 0;
+  }
+
+  // returns an empty bucket (count 0) for slots that were never filled
+  const Bucket &at(HistoryTier tier, uint16_t age) const
+  {
+    switch (tier)
+    {
+    case HistoryTier::minute:
+      return minutes.at(age);
+    case HistoryTier::hour:
+      return hours.at(age);
+    case HistoryTier::day:
+      return days.at(age);
+    default:
+      return weeks.at(age);
+    }
+  }
+
+  uint16_t size(HistoryTier tier) const
+  {
+    switch (tier)
+    {
+    case HistoryTier::minute:
+      return minutes.count;
+    case HistoryTier::hour:
+      return hours.count;
+    case HistoryTier::day:
+      return days.count;
+    default:
+      return weeks.count;
+    }
+  }
+
+  // ring position of age 0, it moves on by one with every completed slot of the tier,
+  // so a slot keeps its position while its age grows
+  uint16_t newestSlot(HistoryTier tier) const
+  {
+    switch (tier)
+    {
+    case HistoryTier::minute:
+      return minutes.head;
+    case HistoryTier::hour:
+      return hours.head;
+    case HistoryTier::day:
+      return days.head;
+    default:
+      return weeks.head;
+    }
+  }
+
+  T lastValue() const { return lastData; }
+
+  // extremes over the minute and hour tier, which is what the chart shows.
+  // Both are tracked incrementally, so this is O(1) regardless of the tier sizes.
+  T getMinValue() const
+  {
+    return pick(minuteLowest, hourLowest, false);
+  }
+
+  T getMaxValue() const
+  {
+    return pick(minuteHighest, hourHighest, true);
+  }
+
+private:
+  template <uint16_t Slots>
+  struct Ring
+  {
+    Bucket slots[Slots];
+    uint16_t head = 0;
+    uint16_t count = 0;
+
+    void push(const Bucket &bucket)
+    {
+      head = (head + 1) % Slots;
+      slots[head] = bucket;
+      if (count < Slots)
+      {
+        count++;
+      }
+    }
+
+    const Bucket &at(uint16_t age) const
+    {
+      static const Bucket empty;
+      if (age >= count)
+      {
+        return empty;
+      }
+      return slots[(head + Slots - age) % Slots];
+    }
+  };
+
+  template <typename A, typename B>
+  T pick(const A &a, const B &b, bool maximum) const
+  {
+    if (a.empty() && b.empty())
+    {
+      return lastData;
+    }
+    if (a.empty())
+    {
+      return b.value();
+    }
+    if (b.empty())
+    {
+      return a.value();
+    }
+    return (maximum ? a.value() > b.value() : a.value() < b.value()) ? a.value() : b.value();
+  }
+
+  Ring<MinuteSlots> minutes;
+  Ring<HourSlots> hours;
+  Ring<DaySlots> days;
+  Ring<WeekSlots> weeks;
+
+  SlidingExtremum<T, MinuteSlots, false> minuteLowest;
+  SlidingExtremum<T, MinuteSlots, true> minuteHighest;
+  SlidingExtremum<T, HourSlots, false> hourLowest;
+  SlidingExtremum<T, HourSlots, true> hourHighest;
+
+  Bucket openHour;
+  Bucket openDay;
+  Bucket openWeek;
+  uint8_t minutesInHour = 0;
+  uint8_t hoursInDay = 0;
+  uint8_t daysInWeek = 0;
+
+  T lastData = 0;
+};
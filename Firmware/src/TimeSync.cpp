@@ -0,0 +1,71 @@
+#include "TimeSync.h"
+
+// a larger error means the clock was set, not corrected
+const static int64_t maxErrorMicros = 1000 * 1000;
+// shorter intervals are dominated by the network jitter of the SNTP reply
+const static uint64_t minDriftInterval = 60ULL * 1000 * 1000;
+// the crystal is specified well within this, anything beyond is a bad reference
+const static int64_t maxDriftPpb = 200 * 1000;
+
+void TimeSync::update(uint64_t monotonicMicros, uint64_t unixMicros)
+{
+  if (synced() && monotonicMicros > referenceMonotonic)
+  {
+    int64_t error = (int64_t)(unixMicros - toUnixMicros(monotonicMicros));
+    counters.lastErrorMicros = error;
+
+    uint64_t interval = monotonicMicros - referenceMonotonic;
+    if (error < -maxErrorMicros || error > maxErrorMicros)
+    {
+      counters.steps++;
+    }
+    else if (interval >= minDriftInterval)
+    {
+      // the drift over the whole interval, smoothed against the earlier estimate
+      int64_t elapsed = (int64_t)(unixMicros - referenceUnix) - (int64_t)interval;
+      int64_t measured = elapsed * 1000 * 1000 * 1000 / (int64_t)interval;
+      if (measured >= -maxDriftPpb && measured <= maxDriftPpb)
+      {
+        counters.driftPpb += (int32_t)(driftKnown ? (measured - counters.driftPpb) / 4 : measured - counters.driftPpb);
+        driftKnown = true;
+      }
+    }
+    else
+    {
+      // keep the older reference, it gives the longer baseline
+      counters.syncs++;
+      return;
+    }
+  }
+  else
+  {
+    counters.steps++;
+  }
+
+  referenceMonotonic = monotonicMicros;
+  referenceUnix = unixMicros;
+  counters.syncs++;
+}
+
+TimeSync::State TimeSync::save() const
+{
+  return {referenceMonotonic, referenceUnix, driftKnown, counters};
+}
+
+void TimeSync::restore(const State &state)
+{
+  referenceMonotonic = state.referenceMonotonic;
+  referenceUnix = state.referenceUnix;
+  driftKnown = state.driftKnown;
+  counters = state.counters;
+}
+
+uint64_t TimeSync::toUnixMicros(uint64_t monotonicMicros) const
+{
+  if (!synced())
+  {
+    return 0;
+  }
+  int64_t elapsed = (int64_t)(monotonicMicros - referenceMonotonic);
+  return referenceUnix + elapsed + elapsed * counters.driftPpb / (1000 * 1000 * 1000);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+// Maps the monotonic microsecond clock onto unix time. Every SNTP update is a
+// reference point, the rate of the monotonic clock against the time servers is
+// estimated from consecutive points, so the mapping stays close between updates.
+// Samples keep their monotonic acquisition time and can be stamped later,
+// the readings are passed in to keep it testable on the host.
+class TimeSync
+{
+public:
+  struct Stats
+  {
+    uint32_t syncs;
+    // SNTP updates that were too far off the mapping to estimate the drift, e.g. the first one
+    uint32_t steps;
+    // received minus mapped time at the last update
+    int64_t lastErrorMicros;
+    // how much faster the servers' clock runs than the monotonic one, in parts per billion
+    int32_t driftPpb;
+  };
+
+  // everything the mapping depends on, plain data so it can be kept in RTC memory
+  struct State
+  {
+    uint64_t referenceMonotonic;
+    uint64_t referenceUnix;
+    bool driftKnown;
+    Stats counters;
+  };
+
+  // the monotonic clock read when SNTP set the time to unixMicros
+  void update(uint64_t monotonicMicros, uint64_t unixMicros);
+  bool synced() const { return counters.syncs > 0; }
+  // unix time in microseconds at a monotonic reading, 0 as long as there was no update
+  uint64_t toUnixMicros(uint64_t monotonicMicros) const;
+
+  const Stats &stats() const { return counters; }
+
+  State save() const;
+  void restore(const State &state);
+
+private:
+  uint64_t referenceMonotonic = 0;
+  uint64_t referenceUnix = 0;
+  bool driftKnown = false;
+  Stats counters = {};
+};
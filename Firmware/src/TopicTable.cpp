@@ -0,0 +1,47 @@
+#include "TopicTable.h"
+
+#include <stdio.h>
+
+const static char *topicNames[TopicTable::topicCount] = {"co2", "pm10", "pm25", "pm100"};
+
+bool TopicTable::render(const char *prefix, const char *room)
+{
+  // whatever doesn't fit any more reads as an empty string, never as a stale one
+  for (uint8_t topic = 0; topic < topicCount; topic++)
+  {
+    offsets[topic] = arenaSize - 1;
+    summaryOffsets[topic] = arenaSize - 1;
+  }
+  clientIdOffset = arenaSize - 1;
+  arena[arenaSize - 1] = '\0';
+
+  uint16_t used = 0;
+  for (uint8_t topic = 0; topic < topicCount; topic++)
+  {
+    offsets[topic] = used;
+    if (!append(used, "%s/%s/%s", prefix, room, topicNames[topic]))
+    {
+      return false;
+    }
+    summaryOffsets[topic] = used;
+    if (!append(used, "%s/%s/%s/summary", prefix, room, topicNames[topic]))
+    {
+      return false;
+    }
+  }
+  clientIdOffset = used;
+  return append(used, "%s%s%s", "AtmoNode-", room, "");
+}
+
+bool TopicTable::append(uint16_t &offset, const char *format, const char *first, const char *second, const char *third)
+{
+  int length = snprintf(arena + offset, arenaSize - offset, format, first, second, third);
+  if (length < 0 || (size_t)length >= arenaSize - offset)
+  {
+    // leave every topic a valid, if truncated, string
+    arena[arenaSize - 1] = '\0';
+    return false;
+  }
+  offset += length + 1;
+  return true;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// All MQTT topics of the node, rendered once whenever the room changes into a
+// fixed arena, so publishing doesn't build a single String on the heap.
+class TopicTable
+{
+public:
+  enum Topic : uint8_t
+  {
+    co2,
+    pm10,
+    pm25,
+    pm100,
+    topicCount,
+  };
+
+  // prefix/room/name and prefix/room/name/summary for every topic and the client id,
+  // false if the room was too long: the one that didn't fit is truncated, the rest are empty
+  bool render(const char *prefix, const char *room);
+
+  const char *topic(Topic topic) const { return arena + offsets[topic]; }
+  // what was held back by the deadband before the last value on topic()
+  const char *summaryTopic(Topic topic) const { return arena + summaryOffsets[topic]; }
+  const char *clientId() const { return arena + clientIdOffset; }
+
+private:
+  // prefix and name are short, the room can have 39 characters
+  const static size_t arenaSize = 2 * topicCount * 64 + 64;
+
+  bool append(uint16_t &offset, const char *format, const char *first, const char *second, const char *third);
+
+  char arena[arenaSize] = "";
+  uint16_t offsets[topicCount] = {};
+  uint16_t summaryOffsets[topicCount] = {};
+  uint16_t clientIdOffset = 0;
+};
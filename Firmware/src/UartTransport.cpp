@@ -0,0 +1,83 @@
+#include "UartTransport.h"
+
+UartTransport::UartTransport(HardwareSerial &port, int8_t rxPin, int8_t txPin, size_t rxBufferSize)
+    : port(port), rxPin(rxPin), txPin(txPin), rxBufferSize(rxBufferSize)
+{
+}
+
+void UartTransport::begin(uint32_t baud)
+{
+  // the buffer is allocated when the driver is installed, so it has to be set first
+  port.setRxBufferSize(rxBufferSize);
+  port.begin(baud, SERIAL_8N1, rxPin, txPin);
+}
+
+size_t UartTransport::available()
+{
+  uint32_t start = micros();
+  int count = port.available();
+  counters.busyMicros += micros() - start;
+  return count > 0 ? count : 0;
+}
+
+size_t UartTransport::read(uint8_t *buffer, size_t length)
+{
+  uint32_t start = micros();
+  size_t count = 0;
+  while (count < length && port.available() > 0)
+  {
+    buffer[count++] = port.read();
+  }
+  counters.bytesRead += count;
+  counters.busyMicros += micros() - start;
+  return count;
+}
+
+size_t UartTransport::write(const uint8_t *buffer, size_t length)
+{
+  uint32_t start = micros();
+  size_t written = port.write(buffer, length);
+  counters.bytesWritten += written;
+  counters.busyMicros += micros() - start;
+  return written;
+}
+
+int TransportStream::available()
+{
+  return transport.available() + (peeked >= 0 ? 1 : 0);
+}
+
+int TransportStream::read()
+{
+  if (peeked >= 0)
+  {
+    uint8_t byte = peeked;
+    peeked = -1;
+    return byte;
+  }
+  uint8_t byte;
+  return transport.read(&byte, 1) == 1 ? byte : -1;
+}
+
+int TransportStream::peek()
+{
+  if (peeked < 0)
+  {
+    uint8_t byte;
+    if (transport.read(&byte, 1) == 1)
+    {
+      peeked = byte;
+    }
+  }
+  return peeked;
+}
+
+size_t TransportStream::write(uint8_t byte)
+{
+  return transport.write(&byte, 1);
+}
+
+size_t TransportStream::write(const uint8_t *buffer, size_t size)
+{
+  return transport.write(buffer, size);
+}
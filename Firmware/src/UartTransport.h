@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "SerialTransport.h"
+
+// ESP32 hardware UART. Reception runs in the UART FIFO and its driver interrupt
+// into an RX ring buffer, so unlike SoftwareSerial no CPU time goes into sampling
+// bits and interrupts stay enabled while a frame comes in.
+class UartTransport : public SerialTransport
+{
+public:
+  UartTransport(HardwareSerial &port, int8_t rxPin, int8_t txPin, size_t rxBufferSize = 256);
+
+  void begin(uint32_t baud) override;
+  size_t available() override;
+  size_t read(uint8_t *buffer, size_t length) override;
+  size_t write(const uint8_t *buffer, size_t length) override;
+
+private:
+  HardwareSerial &port;
+  int8_t rxPin;
+  int8_t txPin;
+  size_t rxBufferSize;
+};
+
+// Lets libraries that want an Arduino Stream, like the MH-Z19 one, use a transport.
+class TransportStream : public Stream
+{
+public:
+  TransportStream(SerialTransport &transport) : transport(transport) {}
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override {}
+  size_t write(uint8_t byte) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+
+private:
+  SerialTransport &transport;
+  int16_t peeked = -1;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+// Icon converted with Tools/create_565_array --format rle.
+// Every row is PackBits encoded on its own over 8 bit palette indices:
+// a control byte c < 128 is followed by c + 1 literal indices,
+// c >= 128 repeats the next index c - 126 times.
+typedef struct
+{
+  uint8_t width;
+  uint8_t height;
+  uint16_t paletteSize;
+  const uint16_t *palette;
+  const uint8_t *data;
+} CompressedIcon;
@@ -2,810 +2,177 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t barsIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x59C6,
-	0x779D, 0xF484, 0xB37C, 0xB37C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x9374, 0x9374, 0x9374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7274, 0x7274, 0x5274, 0x5274, 0xB47C, 0x569D,
-	0x39BE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x5DE7, 0x3595, 0x7374,
-	0x7274, 0x526C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0x1164,
-	0x326C, 0xF48C, 0x5DE7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1595, 0x5274, 0x526C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0x1164, 0xF48C, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x19BE, 0x5274, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0x1164, 0x18B6, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0xF48C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xB384, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x7374, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0x1164, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x1264, 0x526C, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6,
-	0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x7AC6, 0x326C, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x1164, 0x5274, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF16B, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x1264, 0x1164, 0x326C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD063, 0xB05B, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x1164, 0xF163, 0x316C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD063, 0x8F5B, 0xB05B,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F5B, 0x8F5B,
-	0xD05B, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F5B, 0x8F5B,
-	0xB05B, 0xD05B, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xD05B, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F5B, 0x8F5B,
-	0x905B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAF63, 0x8F5B, 0x8F5B,
-	0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xF163, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xF163, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x905B, 0xB05B, 0x7AC6, 0x1CDF, 0x1CDF, 0xFCDE, 0xFCDE, 0xFCDE,
-	0x1CDF, 0x1CDF, 0x1CDF, 0x1CDF, 0xF8B5, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x3DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C6, 0xB05B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F53, 0x3DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C6, 0x8F5B, 0xD05B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C6, 0x6F53, 0x8F5B, 0xD05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0xB05B,
-	0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAF63, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0xAF5B,
-	0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x6F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0xAF5B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x7AC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF, 0x1164, 0x1164,
-	0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x905B, 0x1164,
-	0xF163, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0xF163, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F5B, 0x8F5B,
-	0xF163, 0xD163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0xF163, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0xAF5B, 0xD163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0xD163, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F5B, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6E53, 0x8F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39C6, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x6F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0xAF63, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD15B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F53,
-	0x8F5B, 0x8F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x6F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xD15B, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD15B, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB05B, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD15B, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x4E53, 0x6F53,
-	0x8F5B, 0x6F53, 0xB05B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB05B, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD15B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x6F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x6F53, 0x8F5B,
-	0x8F53, 0x8F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DE7, 0x6F53, 0x8F53,
-	0x8F5B, 0x6F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAF5B, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xD05B, 0x59C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DE7, 0x6F53, 0x8F53,
-	0x8F5B, 0x8F53, 0xB063, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB063, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0x3CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F53, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xD05B, 0x559D, 0x39C6, 0x18BE, 0x18BE, 0x18BE,
-	0x18BE, 0x18BE, 0x18BE, 0x18BE, 0x39BE, 0xB7AD, 0x6F53, 0x8F53,
-	0x8F5B, 0x6F53, 0x8F5B, 0x39BE, 0x39BE, 0x38BE, 0x18BE, 0x18BE,
-	0x18BE, 0x18BE, 0x38BE, 0x39BE, 0x39BE, 0x8F5B, 0x8F53, 0x8F5B,
-	0x8F53, 0x6F53, 0xB7AD, 0x38BE, 0x18BE, 0x18BE, 0x18BE, 0x18BE,
-	0x18BE, 0x18BE, 0x18BE, 0x39BE, 0x1595, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xD05B, 0x8F5B, 0x2E53, 0x0D4B, 0xED4A, 0xED4A,
-	0xED4A, 0xED4A, 0xED4A, 0xED4A, 0x0D4B, 0x2E4B, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x6F53, 0x0D4B, 0x0D4B, 0xED4A, 0xED4A, 0xED4A,
-	0xED4A, 0xED4A, 0xED4A, 0x0D4B, 0x2D4B, 0x6F53, 0x8F53, 0x8F5B,
-	0x8F5B, 0x6F53, 0x2E4B, 0x0D4B, 0xED4A, 0xED4A, 0xED4A, 0xED4A,
-	0xED4A, 0xED4A, 0xED4A, 0x0D4B, 0x4E53, 0x8F53, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B, 0x8F5B, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x6E53, 0x6F53, 0x6F53, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F53, 0x6F53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x6F53, 0x8F53, 0x8F5B, 0x905B,
-	0x8F5B, 0x8F53, 0x6F53, 0x6F53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x6F53, 0x8F53, 0x8F53, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xD05B, 0xD05B, 0xB05B, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x8F53, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x8F53, 0x8F5B, 0x905B, 0xB05B,
-	0xB05B, 0x8F5B, 0x8F5B, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x8F53, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xD163, 0xB05B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F53, 0x8F5B, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x8F53, 0x8F53, 0x8F53, 0x8F53, 0x8F53,
-	0x8F53, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xD05B, 0xB05B, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x8F5B, 0x905B,
-	0x905B, 0xB05B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xD15B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x5274, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xD15B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0x3174, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0x55A5, 0xF163, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xB05B, 0x559D, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDBDE, 0x3174, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0x116C, 0xDBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x38C6, 0x116C, 0xD05B,
-	0xD163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xD15B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xB05B,
-	0x8F5B, 0xF16B, 0x59C6, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x79CE, 0x149D,
-	0x527C, 0xD063, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F53, 0x8F53, 0x6F53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0xB05B, 0x3174,
-	0xF494, 0x79CE, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[77] = {
+	0x0D4B, 0x1164, 0x116C, 0x1264, 0x126C, 0x149D, 0x1595, 0x18B6,
+	0x18BE, 0x19BE, 0x1CDF, 0x1CE7, 0x2D4B, 0x2E4B, 0x2E53, 0x316C,
+	0x3174, 0x326C, 0x3595, 0x38BE, 0x38C6, 0x39BE, 0x39C6, 0x3CE7,
+	0x3DE7, 0x4E53, 0x526C, 0x5274, 0x527C, 0x559D, 0x55A5, 0x569D,
+	0x59C6, 0x59CE, 0x5DE7, 0x5DEF, 0x6E53, 0x6F53, 0x6F5B, 0x7274,
+	0x7374, 0x779D, 0x79CE, 0x7AC6, 0x7DEF, 0x8F53, 0x8F5B, 0x905B,
+	0x9374, 0x937C, 0x9EF7, 0xAF5B, 0xAF63, 0xB05B, 0xB063, 0xB37C,
+	0xB384, 0xB47C, 0xB7AD, 0xBAD6, 0xBEF7, 0xD05B, 0xD063, 0xD15B,
+	0xD163, 0xDBDE, 0xDFFF, 0xED4A, 0xF163, 0xF16B, 0xF484, 0xF48C,
+	0xF494, 0xF8B5, 0xFBDE, 0xFCDE, 0xFFFF
 };
+
+static const uint8_t data[2470] = {
+	0x83, 0x4C, 0x04, 0x42, 0x3C, 0x20, 0x29, 0x46, 0x80, 0x37, 0x9D, 0x31, 0x81, 0x30, 0xA2, 0x28,
+	0x80, 0x27, 0x80, 0x1B, 0x03, 0x39, 0x1F, 0x15, 0x3C, 0x84, 0x4C, 0x82, 0x4C, 0x05, 0x42, 0x22,
+	0x12, 0x28, 0x27, 0x1A, 0xA1, 0x11, 0x82, 0x04, 0x86, 0x03, 0x91, 0x01, 0x89, 0x44, 0x04, 0x01,
+	0x11, 0x47, 0x22, 0x42, 0x82, 0x4C, 0x81, 0x4C, 0x04, 0x42, 0x32, 0x06, 0x1B, 0x1A, 0xA3, 0x11,
+	0x82, 0x04, 0x85, 0x03, 0x92, 0x01, 0x8B, 0x44, 0x02, 0x01, 0x47, 0x32, 0x82, 0x4C, 0x81, 0x4C,
+	0x02, 0x3C, 0x09, 0x1B, 0xA5, 0x11, 0x81, 0x04, 0x86, 0x03, 0x91, 0x01, 0x8D, 0x44, 0x02, 0x01,
+	0x07, 0x3C, 0x81, 0x4C, 0x80, 0x4C, 0x02, 0x42, 0x32, 0x47, 0xA5, 0x11, 0x82, 0x04, 0x86, 0x03,
+	0x91, 0x01, 0x8E, 0x44, 0x02, 0x38, 0x32, 0x42, 0x80, 0x4C, 0x80, 0x4C, 0x02, 0x42, 0x23, 0x28,
+	0xA5, 0x11, 0x81, 0x04, 0x86, 0x03, 0x92, 0x01, 0x8E, 0x44, 0x02, 0x01, 0x23, 0x42, 0x80, 0x4C,
+	0x80, 0x4C, 0x01, 0x3C, 0x17, 0xA5, 0x11, 0x81, 0x04, 0x87, 0x03, 0x91, 0x01, 0x90, 0x44, 0x01,
+	0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x17, 0xA5, 0x11, 0x81, 0x04, 0x87, 0x03, 0x91,
+	0x01, 0x90, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0xA4, 0x11, 0x81,
+	0x04, 0x87, 0x03, 0x92, 0x01, 0x90, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C,
+	0x0B, 0xA4, 0x11, 0x81, 0x04, 0x86, 0x01, 0x00, 0x03, 0x92, 0x01, 0x90, 0x44, 0x01, 0x17, 0x3C,
+	0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0xA3, 0x11, 0x80, 0x04, 0x00, 0x03, 0x9B, 0x01, 0x91,
+	0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0xA2, 0x11, 0x02, 0x04, 0x03,
+	0x1A, 0x88, 0x2B, 0x00, 0x11, 0x91, 0x01, 0x91, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C,
+	0x01, 0x3C, 0x0B, 0xA2, 0x11, 0x02, 0x04, 0x01, 0x1B, 0x88, 0x4C, 0x00, 0x45, 0x90, 0x01, 0x92,
+	0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0xA1, 0x11, 0x03, 0x04, 0x03,
+	0x01, 0x11, 0x88, 0x4C, 0x01, 0x3E, 0x35, 0x8F, 0x01, 0x92, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C,
+	0x80, 0x4C, 0x01, 0x3C, 0x0B, 0xA0, 0x11, 0x80, 0x04, 0x02, 0x01, 0x44, 0x0F, 0x88, 0x4C, 0x02,
+	0x3E, 0x2E, 0x35, 0x8E, 0x01, 0x92, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C,
+	0x0B, 0x9F, 0x11, 0x81, 0x04, 0x02, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x03, 0x36, 0x26, 0x2E, 0x3D,
+	0x8C, 0x01, 0x93, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x9F, 0x11,
+	0x81, 0x04, 0x02, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x04, 0x36, 0x26, 0x2E, 0x35, 0x3D, 0x8B, 0x01,
+	0x93, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x9E, 0x11, 0x82, 0x04,
+	0x02, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x02, 0x36, 0x26, 0x2E, 0x80, 0x35, 0x00, 0x3D, 0x89, 0x01,
+	0x94, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x9D, 0x11, 0x81, 0x04,
+	0x00, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x00, 0x36, 0x80, 0x2E, 0x81, 0x35, 0x00,
+	0x3D, 0x88, 0x01, 0x94, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x9C,
+	0x11, 0x82, 0x04, 0x00, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x00, 0x36, 0x80, 0x2E,
+	0x00, 0x2F, 0x81, 0x35, 0x00, 0x3D, 0x86, 0x01, 0x95, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80,
+	0x4C, 0x01, 0x3C, 0x0B, 0x9B, 0x11, 0x81, 0x04, 0x81, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88,
+	0x4C, 0x00, 0x34, 0x80, 0x2E, 0x00, 0x2F, 0x82, 0x35, 0x00, 0x3D, 0x85, 0x01, 0x95, 0x44, 0x01,
+	0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x99, 0x11, 0x82, 0x04, 0x82, 0x03, 0x80,
+	0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x00, 0x36, 0x80, 0x2E, 0x84, 0x35, 0x00, 0x3D, 0x83, 0x01,
+	0x96, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x99, 0x11, 0x81, 0x04,
+	0x83, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x02, 0x36, 0x2D, 0x2E, 0x86, 0x35, 0x00,
+	0x44, 0x81, 0x01, 0x96, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x96,
+	0x11, 0x83, 0x04, 0x84, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x03, 0x36, 0x2D, 0x2E,
+	0x2F, 0x85, 0x35, 0x02, 0x3D, 0x44, 0x01, 0x97, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C,
+	0x01, 0x3C, 0x0B, 0x96, 0x11, 0x82, 0x04, 0x85, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C,
+	0x05, 0x36, 0x25, 0x2E, 0x2F, 0x35, 0x2B, 0x80, 0x0A, 0x81, 0x4B, 0x82, 0x0A, 0x00, 0x49, 0x95,
+	0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x94, 0x11, 0x83, 0x04, 0x86,
+	0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x81, 0x2E, 0x00, 0x18, 0x87,
+	0x4C, 0x01, 0x20, 0x35, 0x94, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x92, 0x11, 0x83, 0x04, 0x88, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25,
+	0x80, 0x2E, 0x01, 0x2D, 0x18, 0x87, 0x4C, 0x02, 0x20, 0x2E, 0x3D, 0x93, 0x44, 0x01, 0x17, 0x3C,
+	0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x91, 0x11, 0x83, 0x04, 0x89, 0x03, 0x80, 0x01, 0x01,
+	0x44, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x18, 0x87, 0x4C, 0x03, 0x20,
+	0x25, 0x2E, 0x3D, 0x92, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x8E,
+	0x11, 0x84, 0x04, 0x8B, 0x03, 0x80, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x80,
+	0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x04, 0x16, 0x25, 0x2E, 0x35, 0x3D, 0x91, 0x44, 0x01, 0x17,
+	0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x8B, 0x11, 0x85, 0x04, 0x8C, 0x03, 0x81, 0x01,
+	0x01, 0x44, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x05,
+	0x16, 0x25, 0x2E, 0x2F, 0x35, 0x3D, 0x90, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01,
+	0x3C, 0x0B, 0x88, 0x11, 0x87, 0x04, 0x82, 0x03, 0x8C, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x05,
+	0x34, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x03, 0x16, 0x25, 0x2E, 0x33, 0x80, 0x35, 0x00,
+	0x3D, 0x8F, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x86, 0x11, 0x86,
+	0x04, 0x83, 0x03, 0x8E, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x02, 0x36, 0x2D, 0x2E, 0x80, 0x25,
+	0x00, 0x17, 0x87, 0x4C, 0x03, 0x16, 0x25, 0x2E, 0x33, 0x81, 0x35, 0x00, 0x3D, 0x8E, 0x44, 0x01,
+	0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x80, 0x11, 0x8A, 0x04, 0x84, 0x03, 0x81,
+	0x01, 0x00, 0x2B, 0x87, 0x4C, 0x00, 0x2C, 0x81, 0x01, 0x01, 0x44, 0x02, 0x88, 0x4C, 0x01, 0x36,
+	0x2D, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x03, 0x16, 0x25, 0x2E, 0x2F, 0x82, 0x35, 0x00,
+	0x3D, 0x8D, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x88, 0x04, 0x88,
+	0x03, 0x81, 0x01, 0x00, 0x20, 0x87, 0x4C, 0x02, 0x22, 0x2F, 0x01, 0x80, 0x44, 0x00, 0x02, 0x88,
+	0x4C, 0x01, 0x36, 0x2D, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x01, 0x16, 0x25, 0x80, 0x2E,
+	0x83, 0x35, 0x00, 0x3D, 0x8C, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x84, 0x04, 0x8B, 0x03, 0x81, 0x01, 0x01, 0x44, 0x20, 0x87, 0x4C, 0x05, 0x22, 0x26, 0x2E, 0x44,
+	0x40, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x03, 0x16,
+	0x25, 0x2E, 0x2F, 0x84, 0x35, 0x00, 0x3D, 0x8B, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C,
+	0x01, 0x3C, 0x0B, 0x91, 0x03, 0x80, 0x01, 0x80, 0x44, 0x00, 0x20, 0x87, 0x4C, 0x05, 0x22, 0x25,
+	0x2E, 0x33, 0x40, 0x02, 0x88, 0x4C, 0x01, 0x36, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C,
+	0x03, 0x16, 0x25, 0x2E, 0x2F, 0x85, 0x35, 0x00, 0x3D, 0x8A, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C,
+	0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x91, 0x03, 0x80, 0x01, 0x02, 0x44, 0x40, 0x20, 0x87, 0x4C, 0x01,
+	0x22, 0x25, 0x81, 0x2E, 0x00, 0x02, 0x88, 0x4C, 0x00, 0x36, 0x80, 0x2E, 0x02, 0x2D, 0x25, 0x17,
+	0x87, 0x4C, 0x02, 0x16, 0x25, 0x2D, 0x87, 0x35, 0x00, 0x3D, 0x89, 0x44, 0x01, 0x17, 0x3C, 0x80,
+	0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x91, 0x03, 0x80, 0x01, 0x02, 0x44, 0x3E, 0x20, 0x87, 0x4C,
+	0x05, 0x22, 0x24, 0x2D, 0x2E, 0x25, 0x36, 0x88, 0x4C, 0x05, 0x36, 0x25, 0x2E, 0x2D, 0x25, 0x17,
+	0x87, 0x4C, 0x02, 0x16, 0x25, 0x2D, 0x88, 0x35, 0x00, 0x3D, 0x88, 0x44, 0x01, 0x17, 0x3C, 0x80,
+	0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x91, 0x03, 0x80, 0x01, 0x02, 0x44, 0x3E, 0x20, 0x87, 0x4C,
+	0x05, 0x22, 0x25, 0x2D, 0x2E, 0x25, 0x36, 0x88, 0x4C, 0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17,
+	0x87, 0x4C, 0x02, 0x16, 0x25, 0x2E, 0x89, 0x35, 0x00, 0x3D, 0x87, 0x44, 0x01, 0x17, 0x3C, 0x80,
+	0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x8F, 0x03, 0x82, 0x01, 0x02, 0x44, 0x3E, 0x20, 0x87, 0x4C,
+	0x01, 0x22, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x36, 0x88, 0x4C, 0x05, 0x36, 0x25, 0x2E, 0x2D, 0x25,
+	0x17, 0x87, 0x4C, 0x02, 0x16, 0x25, 0x2E, 0x8A, 0x35, 0x00, 0x3D, 0x86, 0x44, 0x01, 0x17, 0x3C,
+	0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x8C, 0x03, 0x01, 0x01, 0x03, 0x83, 0x01, 0x02, 0x44,
+	0x3E, 0x20, 0x87, 0x4C, 0x00, 0x22, 0x80, 0x25, 0x02, 0x2E, 0x25, 0x36, 0x88, 0x4C, 0x01, 0x36,
+	0x2D, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2E, 0x8B, 0x35, 0x00, 0x3D,
+	0x85, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x89, 0x03, 0x88, 0x01,
+	0x02, 0x44, 0x3E, 0x20, 0x87, 0x4C, 0x01, 0x22, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x34, 0x88, 0x4C,
+	0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2E, 0x8C, 0x35, 0x00,
+	0x3D, 0x84, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x85, 0x03, 0x8C,
+	0x01, 0x02, 0x44, 0x3E, 0x20, 0x87, 0x4C, 0x01, 0x22, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x36, 0x88,
+	0x4C, 0x01, 0x36, 0x2D, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2E, 0x8D,
+	0x35, 0x00, 0x3F, 0x83, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x93,
+	0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x01, 0x22, 0x25, 0x80, 0x2E, 0x01, 0x2D, 0x36, 0x88,
+	0x4C, 0x01, 0x36, 0x25, 0x80, 0x2E, 0x01, 0x25, 0x17, 0x87, 0x4C, 0x03, 0x15, 0x25, 0x2E, 0x2F,
+	0x8D, 0x35, 0x00, 0x3D, 0x82, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x05, 0x22, 0x25, 0x2D, 0x2E, 0x2D, 0x36, 0x88,
+	0x4C, 0x05, 0x36, 0x25, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x03, 0x15, 0x25, 0x2E, 0x2F, 0x8D,
+	0x35, 0x01, 0x3D, 0x3F, 0x81, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x05, 0x22, 0x25, 0x2D, 0x2E, 0x25, 0x36, 0x88,
+	0x4C, 0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D, 0x8D, 0x35,
+	0x03, 0x3D, 0x35, 0x3D, 0x3F, 0x80, 0x44, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C,
+	0x0B, 0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x01, 0x22, 0x25, 0x80, 0x2E, 0x01, 0x25,
+	0x36, 0x88, 0x4C, 0x05, 0x35, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D,
+	0x8F, 0x35, 0x80, 0x3D, 0x03, 0x3F, 0x44, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x05, 0x22, 0x19, 0x25, 0x2E, 0x25, 0x35, 0x88,
+	0x4C, 0x05, 0x35, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D, 0x8E, 0x35,
+	0x00, 0x3D, 0x80, 0x35, 0x03, 0x3D, 0x3F, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x00, 0x22, 0x80, 0x25, 0x02, 0x2E, 0x25, 0x36,
+	0x88, 0x4C, 0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D, 0x8C,
+	0x35, 0x01, 0x3D, 0x35, 0x83, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B,
+	0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x02, 0x22, 0x25, 0x2E, 0x80, 0x2D, 0x00, 0x36,
+	0x88, 0x4C, 0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D, 0x8C,
+	0x35, 0x80, 0x3D, 0x00, 0x35, 0x82, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C,
+	0x0B, 0x93, 0x01, 0x02, 0x44, 0x3D, 0x20, 0x87, 0x4C, 0x05, 0x18, 0x25, 0x2D, 0x2E, 0x25, 0x36,
+	0x88, 0x4C, 0x05, 0x33, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D, 0x89,
+	0x35, 0x00, 0x3D, 0x80, 0x35, 0x85, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C,
+	0x0B, 0x92, 0x01, 0x80, 0x44, 0x01, 0x3D, 0x20, 0x87, 0x4C, 0x05, 0x18, 0x25, 0x2D, 0x2E, 0x2D,
+	0x36, 0x88, 0x4C, 0x05, 0x36, 0x2D, 0x2E, 0x2D, 0x25, 0x17, 0x87, 0x4C, 0x02, 0x15, 0x25, 0x2D,
+	0x8A, 0x35, 0x87, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x92, 0x01,
+	0x80, 0x44, 0x02, 0x3D, 0x1D, 0x16, 0x85, 0x08, 0x06, 0x15, 0x3A, 0x25, 0x2D, 0x2E, 0x25, 0x2E,
+	0x80, 0x15, 0x00, 0x13, 0x82, 0x08, 0x00, 0x13, 0x80, 0x15, 0x06, 0x2E, 0x2D, 0x2E, 0x2D, 0x25,
+	0x3A, 0x13, 0x85, 0x08, 0x03, 0x15, 0x06, 0x25, 0x2E, 0x87, 0x35, 0x00, 0x3D, 0x81, 0x35, 0x86,
+	0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x92, 0x01, 0x80, 0x44, 0x03,
+	0x3D, 0x2E, 0x0E, 0x00, 0x84, 0x43, 0x02, 0x00, 0x0D, 0x25, 0x81, 0x2E, 0x00, 0x25, 0x80, 0x00,
+	0x84, 0x43, 0x03, 0x00, 0x0C, 0x25, 0x2D, 0x80, 0x2E, 0x02, 0x25, 0x0D, 0x00, 0x85, 0x43, 0x03,
+	0x00, 0x19, 0x2D, 0x2F, 0x88, 0x35, 0x89, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01,
+	0x3C, 0x0B, 0x92, 0x01, 0x81, 0x44, 0x02, 0x3D, 0x35, 0x2E, 0x84, 0x19, 0x00, 0x24, 0x80, 0x25,
+	0x81, 0x2E, 0x01, 0x2D, 0x25, 0x86, 0x19, 0x05, 0x25, 0x2D, 0x2E, 0x2F, 0x2E, 0x2D, 0x80, 0x25,
+	0x85, 0x19, 0x00, 0x25, 0x80, 0x2D, 0x86, 0x35, 0x03, 0x3D, 0x35, 0x3D, 0x35, 0x88, 0x3D, 0x01,
+	0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x93, 0x01, 0x81, 0x44, 0x80, 0x3D, 0x00,
+	0x35, 0x84, 0x25, 0x00, 0x2D, 0x83, 0x2E, 0x00, 0x2D, 0x86, 0x25, 0x02, 0x2D, 0x2E, 0x2F, 0x80,
+	0x35, 0x80, 0x2E, 0x86, 0x25, 0x80, 0x2D, 0x88, 0x35, 0x8B, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C,
+	0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x94, 0x01, 0x82, 0x44, 0x01, 0x40, 0x35, 0x84, 0x2E, 0x00, 0x2F,
+	0x81, 0x35, 0x00, 0x2F, 0x84, 0x2E, 0x00, 0x2D, 0x81, 0x2E, 0x83, 0x35, 0x00, 0x2E, 0x84, 0x2D,
+	0x80, 0x2E, 0x00, 0x2F, 0x88, 0x35, 0x01, 0x3D, 0x35, 0x8A, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C,
+	0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x94, 0x01, 0x84, 0x44, 0x01, 0x3D, 0x35, 0x80, 0x2E, 0x00, 0x2F,
+	0x86, 0x35, 0x80, 0x2E, 0x80, 0x2F, 0x01, 0x35, 0x2F, 0x96, 0x35, 0x00, 0x3D, 0x80, 0x35, 0x8C,
+	0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x01, 0x3C, 0x0B, 0x90, 0x01, 0x89, 0x44, 0x00,
+	0x3F, 0xA8, 0x35, 0x8E, 0x3D, 0x01, 0x17, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x02, 0x3C, 0x17, 0x1B,
+	0x8C, 0x01, 0x8D, 0x44, 0x00, 0x3F, 0xA6, 0x35, 0x01, 0x3D, 0x35, 0x8C, 0x3D, 0x02, 0x10, 0x17,
+	0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x03, 0x3C, 0x23, 0x1E, 0x44, 0x86, 0x01, 0x93, 0x44, 0x00, 0x3D,
+	0xA5, 0x35, 0x8D, 0x3D, 0x03, 0x35, 0x1D, 0x23, 0x3C, 0x80, 0x4C, 0x80, 0x4C, 0x03, 0x42, 0x2C,
+	0x41, 0x10, 0x9C, 0x44, 0x00, 0x3D, 0xA1, 0x35, 0x90, 0x3D, 0x03, 0x02, 0x41, 0x2C, 0x42, 0x80,
+	0x4C, 0x80, 0x4C, 0x06, 0x42, 0x32, 0x0B, 0x14, 0x02, 0x3D, 0x40, 0x9A, 0x44, 0x00, 0x3F, 0xA2,
+	0x35, 0x8B, 0x3D, 0x06, 0x35, 0x2E, 0x45, 0x20, 0x0B, 0x32, 0x42, 0x80, 0x4C, 0x81, 0x4C, 0x06,
+	0x42, 0x2C, 0x4A, 0x2A, 0x05, 0x1C, 0x3E, 0x98, 0x2E, 0x80, 0x2D, 0x00, 0x25, 0xA0, 0x19, 0x8B,
+	0x25, 0x06, 0x35, 0x10, 0x48, 0x2A, 0x4A, 0x2C, 0x42, 0x81, 0x4C, 0x82, 0x4C, 0x05, 0x3C, 0x2C,
+	0x0B, 0x3B, 0x2A, 0x21, 0xCA, 0x14, 0x05, 0x21, 0x2A, 0x3B, 0x0B, 0x2C, 0x3C, 0x82, 0x4C, 0x82,
+	0x4C, 0x04, 0x42, 0x3C, 0x32, 0x23, 0x0B, 0x80, 0x4A, 0xC8, 0x41, 0x80, 0x4A, 0x03, 0x0B, 0x23,
+	0x32, 0x3C, 0x83, 0x4C, 0x84, 0x4C, 0x00, 0x42, 0x80, 0x3C, 0x81, 0x32, 0xC7, 0x2C, 0x80, 0x32,
+	0x80, 0x3C, 0x00, 0x42, 0x84, 0x4C
+};
+
+const CompressedIcon barsIcon = {96, 67, 77, palette, data};
@@ -2,810 +2,187 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t connectedIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x17CF,
-	0xB2BE, 0x6EA6, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E,
-	0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E, 0x6D9E,
-	0x6D9E, 0x6D9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E,
-	0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E,
-	0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E,
-	0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x6C9E, 0x4C9E, 0x4C9E,
-	0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E,
-	0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E,
-	0x4C9E, 0x4C9E, 0x4C9E, 0x4C9E, 0x4B9E, 0x4B9E, 0x4B9E, 0x4B9E,
-	0x4B9E, 0x4B9E, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4DA6, 0x91B6,
-	0xF6CE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7CEF, 0x90AE, 0x4C9E,
-	0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x2A8E,
-	0x2A96, 0x6FA6, 0x7CEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x70AE, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x2B96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0x298E, 0x6FA6, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0xD6CE, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96,
-	0x2B96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x298E, 0xB6C6, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x6FA6, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x4E9E, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x4B9E, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x4B96, 0x2B96, 0x4A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x2A8E, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x4B96, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x4B96, 0x4B96, 0x2B96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x4B96, 0x4B96, 0x4B96, 0x4B96,
-	0x4B96, 0x2B96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x4B96, 0x2B96, 0x2B96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A96, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x0A8E, 0x0A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A8E, 0x0A8E, 0x2C9E, 0xB2B6, 0x16CF, 0x58DF, 0x7AE7, 0x9BE7,
-	0x9BE7, 0x7AE7, 0x58DF, 0x17CF, 0xB2B6, 0x2C9E, 0x0A8E, 0x0A8E,
-	0x098E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2C96,
-	0xD4C6, 0x9BE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BEF, 0xD4C6,
-	0x2C96, 0x098E, 0x098E, 0x2A8E, 0x2A8E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2B96, 0xF5CE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xF6CE, 0x2B96, 0x098E, 0x098E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A8E, 0x0A8E, 0x91AE, 0xDEFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDEFF, 0x91B6, 0x098E, 0x098E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A8E, 0x0A96, 0x17D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18D7, 0x0A8E, 0x098E, 0x098E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x0A8E, 0x0B96, 0xBCEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DEF, 0x0B96, 0x098E,
-	0x098E, 0x098E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x0A8E,
-	0x0B96, 0xBDF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEF7, 0x0A96,
-	0x098E, 0x098E, 0x098E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x0A8E, 0x0A8E,
-	0xBCEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DEF,
-	0xEA8D, 0x098E, 0x098E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x0A8E, 0x17D7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x18D7, 0xE98D, 0x098E, 0x098E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x0A8E, 0x91AE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x30AE, 0xE98D, 0x098E, 0x098E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x0A8E, 0x0C96, 0xDEFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3ADF, 0x34B6,
-	0x34B6, 0xB8CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xDFFF, 0x8B8D, 0xE98D, 0x098E, 0x098E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x0A8E, 0xF6CE, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDEFF, 0x909D, 0x686C, 0x6764, 0x676C,
-	0x676C, 0x6764, 0x686C, 0x0D8D, 0x9DEF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xB6C6, 0x687D, 0xE98D, 0x098E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x0A8E, 0x0C96, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x3ADF, 0xAA7C, 0x876C, 0xC874, 0xE874, 0xE874,
-	0xE874, 0xE874, 0xC874, 0xA76C, 0x886C, 0x97CE, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x8B8D, 0x687D, 0xE98D, 0x098E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x0A8E, 0x0A8E, 0xB4BE, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x1ADF, 0x886C, 0xC874, 0xE874, 0x0875, 0x2875, 0x287D,
-	0x287D, 0x287D, 0x0875, 0x0875, 0xE874, 0x876C, 0xD8CE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x74BE, 0x687D, 0x887D, 0x098E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x0A8E, 0xEA8D, 0x7BE7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xDEFF, 0xCA7C, 0xE874, 0x0875, 0x287D, 0x287D, 0x487D, 0x487D,
-	0x487D, 0x487D, 0x487D, 0x287D, 0x0875, 0xE874, 0xA974, 0x9DEF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x7CE7, 0x687D, 0x887D, 0x8885, 0x098E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A8E, 0x0A8E, 0x0C96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x13AE, 0xC874, 0x0875, 0x287D, 0x487D, 0x687D, 0x697D, 0x6885,
-	0x687D, 0x687D, 0x687D, 0x687D, 0x487D, 0x2875, 0xE874, 0xB09D,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xAB8D, 0x687D, 0x8885, 0x8885,
-	0x098E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x0A8E, 0xEA8D, 0x72B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7CEF, 0x3BE7,
-	0x0B85, 0x0875, 0x287D, 0x487D, 0x697D, 0x6985, 0x6885, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x687D, 0x687D, 0x487D, 0x0875, 0xE97C,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31AE, 0x687D, 0x887D, 0x8885,
-	0xA885, 0x098E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x0A8E, 0xEA8D, 0xD6CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x1ADF, 0xAA7C, 0x6764, 0x676C,
-	0xE874, 0x287D, 0x487D, 0x697D, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x687D, 0x687D, 0x287D, 0x0875,
-	0x5BE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6CE, 0x687D, 0x887D, 0x8885,
-	0xA885, 0xA885, 0x098E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A8E, 0x0A8E, 0xE98D, 0x18D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x34B6, 0x4764, 0xA86C, 0xE874, 0x0875,
-	0x287D, 0x487D, 0x697D, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x687D, 0x487D, 0x287D,
-	0x75BE, 0x9DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8D6, 0x687D, 0x887D, 0x8885,
-	0xA885, 0xA885, 0xA885, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x0A8E, 0xC98D, 0x5ADF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xB7CE, 0x876C, 0xE874, 0x0875, 0x2875, 0x287D,
-	0x487D, 0x687D, 0x6985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x687D, 0x687D, 0x487D,
-	0xC76C, 0x876C, 0x4764, 0x6F9D, 0xDEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE7, 0x487D, 0x887D, 0x887D,
-	0xA885, 0xA885, 0xA885, 0xA885, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x0A8E, 0xC98D, 0x5BE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xBEF7, 0x676C, 0xE874, 0x0875, 0x287D, 0x487D, 0x687D,
-	0x697D, 0x6985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x887D, 0x687D, 0x487D,
-	0x287D, 0x0875, 0xE774, 0xA76C, 0x4764, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE7, 0x487D, 0x687D, 0x887D,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x0A8E, 0xC985, 0x5BE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x3ADF, 0xE874, 0x0875, 0x287D, 0x487D, 0x697D, 0x6985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x887D, 0x687D,
-	0x687D, 0x487D, 0x2875, 0x0875, 0xE774, 0x6764, 0xDFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE7, 0x487D, 0x887D, 0x8885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0xE98D, 0xC985, 0x5ADF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xF2AD, 0x0875, 0x287D, 0x487D, 0x697D, 0x6985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x8885,
-	0x887D, 0x687D, 0x487D, 0x487D, 0x0875, 0xE774, 0x3BE7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE7, 0x487D, 0x687D, 0x887D,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0xE98D, 0xC985, 0xF8D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xF1AD, 0x2875, 0x487D, 0x697D, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x8885, 0x8885,
-	0x8885, 0x887D, 0x887D, 0x687D, 0x487D, 0x0875, 0xF1A5, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8D6, 0x487D, 0x887D, 0x8885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x098E, 0xC985, 0xB6C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x19DF, 0x2875, 0x487D, 0x697D, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8885, 0x8885, 0xA985,
-	0x8885, 0x8885, 0x887D, 0x687D, 0x687D, 0x287D, 0xF1A5, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB6C6, 0x487D, 0x887D, 0x8885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x098E, 0xC985, 0x31AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xBEF7, 0x287D, 0x487D, 0x687D, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8885, 0x8885, 0x8885, 0xA985, 0x8885,
-	0x8885, 0x8985, 0x8885, 0x887D, 0x687D, 0x287D, 0xF8D6, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x11AE, 0x487D, 0x687D, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x0A8E, 0x098E, 0xC98D, 0xAB8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x74BE, 0x487D, 0x687D, 0x897D, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8985, 0x8885, 0x8885, 0x8985, 0x8985, 0x8985,
-	0x8985, 0x8985, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885, 0xA985,
-	0x8985, 0x8985, 0x8885, 0x887D, 0x687D, 0x287D, 0xBEF7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B85, 0x487D, 0x887D, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xA885, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x0A8E, 0x098E, 0xE98D, 0x8985, 0x7BE7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x10A6, 0x687D, 0x687D, 0x8985, 0x8985,
-	0x8985, 0x8885, 0x8885, 0x8885, 0x8985, 0x8985, 0x8885, 0x8985,
-	0x8985, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885,
-	0x8985, 0x8885, 0x8885, 0x887D, 0x687D, 0xF7D6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x7CE7, 0x0775, 0x687D, 0x887D, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xA885, 0xC885, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x0A8E, 0x0A8E, 0xE98D, 0xA985, 0x53B6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95C6, 0x8B8D, 0x687D, 0x697D,
-	0x8985, 0x8885, 0x8885, 0x8885, 0x887D, 0x887D, 0x887D, 0x8885,
-	0x8885, 0x887D, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885, 0x8885,
-	0x887D, 0x887D, 0x687D, 0xAB8D, 0xF7D6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x33B6, 0x2875, 0x687D, 0x887D, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x0A8E, 0xE98D, 0xC985, 0x8B85, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE7, 0xF7CE,
-	0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE,
-	0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE, 0xF7CE,
-	0xF7CE, 0xF7CE, 0x5AE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x2A85, 0x487D, 0x887D, 0x8885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xA885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0x098E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A96, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x098E, 0x098E, 0xC985, 0x8985, 0x95BE, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x75C6, 0x0775, 0x687D, 0x887D, 0x8885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0x098E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A96, 0x2A96, 0x2A96, 0x2A96,
-	0x2A96, 0x2A96, 0x2A96, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x098E, 0x098E, 0xE98D, 0xA985, 0x6A85, 0xDEFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xDFFF, 0x0A7D, 0x487D, 0x687D, 0x887D, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x098E, 0xE98D, 0xC985, 0x8985, 0xD0A5, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xB09D, 0x0775, 0x487D, 0x887D, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0x098E, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x098E, 0x098E, 0xE98D, 0xA985, 0x487D, 0xD7CE,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xF8D6, 0xC76C, 0x487D, 0x687D, 0x8885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0x098E, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x098E, 0xE98D, 0xC985, 0x8985, 0x287D,
-	0x9DEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DEF,
-	0xC86C, 0x2875, 0x487D, 0x887D, 0x8885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0x098E, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x298E, 0x298E, 0x098E, 0x098E, 0xE98D, 0xA985, 0x8885,
-	0x097D, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFF, 0xA874,
-	0x0775, 0x487D, 0x687D, 0x8885, 0xA885, 0xA885, 0xA885, 0xC885,
-	0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0xE985, 0xA985,
-	0x687D, 0x097D, 0x9DEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DEF, 0xA874, 0x0775,
-	0x487D, 0x687D, 0x887D, 0xA885, 0xA885, 0xC885, 0xA885, 0xA885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0xC985,
-	0xA985, 0x687D, 0xC874, 0xB7CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD8D6, 0xA76C, 0x0775, 0x487D,
-	0x687D, 0x887D, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0xE98D,
-	0xC985, 0xA985, 0x687D, 0xE774, 0x8F9D, 0xDEFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0xB09D, 0x876C, 0x0775, 0x2875, 0x687D,
-	0x887D, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x2A8E, 0x2A8E, 0x2A8E, 0x2A8E,
-	0x2A8E, 0x2A8E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0xE98D, 0xC985, 0xA985, 0x8885, 0x0875, 0xA974, 0x55BE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x75BE, 0xC974, 0xC76C, 0x2775, 0x287D, 0x687D, 0x887D,
-	0x8885, 0xA885, 0xA885, 0xA885, 0xC885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xE885, 0xE885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E,
-	0x098E, 0xE98D, 0xC985, 0xC985, 0x8885, 0x487D, 0x876C, 0xA974,
-	0x13AE, 0x5BE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7CE7, 0x13B6,
-	0xCA74, 0xA76C, 0xE774, 0x2775, 0x487D, 0x687D, 0x887D, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E,
-	0x098E, 0x098E, 0xE98D, 0xE98D, 0xC985, 0xA985, 0x687D, 0xE774,
-	0xA76C, 0x6764, 0xCA74, 0xB09D, 0x76C6, 0xD8D6, 0x3BDF, 0x3BE7,
-	0x5BE7, 0x3ADF, 0xD8D6, 0x96C6, 0xB1A5, 0xCA7C, 0x6664, 0xA76C,
-	0xE774, 0x2775, 0x487D, 0x487D, 0x687D, 0x887D, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xE885, 0xE885, 0xE885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0xE98D, 0xC985, 0xC985, 0x8885,
-	0x0875, 0x0775, 0xE774, 0xA76C, 0x876C, 0x8764, 0x6764, 0x6764,
-	0x6664, 0x6764, 0x876C, 0x876C, 0xA76C, 0xE774, 0x0775, 0x2775,
-	0x2875, 0x487D, 0x687D, 0x887D, 0x8885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xE885, 0xE885, 0xE885, 0xE985, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0xE98D, 0xE98D, 0xE985,
-	0xA885, 0x287D, 0x2875, 0x2875, 0x0875, 0x0775, 0x0775, 0x0775,
-	0x0775, 0x0775, 0x0775, 0x2875, 0x2875, 0x2875, 0x487D, 0x687D,
-	0x687D, 0x887D, 0x887D, 0x8885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xE885,
-	0xE885, 0xC885, 0xC885, 0xE885, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0xE98D, 0xC985, 0x687D, 0x487D, 0x487D, 0x487D, 0x487D, 0x487D,
-	0x487D, 0x487D, 0x487D, 0x487D, 0x687D, 0x687D, 0x687D, 0x887D,
-	0x8885, 0x8885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xA885,
-	0xC885, 0xC885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xE885, 0xC885, 0xE885,
-	0xE885, 0xE885, 0xE885, 0xE985, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0x098E, 0xE98D, 0x887D, 0x887D, 0x687D, 0x887D, 0x687D,
-	0x687D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x8885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xA885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xE885, 0xE885,
-	0xE885, 0xE985, 0xE885, 0xE985, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E,
-	0x098E, 0x098E, 0x098E, 0xE98D, 0x887D, 0x887D, 0x887D, 0x8885,
-	0x8885, 0xA885, 0x8885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xE885, 0xC885, 0xC885, 0xC885, 0xE985,
-	0xE885, 0xE885, 0xE985, 0xE985, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x0A8E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xC885, 0xC885, 0xA885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xE985, 0xE885, 0xE985,
-	0xE885, 0xE985, 0xE985, 0xC985, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0xCC95, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x098E, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xE885, 0xE885, 0xE885, 0xE885, 0xE885,
-	0xE985, 0xE985, 0xE985, 0xAC8D, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0x13AE, 0x098E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0xA885,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xC885, 0xA885, 0xA885, 0xC885, 0xC885, 0xA885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xE885, 0xC885, 0xE885, 0xE885, 0xE885, 0xE985,
-	0xE985, 0xE985, 0xC885, 0xF3AD, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDBDE, 0xAC8D, 0x098E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xE885, 0xE885, 0xE985, 0xE985, 0xE985, 0xE985,
-	0xE985, 0xC885, 0x6B8D, 0xDBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x78C6, 0x8C8D, 0xC985,
-	0xE98D, 0x098E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E, 0x298E,
-	0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E, 0x098E,
-	0x098E, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885, 0xA885,
-	0xA885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885,
-	0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xC885, 0xE885,
-	0xE885, 0xC885, 0xE885, 0xE985, 0xE985, 0xE885, 0xC885, 0xA885,
-	0x887D, 0x6B8D, 0x78CE, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x79CE, 0xD2A5,
-	0x8D95, 0x8A85, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D,
-	0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D,
-	0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D,
-	0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D,
-	0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D, 0x887D,
-	0x887D, 0x687D, 0x2775, 0x2775, 0x2775, 0x2775, 0x2775, 0x2775,
-	0x2775, 0x2775, 0x2775, 0x2775, 0x2775, 0x2775, 0x2775, 0x2775,
-	0x2775, 0x2775, 0x2775, 0x2875, 0x2875, 0x2875, 0x2875, 0x2875,
-	0x2875, 0x487D, 0x487D, 0x487D, 0x487D, 0x487D, 0x487D, 0x487D,
-	0x487D, 0x487D, 0x487D, 0x487D, 0x487D, 0x487D, 0x4985, 0x6D8D,
-	0xB1A5, 0x79CE, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[174] = {
+	0x0775, 0x0875, 0x097D, 0x098E, 0x0A7D, 0x0A8E, 0x0A96, 0x0B85,
+	0x0B96, 0x0C96, 0x0D8D, 0x10A6, 0x11AE, 0x13AE, 0x13B6, 0x16CF,
+	0x17CF, 0x17D7, 0x18D7, 0x19DF, 0x1ADF, 0x1CE7, 0x2775, 0x2875,
+	0x287D, 0x298E, 0x2A85, 0x2A8E, 0x2A96, 0x2B96, 0x2C96, 0x2C9E,
+	0x30AE, 0x31AE, 0x33B6, 0x34B6, 0x38C6, 0x3ADF, 0x3BDF, 0x3BE7,
+	0x3CE7, 0x4764, 0x487D, 0x4985, 0x4A96, 0x4B85, 0x4B96, 0x4B9E,
+	0x4C9E, 0x4DA6, 0x4E9E, 0x53B6, 0x55BE, 0x58DF, 0x59CE, 0x5ADF,
+	0x5AE7, 0x5BE7, 0x5DEF, 0x6664, 0x6764, 0x676C, 0x686C, 0x687D,
+	0x6885, 0x697D, 0x6985, 0x6A85, 0x6B8D, 0x6C9E, 0x6D8D, 0x6D9E,
+	0x6EA6, 0x6F9D, 0x6FA6, 0x70AE, 0x72B6, 0x74BE, 0x75BE, 0x75C6,
+	0x76C6, 0x78C6, 0x78CE, 0x79CE, 0x7AE7, 0x7BE7, 0x7CE7, 0x7CEF,
+	0x7DEF, 0x8764, 0x876C, 0x886C, 0x887D, 0x8885, 0x897D, 0x8985,
+	0x8A85, 0x8B85, 0x8B8D, 0x8C8D, 0x8D95, 0x8F9D, 0x909D, 0x90AE,
+	0x91AE, 0x91B6, 0x95BE, 0x95C6, 0x96C6, 0x97CE, 0x9BE7, 0x9BEF,
+	0x9DEF, 0x9EF7, 0xA76C, 0xA86C, 0xA874, 0xA885, 0xA974, 0xA985,
+	0xAA7C, 0xAB8D, 0xAC8D, 0xB09D, 0xB1A5, 0xB2B6, 0xB2BE, 0xB4BE,
+	0xB6C6, 0xB7CE, 0xB8CE, 0xBAD6, 0xBCEF, 0xBDF7, 0xBEF7, 0xC76C,
+	0xC86C, 0xC874, 0xC885, 0xC974, 0xC985, 0xC98D, 0xCA74, 0xCA7C,
+	0xCC95, 0xD0A5, 0xD2A5, 0xD4C6, 0xD6CE, 0xD7CE, 0xD8CE, 0xD8D6,
+	0xDBDE, 0xDEF7, 0xDEFF, 0xDFFF, 0xE774, 0xE874, 0xE885, 0xE97C,
+	0xE985, 0xE98D, 0xEA8D, 0xF1A5, 0xF1AD, 0xF2AD, 0xF3AD, 0xF5CE,
+	0xF6CE, 0xF7CE, 0xF7D6, 0xF8D6, 0xFBDE, 0xFFFF
 };
+
+static const uint8_t data[2436] = {
+	0x83, 0xAD, 0x04, 0x9B, 0x86, 0x10, 0x7E, 0x48, 0x8E, 0x47, 0x9A, 0x45, 0x94, 0x30, 0x84, 0x2F,
+	0x82, 0x2E, 0x03, 0x31, 0x69, 0xA8, 0x86, 0x84, 0xAD, 0x82, 0xAD, 0x03, 0x9B, 0x57, 0x67, 0x30,
+	0x89, 0x2E, 0xA4, 0x1C, 0x86, 0x1B, 0x94, 0x19, 0x04, 0x1B, 0x1C, 0x4A, 0x57, 0x9B, 0x82, 0xAD,
+	0x81, 0xAD, 0x02, 0x9B, 0x71, 0x4B, 0x89, 0x2E, 0x00, 0x1D, 0xA4, 0x1C, 0x87, 0x1B, 0x93, 0x19,
+	0x81, 0x03, 0x02, 0x19, 0x4A, 0x71, 0x82, 0xAD, 0x81, 0xAD, 0x01, 0x86, 0x94, 0x89, 0x2E, 0x00,
+	0x1D, 0xA5, 0x1C, 0x86, 0x1B, 0x94, 0x19, 0x82, 0x03, 0x02, 0x19, 0x80, 0x86, 0x81, 0xAD, 0x80,
+	0xAD, 0x02, 0x9B, 0x71, 0x4A, 0x88, 0x2E, 0xA7, 0x1C, 0x86, 0x1B, 0x94, 0x19, 0x83, 0x03, 0x02,
+	0x32, 0x71, 0x9B, 0x80, 0xAD, 0x80, 0xAD, 0x02, 0x9B, 0x3A, 0x2F, 0x86, 0x2E, 0x01, 0x1D, 0x2C,
+	0xA6, 0x1C, 0x87, 0x1B, 0x93, 0x19, 0x84, 0x03, 0x02, 0x1B, 0x3A, 0x9B, 0x80, 0xAD, 0x80, 0xAD,
+	0x01, 0x86, 0x28, 0x85, 0x2E, 0x00, 0x1D, 0xA9, 0x1C, 0x86, 0x1B, 0x94, 0x19, 0x85, 0x03, 0x01,
+	0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x28, 0x83, 0x2E, 0x00, 0x1D, 0xAB, 0x1C, 0x86,
+	0x1B, 0x94, 0x19, 0x85, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x02, 0x86, 0x15, 0x2E,
+	0x80, 0x1D, 0xAD, 0x1C, 0x87, 0x1B, 0x93, 0x19, 0x86, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80,
+	0xAD, 0x01, 0x86, 0x15, 0xA7, 0x1C, 0x86, 0x1B, 0x00, 0x1C, 0x86, 0x1B, 0x95, 0x19, 0x85, 0x03,
+	0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0xA6, 0x1C, 0x86, 0x1B, 0x80, 0x05,
+	0x86, 0x1B, 0x94, 0x19, 0x86, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15,
+	0xA2, 0x1C, 0x06, 0x1B, 0x05, 0x1F, 0x7D, 0x0F, 0x35, 0x54, 0x80, 0x6E, 0x04, 0x54, 0x35, 0x10,
+	0x7D, 0x1F, 0x80, 0x05, 0x00, 0x03, 0x82, 0x1B, 0x95, 0x19, 0x86, 0x03, 0x01, 0x28, 0x86, 0x80,
+	0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0xA0, 0x1C, 0x03, 0x1B, 0x1E, 0x93, 0x6E, 0x8A, 0xAD, 0x02,
+	0x6F, 0x93, 0x1E, 0x80, 0x03, 0x80, 0x1B, 0x95, 0x19, 0x86, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD,
+	0x80, 0xAD, 0x01, 0x86, 0x15, 0x9E, 0x1C, 0x02, 0x1B, 0x1D, 0xA7, 0x90, 0xAD, 0x01, 0xA8, 0x1D,
+	0x80, 0x03, 0x94, 0x19, 0x87, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15,
+	0x9C, 0x1C, 0x03, 0x1B, 0x05, 0x68, 0x9A, 0x92, 0xAD, 0x01, 0x9A, 0x69, 0x80, 0x03, 0x92, 0x19,
+	0x88, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9B, 0x1C, 0x02, 0x1B,
+	0x06, 0x11, 0x96, 0xAD, 0x01, 0x12, 0x05, 0x80, 0x03, 0x90, 0x19, 0x88, 0x03, 0x01, 0x28, 0x86,
+	0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9A, 0x1C, 0x02, 0x05, 0x08, 0x84, 0x98, 0xAD, 0x01,
+	0x70, 0x08, 0x81, 0x03, 0x8E, 0x19, 0x88, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01,
+	0x86, 0x15, 0x99, 0x1C, 0x02, 0x05, 0x08, 0x85, 0x9A, 0xAD, 0x01, 0x99, 0x06, 0x81, 0x03, 0x8C,
+	0x19, 0x89, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x98, 0x1C, 0x80,
+	0x05, 0x00, 0x84, 0x9C, 0xAD, 0x01, 0x70, 0xA2, 0x80, 0x03, 0x8C, 0x19, 0x89, 0x03, 0x01, 0x28,
+	0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x97, 0x1C, 0x02, 0x1B, 0x05, 0x11, 0x9E, 0xAD,
+	0x01, 0x12, 0xA1, 0x80, 0x03, 0x8A, 0x19, 0x8A, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD,
+	0x01, 0x86, 0x15, 0x96, 0x1C, 0x02, 0x1B, 0x05, 0x68, 0xA0, 0xAD, 0x01, 0x20, 0xA1, 0x80, 0x03,
+	0x89, 0x19, 0x8A, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x96, 0x1C,
+	0x02, 0x05, 0x09, 0x9A, 0x8D, 0xAD, 0x00, 0x25, 0x80, 0x23, 0x00, 0x82, 0x8D, 0xAD, 0x02, 0x9B,
+	0x62, 0xA1, 0x80, 0x03, 0x88, 0x19, 0x8A, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01,
+	0x86, 0x15, 0x95, 0x1C, 0x02, 0x1B, 0x05, 0xA8, 0x8B, 0xAD, 0x03, 0x9A, 0x66, 0x3E, 0x3C, 0x80,
+	0x3D, 0x03, 0x3C, 0x3E, 0x0A, 0x70, 0x8B, 0xAD, 0x03, 0x80, 0x3F, 0xA1, 0x03, 0x87, 0x19, 0x8B,
+	0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x95, 0x1C, 0x01, 0x05, 0x09,
+	0x8B, 0xAD, 0x03, 0x25, 0x78, 0x5A, 0x89, 0x82, 0x9D, 0x03, 0x89, 0x72, 0x5B, 0x6D, 0x8B, 0xAD,
+	0x03, 0x62, 0x3F, 0xA1, 0x03, 0x86, 0x19, 0x8B, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD,
+	0x01, 0x86, 0x15, 0x94, 0x1C, 0x80, 0x05, 0x00, 0x7F, 0x8A, 0xAD, 0x05, 0x14, 0x5B, 0x89, 0x9D,
+	0x01, 0x17, 0x81, 0x18, 0x80, 0x01, 0x02, 0x9D, 0x5A, 0x96, 0x8A, 0xAD, 0x03, 0x4D, 0x3F, 0x5C,
+	0x03, 0x85, 0x19, 0x8C, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x94,
+	0x1C, 0x02, 0x05, 0xA2, 0x55, 0x89, 0xAD, 0x03, 0x9A, 0x8F, 0x9D, 0x01, 0x80, 0x18, 0x83, 0x2A,
+	0x04, 0x18, 0x01, 0x9D, 0x76, 0x70, 0x89, 0xAD, 0x04, 0x56, 0x3F, 0x5C, 0x5D, 0x03, 0x84, 0x19,
+	0x8C, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x93, 0x1C, 0x02, 0x1B,
+	0x05, 0x09, 0x8A, 0xAD, 0x07, 0x0D, 0x89, 0x01, 0x18, 0x2A, 0x3F, 0x41, 0x40, 0x82, 0x3F, 0x03,
+	0x2A, 0x17, 0x9D, 0x7B, 0x8A, 0xAD, 0x01, 0x79, 0x3F, 0x80, 0x5D, 0x00, 0x03, 0x82, 0x19, 0x8D,
+	0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x93, 0x1C, 0x02, 0x05, 0xA2,
+	0x4C, 0x88, 0xAD, 0x08, 0x57, 0x27, 0x07, 0x01, 0x18, 0x2A, 0x41, 0x42, 0x40, 0x82, 0x5F, 0x80,
+	0x3F, 0x02, 0x2A, 0x01, 0x9F, 0x8A, 0xAD, 0x05, 0x21, 0x3F, 0x5C, 0x5D, 0x75, 0x03, 0x80, 0x19,
+	0x8E, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x93, 0x1C, 0x02, 0x05,
+	0xA2, 0x94, 0x86, 0xAD, 0x07, 0x14, 0x78, 0x3C, 0x3D, 0x9D, 0x18, 0x2A, 0x41, 0x86, 0x5F, 0x80,
+	0x3F, 0x02, 0x18, 0x01, 0x39, 0x89, 0xAD, 0x03, 0x94, 0x3F, 0x5C, 0x5D, 0x80, 0x75, 0x01, 0x03,
+	0x19, 0x8E, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x92, 0x1C, 0x03,
+	0x1B, 0x05, 0xA1, 0x12, 0x85, 0xAD, 0x07, 0x23, 0x29, 0x73, 0x9D, 0x01, 0x18, 0x2A, 0x41, 0x87,
+	0x5F, 0x06, 0x5D, 0x3F, 0x2A, 0x18, 0x4E, 0x70, 0x9B, 0x87, 0xAD, 0x03, 0xAB, 0x3F, 0x5C, 0x5D,
+	0x81, 0x75, 0x8F, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C,
+	0x80, 0x1B, 0x02, 0x05, 0x8D, 0x37, 0x84, 0xAD, 0x08, 0x81, 0x5A, 0x9D, 0x01, 0x17, 0x18, 0x2A,
+	0x3F, 0x42, 0x87, 0x5F, 0x00, 0x5D, 0x80, 0x3F, 0x05, 0x2A, 0x87, 0x5A, 0x29, 0x49, 0x99, 0x85,
+	0xAD, 0x01, 0x39, 0x2A, 0x80, 0x5C, 0x82, 0x75, 0x8E, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80,
+	0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C, 0x80, 0x1B, 0x02, 0x05, 0x8D, 0x39, 0x83, 0xAD, 0x08, 0x86,
+	0x3D, 0x9D, 0x01, 0x18, 0x2A, 0x3F, 0x41, 0x42, 0x89, 0x5F, 0x08, 0x5C, 0x3F, 0x2A, 0x18, 0x01,
+	0x9C, 0x72, 0x29, 0x86, 0x84, 0xAD, 0x03, 0x39, 0x2A, 0x3F, 0x5C, 0x83, 0x75, 0x8D, 0x03, 0x01,
+	0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C, 0x80, 0x1B, 0x02, 0x05, 0x8C,
+	0x39, 0x83, 0xAD, 0x06, 0x25, 0x9D, 0x01, 0x18, 0x2A, 0x41, 0x42, 0x8C, 0x5F, 0x00, 0x5C, 0x80,
+	0x3F, 0x05, 0x2A, 0x17, 0x01, 0x9C, 0x3C, 0x9B, 0x83, 0xAD, 0x03, 0x39, 0x2A, 0x5C, 0x5D, 0x84,
+	0x75, 0x8C, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C, 0x80,
+	0x1B, 0x02, 0xA1, 0x8C, 0x37, 0x83, 0xAD, 0x05, 0xA5, 0x01, 0x18, 0x2A, 0x41, 0x42, 0x8D, 0x5F,
+	0x80, 0x5D, 0x01, 0x5C, 0x3F, 0x80, 0x2A, 0x02, 0x01, 0x9C, 0x27, 0x83, 0xAD, 0x03, 0x39, 0x2A,
+	0x3F, 0x5C, 0x85, 0x75, 0x8B, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15,
+	0x91, 0x1C, 0x80, 0x1B, 0x02, 0xA1, 0x8C, 0xAB, 0x83, 0xAD, 0x03, 0xA4, 0x17, 0x2A, 0x41, 0x8E,
+	0x5F, 0x82, 0x5D, 0x80, 0x5C, 0x03, 0x3F, 0x2A, 0x01, 0xA3, 0x83, 0xAD, 0x03, 0xAB, 0x2A, 0x5C,
+	0x5D, 0x86, 0x75, 0x8A, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91,
+	0x1C, 0x80, 0x1B, 0x02, 0x03, 0x8C, 0x80, 0x83, 0xAD, 0x03, 0x13, 0x17, 0x2A, 0x41, 0x86, 0x5F,
+	0x00, 0x5D, 0x85, 0x5F, 0x80, 0x5D, 0x00, 0x77, 0x80, 0x5D, 0x00, 0x5C, 0x80, 0x3F, 0x01, 0x18,
+	0xA3, 0x83, 0xAD, 0x03, 0x80, 0x2A, 0x5C, 0x5D, 0x87, 0x75, 0x89, 0x03, 0x01, 0x28, 0x86, 0x80,
+	0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C, 0x80, 0x1B, 0x02, 0x03, 0x8C, 0x21, 0x83, 0xAD,
+	0x03, 0x86, 0x18, 0x2A, 0x3F, 0x8C, 0x5F, 0x81, 0x5D, 0x00, 0x77, 0x80, 0x5D, 0x05, 0x5F, 0x5D,
+	0x5C, 0x3F, 0x18, 0xAB, 0x83, 0xAD, 0x02, 0x0C, 0x2A, 0x3F, 0x89, 0x75, 0x88, 0x03, 0x01, 0x28,
+	0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x91, 0x1C, 0x04, 0x1B, 0x05, 0x03, 0x8D, 0x79,
+	0x84, 0xAD, 0x03, 0x4D, 0x2A, 0x3F, 0x5E, 0x83, 0x5F, 0x80, 0x5D, 0x83, 0x5F, 0x83, 0x5D, 0x00,
+	0x77, 0x80, 0x5F, 0x04, 0x5D, 0x5C, 0x3F, 0x18, 0x86, 0x83, 0xAD, 0x02, 0x2D, 0x2A, 0x5C, 0x88,
+	0x75, 0x01, 0x8A, 0x75, 0x87, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15,
+	0x91, 0x1C, 0x05, 0x1B, 0x05, 0x03, 0xA1, 0x5F, 0x55, 0x84, 0xAD, 0x00, 0x0B, 0x80, 0x3F, 0x81,
+	0x5F, 0x81, 0x5D, 0x80, 0x5F, 0x00, 0x5D, 0x80, 0x5F, 0x85, 0x5D, 0x00, 0x5F, 0x80, 0x5D, 0x02,
+	0x5C, 0x3F, 0xAA, 0x83, 0xAD, 0x03, 0x56, 0x00, 0x3F, 0x5C, 0x88, 0x75, 0x02, 0x8A, 0x75, 0x8A,
+	0x86, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x8E, 0x1C, 0x82, 0x1B,
+	0x80, 0x05, 0x02, 0xA1, 0x77, 0x33, 0x85, 0xAD, 0x04, 0x6B, 0x62, 0x3F, 0x41, 0x5F, 0x81, 0x5D,
+	0x81, 0x5C, 0x80, 0x5D, 0x00, 0x5C, 0x84, 0x5D, 0x80, 0x5C, 0x02, 0x3F, 0x79, 0xAA, 0x84, 0xAD,
+	0x03, 0x22, 0x17, 0x3F, 0x5C, 0x86, 0x75, 0x84, 0x8A, 0x85, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD,
+	0x80, 0xAD, 0x01, 0x86, 0x15, 0x8C, 0x1C, 0x85, 0x1B, 0x03, 0x05, 0xA1, 0x8C, 0x61, 0x87, 0xAD,
+	0x00, 0x39, 0x91, 0xA9, 0x00, 0x38, 0x86, 0xAD, 0x03, 0x1A, 0x2A, 0x5C, 0x5D, 0x85, 0x75, 0x01,
+	0x8A, 0x75, 0x84, 0x8A, 0x84, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15,
+	0x89, 0x1C, 0x88, 0x1B, 0x80, 0x03, 0x02, 0x8C, 0x5F, 0x6A, 0xA2, 0xAD, 0x04, 0x4F, 0x00, 0x3F,
+	0x5C, 0x5D, 0x85, 0x75, 0x87, 0x8A, 0x83, 0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01,
+	0x86, 0x15, 0x85, 0x1C, 0x8C, 0x1B, 0x80, 0x03, 0x03, 0xA1, 0x77, 0x43, 0x9A, 0xA0, 0xAD, 0x04,
+	0x9B, 0x04, 0x2A, 0x3F, 0x5C, 0x84, 0x75, 0x01, 0x8A, 0x75, 0x88, 0x8A, 0x82, 0x03, 0x01, 0x28,
+	0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x94, 0x1B, 0x04, 0x03, 0xA1, 0x8C, 0x5F, 0x91,
+	0xA0, 0xAD, 0x03, 0x7B, 0x00, 0x2A, 0x5C, 0x82, 0x75, 0x01, 0x8A, 0x75, 0x8C, 0x8A, 0x81, 0x03,
+	0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x94, 0x1B, 0x80, 0x03, 0x03, 0xA1,
+	0x77, 0x2A, 0x95, 0x9E, 0xAD, 0x04, 0xAB, 0x87, 0x2A, 0x3F, 0x5D, 0x85, 0x75, 0x8C, 0x8A, 0x80,
+	0x03, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x95, 0x1B, 0x05, 0x03, 0xA1,
+	0x8C, 0x5F, 0x18, 0x70, 0x9C, 0xAD, 0x05, 0x70, 0x88, 0x17, 0x2A, 0x5C, 0x5D, 0x83, 0x75, 0x8F,
+	0x8A, 0x02, 0x03, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x93, 0x1B, 0x80, 0x19,
+	0x80, 0x03, 0x04, 0xA1, 0x77, 0x5D, 0x02, 0x86, 0x9A, 0xAD, 0x05, 0x9A, 0x74, 0x00, 0x2A, 0x3F,
+	0x5D, 0x81, 0x75, 0x01, 0x8A, 0x75, 0x91, 0x8A, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01,
+	0x86, 0x15, 0x90, 0x1B, 0x84, 0x19, 0x80, 0x03, 0x04, 0xA0, 0x77, 0x3F, 0x02, 0x70, 0x98, 0xAD,
+	0x05, 0x70, 0x74, 0x00, 0x2A, 0x3F, 0x5C, 0x80, 0x75, 0x00, 0x8A, 0x80, 0x75, 0x92, 0x8A, 0x01,
+	0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x8D, 0x1B, 0x88, 0x19, 0x80, 0x03, 0x04,
+	0x8C, 0x77, 0x3F, 0x89, 0x81, 0x96, 0xAD, 0x05, 0x97, 0x72, 0x00, 0x2A, 0x3F, 0x5C, 0x83, 0x75,
+	0x93, 0x8A, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x8A, 0x1B, 0x8C, 0x19,
+	0x07, 0x03, 0xA1, 0x8C, 0x77, 0x3F, 0x9C, 0x65, 0x9A, 0x92, 0xAD, 0x06, 0x9B, 0x7B, 0x5A, 0x00,
+	0x17, 0x3F, 0x5C, 0x83, 0x75, 0x94, 0x8A, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86,
+	0x15, 0x84, 0x1B, 0x92, 0x19, 0x80, 0x03, 0x06, 0xA1, 0x8C, 0x77, 0x5D, 0x01, 0x76, 0x34, 0x90,
+	0xAD, 0x07, 0x4E, 0x8B, 0x87, 0x16, 0x18, 0x3F, 0x5C, 0x5D, 0x81, 0x75, 0x01, 0x8A, 0x75, 0x92,
+	0x8A, 0x80, 0x9E, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x98, 0x19, 0x81,
+	0x03, 0x00, 0xA1, 0x80, 0x8C, 0x05, 0x5D, 0x2A, 0x5A, 0x76, 0x0D, 0x39, 0x8A, 0xAD, 0x08, 0x56,
+	0x0E, 0x8E, 0x72, 0x9C, 0x16, 0x2A, 0x3F, 0x5C, 0x83, 0x75, 0x96, 0x8A, 0x01, 0x28, 0x86, 0x80,
+	0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x99, 0x19, 0x81, 0x03, 0x80, 0xA1, 0x15, 0x8C, 0x77, 0x3F,
+	0x9C, 0x72, 0x3C, 0x8E, 0x7B, 0x50, 0x97, 0x26, 0x27, 0x39, 0x25, 0x97, 0x6C, 0x7C, 0x8F, 0x3B,
+	0x72, 0x9C, 0x16, 0x80, 0x2A, 0x01, 0x3F, 0x5C, 0x81, 0x75, 0x00, 0x8A, 0x80, 0x75, 0x93, 0x8A,
+	0x81, 0x9E, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9A, 0x19, 0x82, 0x03,
+	0x00, 0xA1, 0x80, 0x8C, 0x06, 0x5D, 0x01, 0x00, 0x9C, 0x72, 0x5A, 0x59, 0x80, 0x3C, 0x01, 0x3B,
+	0x3C, 0x80, 0x5A, 0x08, 0x72, 0x9C, 0x00, 0x16, 0x17, 0x2A, 0x3F, 0x5C, 0x5D, 0x84, 0x75, 0x93,
+	0x8A, 0x81, 0x9E, 0x02, 0xA0, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9C, 0x19,
+	0x81, 0x03, 0x80, 0xA1, 0x02, 0xA0, 0x75, 0x18, 0x80, 0x17, 0x00, 0x01, 0x84, 0x00, 0x81, 0x17,
+	0x00, 0x2A, 0x80, 0x3F, 0x80, 0x5C, 0x00, 0x5D, 0x83, 0x75, 0x94, 0x8A, 0x80, 0x9E, 0x80, 0x8A,
+	0x02, 0x9E, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9D, 0x19, 0x83, 0x03, 0x02,
+	0xA1, 0x8C, 0x3F, 0x87, 0x2A, 0x81, 0x3F, 0x00, 0x5C, 0x80, 0x5D, 0x82, 0x75, 0x01, 0x8A, 0x75,
+	0x80, 0x8A, 0x00, 0x75, 0x90, 0x8A, 0x01, 0x9E, 0x8A, 0x82, 0x9E, 0x02, 0xA0, 0x28, 0x86, 0x80,
+	0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0x9F, 0x19, 0x83, 0x03, 0x00, 0xA1, 0x80, 0x5C, 0x01, 0x3F,
+	0x5C, 0x80, 0x3F, 0x83, 0x5C, 0x00, 0x5D, 0x85, 0x75, 0x01, 0x8A, 0x75, 0x94, 0x8A, 0x81, 0x9E,
+	0x04, 0xA0, 0x9E, 0xA0, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x01, 0x86, 0x15, 0xA1, 0x19, 0x82,
+	0x03, 0x00, 0xA1, 0x81, 0x5C, 0x80, 0x5D, 0x01, 0x75, 0x5D, 0x88, 0x75, 0x94, 0x8A, 0x00, 0x9E,
+	0x81, 0x8A, 0x00, 0xA0, 0x80, 0x9E, 0x80, 0xA0, 0x01, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x02,
+	0x86, 0x15, 0x05, 0xA4, 0x19, 0x80, 0x03, 0x8B, 0x75, 0x80, 0x8A, 0x80, 0x75, 0x95, 0x8A, 0x03,
+	0xA0, 0x9E, 0xA0, 0x9E, 0x80, 0xA0, 0x02, 0x8C, 0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x02, 0x86,
+	0x28, 0x90, 0xA6, 0x19, 0x00, 0x03, 0x8C, 0x75, 0x95, 0x8A, 0x83, 0x9E, 0x81, 0xA0, 0x02, 0x7A,
+	0x28, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x03, 0x86, 0x3A, 0x0D, 0x03, 0xA3, 0x19, 0x82, 0x03, 0x87,
+	0x75, 0x00, 0x8A, 0x80, 0x75, 0x80, 0x8A, 0x00, 0x75, 0x92, 0x8A, 0x01, 0x9E, 0x8A, 0x81, 0x9E,
+	0x81, 0xA0, 0x03, 0x8A, 0xA6, 0x3A, 0x86, 0x80, 0xAD, 0x80, 0xAD, 0x04, 0x9B, 0x58, 0x98, 0x7A,
+	0x03, 0xA1, 0x19, 0x84, 0x03, 0x86, 0x75, 0x98, 0x8A, 0x80, 0x9E, 0x83, 0xA0, 0x04, 0x8A, 0x44,
+	0x98, 0x58, 0x9B, 0x80, 0xAD, 0x80, 0xAD, 0x07, 0x9B, 0x71, 0x15, 0x51, 0x63, 0x8C, 0xA1, 0x03,
+	0x9C, 0x19, 0x87, 0x03, 0x86, 0x75, 0x94, 0x8A, 0x80, 0x9E, 0x01, 0x8A, 0x9E, 0x80, 0xA0, 0x08,
+	0x9E, 0x8A, 0x75, 0x5C, 0x44, 0x52, 0x15, 0x71, 0x9B, 0x80, 0xAD, 0x81, 0xAD, 0x06, 0x9B, 0x58,
+	0xAC, 0x53, 0x92, 0x64, 0x60, 0xA5, 0x5C, 0x00, 0x3F, 0x8F, 0x16, 0x84, 0x17, 0x8B, 0x2A, 0x06,
+	0x2B, 0x46, 0x7C, 0x53, 0xAC, 0x58, 0x9B, 0x81, 0xAD, 0x82, 0xAD, 0x05, 0x86, 0x58, 0x15, 0x83,
+	0x53, 0x36, 0xCA, 0x24, 0x05, 0x36, 0x53, 0x83, 0x15, 0x58, 0x86, 0x82, 0xAD, 0x82, 0xAD, 0x04,
+	0x9B, 0x86, 0x71, 0x3A, 0x15, 0x80, 0xAC, 0xC8, 0x98, 0x80, 0xAC, 0x03, 0x15, 0x3A, 0x71, 0x86,
+	0x83, 0xAD, 0x84, 0xAD, 0x00, 0x9B, 0x80, 0x86, 0x81, 0x71, 0xC7, 0x58, 0x80, 0x71, 0x80, 0x86,
+	0x00, 0x9B, 0x84, 0xAD
+};
+
+const CompressedIcon connectedIcon = {96, 67, 174, palette, data};
@@ -2,810 +2,205 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t historyIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x59C6,
-	0x779D, 0xF484, 0xB37C, 0xB37C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x9374, 0x9374, 0x9374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7274, 0x7274, 0x5274, 0x5274, 0xB47C, 0x569D,
-	0x39BE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x5DE7, 0x3595, 0x7374,
-	0x7274, 0x526C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0x1164,
-	0x326C, 0xF48C, 0x5DE7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1595, 0x5274, 0x526C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0x1164, 0xF48C, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x19BE, 0x5274, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0x1164, 0x18B6, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0xF48C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xB384, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x7374, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0x1164, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x126C, 0x7374, 0xF48C, 0x569D, 0xB7A5, 0xD8AD, 0xF8B5,
-	0x18B6, 0xF8B5, 0xD8AD, 0xD7AD, 0x769D, 0x1595, 0xB37C, 0x326C,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0xF48C,
-	0x19B6, 0x3CE7, 0xBEF7, 0xBFF7, 0xDFFF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xDFF7, 0xBEF7, 0x9EEF,
-	0xBBCE, 0x769D, 0x5274, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x7374, 0xD484, 0x18B6, 0x7DEF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0xBBCE, 0x569D, 0x737C, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xD484, 0xF8B5, 0x326C, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x5374, 0x97A5, 0xBBCE, 0xBFF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3CE7, 0x18B6, 0xD484,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF484, 0x7DEF, 0xDFFF, 0x19BE, 0x1164, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x769D, 0x5DE7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EEF,
-	0x18B6, 0x126C, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0x937C,
-	0x1CDF, 0xFFFF, 0xFFFF, 0xDFFF, 0x59C6, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x937C, 0xBBCE,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x7EEF, 0x158D, 0x116C, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0x326C, 0xDBD6,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x116C, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x7374, 0xD7AD, 0x9EF7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CDF, 0x79CE, 0x18BE, 0xB7AD, 0x76A5,
-	0x76A5, 0x76A5, 0x96AD, 0xF7B5, 0x39C6, 0xBBD6, 0x7DEF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x18B6, 0x5274, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0x5274, 0x9ACE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EEF, 0x9384, 0xD15B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x7374, 0xBBCE, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF,
-	0x79C6, 0xD394, 0xF06B, 0x8F63, 0x6E5B, 0x2E53, 0x0D53, 0x0D4B,
-	0x0D4B, 0x0D4B, 0x0D4B, 0x2D53, 0x4E53, 0x6E5B, 0xAF63, 0x517C,
-	0xB7AD, 0x5DEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x1CDF, 0x937C, 0xF163, 0xF163,
-	0x1164, 0x1164, 0xF163, 0xF163, 0x326C, 0x7AC6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x76A5, 0x8F5B, 0x8F5B,
-	0xD15B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0xD484, 0x9EEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x76A5, 0x4E5B,
-	0xEC4A, 0x0D4B, 0x2D53, 0x2E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x2E53, 0x2E53, 0x0D4B,
-	0x0D4B, 0x0D4B, 0x9284, 0xFBDE, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF, 0xD484, 0xF163,
-	0xF163, 0xF163, 0xF163, 0x1164, 0xF8B5, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD7B5, 0x2E4B, 0x6F53, 0x8F5B,
-	0x8F5B, 0xF15B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0xD484, 0x5DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0xDBD6, 0x149D, 0x6E5B, 0x0D4B, 0x2E53,
-	0x4E53, 0x4E53, 0x6E53, 0x6E53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x0D4B, 0x0D4B, 0x9284, 0x59C6, 0xDFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF, 0x1595,
-	0xF163, 0xF163, 0xF163, 0x97A5, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0xF8BD, 0x4E53, 0x4E53, 0x6F53, 0x8F5B,
-	0x905B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x1164, 0x326C, 0x18B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xBEF7, 0x359D, 0x8F63, 0x0D53, 0x2E53, 0x4E53, 0x6E53,
-	0x6F53, 0x6F5B, 0x6F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x6F5B,
-	0x6F53, 0x6E53, 0x4E53, 0x2E53, 0x0D4B, 0x6E5B, 0x9284, 0x3CE7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EEF,
-	0x3595, 0xF163, 0x97A5, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x9ACE, 0x8F5B, 0x4E53, 0x6F53, 0x8F53, 0x8F5B,
-	0x905B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x1164, 0xF163, 0x8F5B, 0xF8B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xDBDE, 0x6E5B, 0x0D4B, 0x2E53, 0x4E53, 0x6E53, 0x6F5B, 0x6F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x905B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x6F5B, 0x6F53, 0x6F53, 0x4E53, 0x4E53, 0x0D4B, 0x8F5B,
-	0x9ACE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xBEF7, 0x39BE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x7DEF, 0x6E5B, 0x2E53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x1164, 0x1164, 0xF163, 0xAF5B, 0xD7B5, 0xBEF7, 0xDFF7, 0xB7AD,
-	0x6E5B, 0x2E53, 0x4E53, 0x6E53, 0x6F5B, 0x6F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x905B, 0x905B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x6F53, 0x6F53, 0x4E53, 0x2E53,
-	0x4E53, 0xD7B5, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFCDE, 0x8F63, 0x2E53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF15B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x1164, 0xF163, 0xD063, 0xD063, 0x96AD, 0xD38C, 0x4E53,
-	0x2E53, 0x6E53, 0x6F53, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xAF5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F53, 0x6F53, 0x4E53,
-	0x2E53, 0x2D53, 0x149D, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DE7,
-	0x3174, 0x2E53, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF15B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x1164, 0xF163, 0xF163, 0xD063, 0x8F5B, 0x2E53, 0x4E53,
-	0x6E53, 0x6F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0xAF5B, 0xB05B, 0xAF5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x3274,
-	0x18B6, 0xB05B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x8F5B, 0x8F5B, 0x6F53,
-	0x6F53, 0x4E53, 0x2D53, 0x359D, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9284,
-	0x2E4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF15B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xD063, 0x6F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0xAF5B, 0xAF5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x3274, 0xDBD6,
-	0xFFFF, 0xDBD6, 0x316C, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x8F5B,
-	0x6F53, 0x6F53, 0x4E53, 0x2D4B, 0x76A5, 0xDFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0xF494, 0x2D4B,
-	0x4E53, 0x6F53, 0x8F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xF15B, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163,
-	0x8F5B, 0x8F5B, 0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x727C, 0x1CDF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBACE, 0x3174, 0x8F5B, 0xB05B, 0xAF5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B,
-	0x8F5B, 0x8F53, 0x6F53, 0x4E53, 0x4E5B, 0x7DEF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559D, 0x0D4B, 0x4E53,
-	0x6F53, 0x8F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xF15B, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xAF5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0x905B, 0x905B, 0x8F5B, 0x5274, 0x1CDF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBACE, 0xD063, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x8F5B, 0x6F53, 0x6F5B, 0x7AC6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB7AD, 0x4E53, 0x6F53,
-	0x8F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xF15B, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1164, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x3174, 0xDBD6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBBD6, 0xF16B, 0x8F5B, 0xAF5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0x8F5B, 0xB05B, 0xD7AD, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x3174, 0x6F53,
-	0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xF15B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1164, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x905B, 0x8F5B, 0x727C, 0xFBDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9ACE, 0x3274, 0xAF5B,
-	0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x8F5B, 0x559D, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDBD6, 0xB05B,
-	0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0xB05B, 0xB05B, 0xB05B, 0x905B,
-	0x8F5B, 0x527C, 0x1CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9ACE, 0xF063,
-	0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xAF5B,
-	0x8F5B, 0xD48C, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xF48C,
-	0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0xB05B, 0x8F5B, 0x8F5B,
-	0x3174, 0xDBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9ACE,
-	0xF063, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x905B,
-	0x937C, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xBEF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7ACE,
-	0xD063, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0xF163, 0x8F5B, 0x527C,
-	0xDBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9ACE, 0x116C, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x727C,
-	0x1CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF,
-	0x7284, 0xD7B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EEF,
-	0x9384, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0xB384, 0x1CDF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF,
-	0xB6AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x79C6, 0xF163, 0x8F5B, 0xAF5B, 0x8F5B, 0xD063, 0xDBD6,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x527C,
-	0x0D4B, 0x517C, 0x7EEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xD7AD, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x937C, 0x1CDF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7284,
-	0xEC4A, 0x9284, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x59C6, 0xB05B, 0x8F5B, 0xB05B, 0xDBD6, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0xF494, 0x2D4B,
-	0x2E4B, 0x2E53, 0x9ACE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x5DE7, 0xB05B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x937C, 0xFCDE, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DE7, 0x527C, 0x0D4B,
-	0x2E53, 0x0D4B, 0xB38C, 0x7DEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x59C6, 0x5274, 0x18BE, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x76A5, 0x4E53, 0x2E53,
-	0x4E53, 0x2E53, 0x7284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xB384, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0xB484, 0x3CDF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE7, 0x527C, 0x0D4B, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0xD38C, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3DE7, 0xDFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x96AD, 0x4E53, 0x4E53, 0x6F53,
-	0x6F53, 0x4E53, 0x4E53, 0x3DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x9ACE, 0x8F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x937C, 0x1CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x727C, 0x2D4B, 0x4E53, 0x6F53,
-	0x6F53, 0x4E53, 0x4E53, 0x0D4B, 0x9384, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x18BE, 0x2E53, 0x4E53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x4E53, 0x359D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xD063, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x937C, 0xFBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x5DE7, 0x7284, 0x2D4B, 0x4E53, 0x6F53, 0x6F53,
-	0x8F5B, 0x6F53, 0x6F53, 0x4E53, 0x2D4B, 0xD38C, 0x7DEF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x9ACE, 0xAF63, 0x4E53, 0x6F53, 0x8F53, 0x8F5B,
-	0x8F5B, 0x8F53, 0x6F53, 0xD063, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xD48C, 0x8F53, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xD484, 0x3CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x3CE7, 0x527C, 0x2D4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x6F53, 0x4E53, 0x4E53, 0xD494, 0xBEF7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x1CE7, 0xD063, 0x2E53, 0x6F53, 0x8F53, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x6F53, 0x8F5B, 0xBAD6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xD7AD, 0x8F53, 0x905B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x937C,
-	0x3CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9EF7, 0x527C, 0x2D53, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0x905B,
-	0x905B, 0x8F5B, 0x8F5B, 0x8F5B, 0x6F53, 0x4E53, 0x2D4B, 0xD38C,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x5DEF, 0x6E5B, 0x2E53, 0x6F53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B,
-	0x905B, 0x8F5B, 0x6F53, 0x6F53, 0xB7AD, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x9ACE, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x937C, 0xFBD6,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF,
-	0x7284, 0x2D4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xAF5B, 0x8F5B, 0x8F5B, 0x6F53, 0x4E53, 0x0D4B,
-	0xF494, 0x9EEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF,
-	0x517C, 0x2E53, 0x6F53, 0x6F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0x8F5B, 0x8F53, 0x6F53, 0xD48C, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x1CDF, 0x116C, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xD484, 0x1CDF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3CE7, 0x527C,
-	0x2D4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x8F5B, 0x8F5B, 0x6F53, 0x4E53,
-	0x4E53, 0x1495, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xB38C,
-	0x4E53, 0x4E53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x6F53, 0x527C, 0x7DEF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x5DEF, 0x727C, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x937C, 0x3CDF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EEF, 0x527C, 0x2D4B,
-	0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x8F5B, 0x6F53,
-	0x4E53, 0x2E53, 0x159D, 0xFFFF, 0xFFFF, 0xFFFF, 0xD48C, 0x2E53,
-	0x4E53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x6F53, 0xF16B, 0x1CDF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0xB384, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0x937C, 0xFCD6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF, 0x7284, 0x2D4B, 0x4E53,
-	0x6F53, 0x8F5B, 0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x8F53,
-	0x6F53, 0x4E53, 0x0D4B, 0x359D, 0x7DEF, 0x55A5, 0x2D4B, 0x4E53,
-	0x6F53, 0x8F53, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x8F53, 0xAF5B, 0xDBD6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x1495, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xB05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xB484, 0x1CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x3CE7, 0x527C, 0x2D4B, 0x4E53, 0x6F53,
-	0x8F5B, 0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xAF5B, 0x8F5B,
-	0x8F53, 0x6F53, 0x4E53, 0x2E53, 0x317C, 0x6F5B, 0x4E53, 0x6F53,
-	0x8F53, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0x8F53, 0x6F53, 0xD38C, 0x55A5, 0x55A5,
-	0x559D, 0x55A5, 0x76A5, 0x3174, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xB37C, 0x3CDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x7DEF, 0x527C, 0x2D53, 0x4E53, 0x6F53, 0x8F5B,
-	0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x8F5B, 0x6F53, 0x6F53, 0x4E53, 0x4E53, 0x6F53, 0x8F53,
-	0x8F5B, 0xAF5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x6F53, 0x4E53, 0x2D4B, 0x0D4B,
-	0x0D4B, 0x2D4B, 0x2E4B, 0x6F53, 0x8F53, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0x937C, 0xFCDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x9EF7, 0x7284, 0x0D4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B,
-	0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x905B, 0x8F5B, 0x8F5B, 0x8F53, 0x6F53, 0x8F53, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F53, 0x6F53, 0x6F53, 0x4E53,
-	0x4E53, 0x6F53, 0x6F53, 0x8F53, 0x905B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xD05B, 0x3174, 0xBBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x3CE7, 0x527C, 0x0D4B, 0x4E53, 0x6F53, 0x8F53, 0x8F5B, 0xB05B,
-	0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x8F5B, 0x8F53, 0x8F53, 0x8F53,
-	0x6F53, 0x8F53, 0x8F53, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xD163, 0xB05B, 0xD063, 0x9ACE, 0xFFFF, 0xFFFF, 0x5DE7,
-	0x527C, 0x2D4B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x905B, 0x905B,
-	0x905B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xD05B, 0x8F5B, 0xF06B, 0xDBD6, 0xBEF7, 0x727C,
-	0x2D4B, 0x4E53, 0x6F53, 0x8F53, 0x8F5B, 0x8F5B, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD05B, 0xB05B, 0x8F5B, 0xF06B, 0x527C, 0x2E53,
-	0x4E53, 0x6F53, 0x8F53, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xD05B, 0xD05B, 0xAF5B, 0x6E53, 0x6E53,
-	0x6F53, 0x6F53, 0x8F5B, 0x905B, 0x905B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xD163, 0xD05B, 0xD05B, 0xB05B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xB05B, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0x1164, 0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xAF5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xD05B, 0x905B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x5274, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0x3174, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0x55A5, 0xF163, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xB05B, 0x559D, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDBDE, 0x3174, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xD05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0x116C, 0xDBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x38C6, 0x116C, 0xD05B,
-	0xD163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xD05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xB05B,
-	0x8F5B, 0xF16B, 0x59C6, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x79CE, 0x149D,
-	0x527C, 0xD063, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x6F53, 0x2E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0xB05B, 0x3174,
-	0xF494, 0x79CE, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[129] = {
+	0x0D4B, 0x0D53, 0x1164, 0x116C, 0x1264, 0x126C, 0x1495, 0x149D,
+	0x158D, 0x1595, 0x159D, 0x18B6, 0x18BE, 0x19B6, 0x19BE, 0x1CDF,
+	0x1CE7, 0x2D4B, 0x2D53, 0x2E4B, 0x2E53, 0x316C, 0x3174, 0x317C,
+	0x326C, 0x3274, 0x3595, 0x359D, 0x38C6, 0x39BE, 0x39C6, 0x3CDF,
+	0x3CE7, 0x3DE7, 0x4E53, 0x4E5B, 0x517C, 0x526C, 0x5274, 0x527C,
+	0x5374, 0x559D, 0x55A5, 0x569D, 0x59C6, 0x59CE, 0x5DE7, 0x5DEF,
+	0x6E53, 0x6E5B, 0x6F53, 0x6F5B, 0x7274, 0x727C, 0x7284, 0x7374,
+	0x737C, 0x769D, 0x76A5, 0x779D, 0x79C6, 0x79CE, 0x7AC6, 0x7ACE,
+	0x7DEF, 0x7EEF, 0x8F53, 0x8F5B, 0x8F63, 0x905B, 0x9284, 0x9374,
+	0x937C, 0x9384, 0x96AD, 0x97A5, 0x9ACE, 0x9EEF, 0x9EF7, 0xAF5B,
+	0xAF63, 0xB05B, 0xB37C, 0xB384, 0xB38C, 0xB47C, 0xB484, 0xB6AD,
+	0xB7A5, 0xB7AD, 0xBACE, 0xBAD6, 0xBBCE, 0xBBD6, 0xBEF7, 0xBFF7,
+	0xD05B, 0xD063, 0xD15B, 0xD163, 0xD38C, 0xD394, 0xD484, 0xD48C,
+	0xD494, 0xD7AD, 0xD7B5, 0xD8AD, 0xDBD6, 0xDBDE, 0xDFF7, 0xDFFF,
+	0xEC4A, 0xF063, 0xF06B, 0xF15B, 0xF163, 0xF16B, 0xF484, 0xF48C,
+	0xF494, 0xF7B5, 0xF8B5, 0xF8BD, 0xFBD6, 0xFBDE, 0xFCD6, 0xFCDE,
+	0xFFFF
 };
+
+static const uint8_t data[2815] = {
+	0x83, 0x80, 0x04, 0x6F, 0x5E, 0x2C, 0x3B, 0x76, 0x80, 0x52, 0x9D, 0x48, 0x81, 0x47, 0xA2, 0x37,
+	0x80, 0x34, 0x80, 0x26, 0x03, 0x55, 0x2B, 0x1D, 0x5E, 0x84, 0x80, 0x82, 0x80, 0x05, 0x6F, 0x2E,
+	0x1A, 0x37, 0x34, 0x25, 0xA1, 0x18, 0x82, 0x05, 0x86, 0x04, 0x91, 0x02, 0x89, 0x74, 0x04, 0x02,
+	0x18, 0x77, 0x2E, 0x6F, 0x82, 0x80, 0x81, 0x80, 0x04, 0x6F, 0x4E, 0x09, 0x26, 0x25, 0xA3, 0x18,
+	0x82, 0x05, 0x85, 0x04, 0x92, 0x02, 0x8B, 0x74, 0x02, 0x02, 0x77, 0x4E, 0x82, 0x80, 0x81, 0x80,
+	0x02, 0x5E, 0x0E, 0x26, 0xA5, 0x18, 0x81, 0x05, 0x86, 0x04, 0x91, 0x02, 0x8D, 0x74, 0x02, 0x02,
+	0x0B, 0x5E, 0x81, 0x80, 0x80, 0x80, 0x02, 0x6F, 0x4E, 0x77, 0xA5, 0x18, 0x82, 0x05, 0x86, 0x04,
+	0x91, 0x02, 0x8E, 0x74, 0x02, 0x53, 0x4E, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x02, 0x6F, 0x2F, 0x37,
+	0xA5, 0x18, 0x81, 0x05, 0x86, 0x04, 0x92, 0x02, 0x8E, 0x74, 0x02, 0x02, 0x2F, 0x6F, 0x80, 0x80,
+	0x80, 0x80, 0x01, 0x5E, 0x20, 0xA5, 0x18, 0x81, 0x05, 0x87, 0x04, 0x91, 0x02, 0x90, 0x74, 0x01,
+	0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x20, 0xA5, 0x18, 0x81, 0x05, 0x87, 0x04, 0x91,
+	0x02, 0x90, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0xA4, 0x18, 0x81,
+	0x05, 0x87, 0x04, 0x92, 0x02, 0x90, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E,
+	0x10, 0xA4, 0x18, 0x81, 0x05, 0x87, 0x04, 0x92, 0x02, 0x90, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80,
+	0x80, 0x80, 0x01, 0x5E, 0x10, 0x9D, 0x18, 0x81, 0x05, 0x00, 0x04, 0x82, 0x02, 0x00, 0x04, 0x84,
+	0x02, 0x81, 0x04, 0x92, 0x02, 0x91, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E,
+	0x10, 0x9A, 0x18, 0x80, 0x05, 0x0D, 0x37, 0x77, 0x2B, 0x58, 0x6B, 0x7A, 0x0B, 0x7A, 0x6B, 0x69,
+	0x39, 0x09, 0x52, 0x18, 0x97, 0x02, 0x91, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x99, 0x18, 0x04, 0x77, 0x0D, 0x20, 0x5E, 0x5F, 0x80, 0x6F, 0x84, 0x80, 0x06, 0x6F,
+	0x6E, 0x5E, 0x4D, 0x5C, 0x39, 0x26, 0x93, 0x02, 0x92, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80,
+	0x80, 0x01, 0x5E, 0x10, 0x95, 0x18, 0x03, 0x37, 0x66, 0x0B, 0x40, 0x91, 0x80, 0x03, 0x6F, 0x5C,
+	0x2B, 0x38, 0x90, 0x02, 0x03, 0x74, 0x66, 0x7A, 0x18, 0x8E, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80,
+	0x80, 0x80, 0x01, 0x5E, 0x10, 0x93, 0x18, 0x03, 0x28, 0x4B, 0x5C, 0x5F, 0x96, 0x80, 0x02, 0x20,
+	0x0B, 0x66, 0x8C, 0x02, 0x80, 0x74, 0x04, 0x76, 0x40, 0x6F, 0x0E, 0x02, 0x8D, 0x74, 0x01, 0x20,
+	0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x92, 0x18, 0x02, 0x39, 0x2E, 0x6F, 0x9A, 0x80,
+	0x02, 0x41, 0x0B, 0x05, 0x89, 0x02, 0x80, 0x74, 0x01, 0x48, 0x0F, 0x80, 0x80, 0x01, 0x6F, 0x2C,
+	0x8D, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x90, 0x18, 0x01, 0x48,
+	0x5C, 0x9F, 0x80, 0x02, 0x41, 0x08, 0x03, 0x86, 0x02, 0x80, 0x74, 0x01, 0x18, 0x6C, 0x83, 0x80,
+	0x01, 0x1D, 0x03, 0x8B, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8E,
+	0x18, 0x02, 0x37, 0x69, 0x4E, 0x89, 0x80, 0x04, 0x5E, 0x0F, 0x3D, 0x0C, 0x59, 0x81, 0x3A, 0x04,
+	0x4A, 0x79, 0x1E, 0x5D, 0x40, 0x89, 0x80, 0x02, 0x5E, 0x0B, 0x26, 0x84, 0x02, 0x80, 0x74, 0x01,
+	0x26, 0x4C, 0x84, 0x80, 0x02, 0x41, 0x49, 0x62, 0x8A, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80,
+	0x80, 0x01, 0x5E, 0x10, 0x8C, 0x18, 0x03, 0x05, 0x37, 0x5C, 0x6F, 0x87, 0x80, 0x07, 0x6F, 0x3C,
+	0x65, 0x72, 0x44, 0x31, 0x14, 0x01, 0x82, 0x00, 0x06, 0x12, 0x22, 0x31, 0x50, 0x24, 0x59, 0x2F,
+	0x88, 0x80, 0x01, 0x0F, 0x48, 0x80, 0x74, 0x80, 0x02, 0x80, 0x74, 0x01, 0x18, 0x3E, 0x85, 0x80,
+	0x00, 0x3A, 0x80, 0x43, 0x00, 0x62, 0x89, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x8C, 0x18, 0x01, 0x66, 0x4D, 0x86, 0x80, 0x07, 0x6F, 0x2F, 0x3A, 0x23, 0x70, 0x00,
+	0x12, 0x14, 0x87, 0x22, 0x80, 0x14, 0x81, 0x00, 0x02, 0x46, 0x7D, 0x6E, 0x86, 0x80, 0x01, 0x40,
+	0x66, 0x82, 0x74, 0x01, 0x02, 0x7A, 0x85, 0x80, 0x02, 0x6A, 0x13, 0x32, 0x80, 0x43, 0x00, 0x73,
+	0x88, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8B, 0x18, 0x01, 0x66,
+	0x2E, 0x85, 0x80, 0x05, 0x6F, 0x6C, 0x07, 0x31, 0x00, 0x14, 0x80, 0x22, 0x80, 0x30, 0x87, 0x32,
+	0x00, 0x30, 0x82, 0x22, 0x80, 0x00, 0x02, 0x46, 0x2C, 0x6F, 0x85, 0x80, 0x01, 0x2F, 0x09, 0x81,
+	0x74, 0x01, 0x4B, 0x6F, 0x83, 0x80, 0x01, 0x6F, 0x7B, 0x80, 0x22, 0x03, 0x32, 0x43, 0x45, 0x51,
+	0x88, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8A, 0x18, 0x02, 0x02,
+	0x18, 0x0B, 0x84, 0x80, 0x07, 0x5E, 0x1B, 0x44, 0x01, 0x14, 0x22, 0x30, 0x32, 0x80, 0x33, 0x8A,
+	0x43, 0x08, 0x33, 0x32, 0x30, 0x22, 0x14, 0x00, 0x31, 0x46, 0x20, 0x85, 0x80, 0x04, 0x4D, 0x1A,
+	0x74, 0x4B, 0x6E, 0x84, 0x80, 0x06, 0x4C, 0x43, 0x22, 0x32, 0x42, 0x43, 0x45, 0x80, 0x51, 0x87,
+	0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8A, 0x18, 0x03, 0x02, 0x74,
+	0x43, 0x7A, 0x82, 0x80, 0x05, 0x6D, 0x31, 0x00, 0x14, 0x22, 0x30, 0x80, 0x33, 0x87, 0x43, 0x00,
+	0x45, 0x85, 0x43, 0x00, 0x33, 0x80, 0x32, 0x80, 0x22, 0x02, 0x00, 0x43, 0x4C, 0x85, 0x80, 0x02,
+	0x5E, 0x1D, 0x5E, 0x84, 0x80, 0x02, 0x40, 0x31, 0x14, 0x80, 0x32, 0x80, 0x43, 0x82, 0x51, 0x00,
+	0x63, 0x85, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x89, 0x18, 0x00,
+	0x05, 0x80, 0x02, 0x09, 0x74, 0x4F, 0x6A, 0x5E, 0x6E, 0x59, 0x31, 0x14, 0x22, 0x30, 0x80, 0x33,
+	0x83, 0x43, 0x00, 0x4F, 0x83, 0x51, 0x00, 0x4F, 0x81, 0x51, 0x81, 0x45, 0x82, 0x43, 0x80, 0x32,
+	0x04, 0x22, 0x14, 0x22, 0x6A, 0x5E, 0x8B, 0x80, 0x02, 0x7F, 0x44, 0x14, 0x80, 0x32, 0x80, 0x43,
+	0x84, 0x51, 0x00, 0x73, 0x84, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10,
+	0x89, 0x18, 0x80, 0x05, 0x01, 0x02, 0x74, 0x80, 0x61, 0x05, 0x4A, 0x64, 0x22, 0x14, 0x30, 0x32,
+	0x83, 0x43, 0x86, 0x51, 0x00, 0x4F, 0x86, 0x51, 0x00, 0x4F, 0x81, 0x43, 0x06, 0x42, 0x32, 0x22,
+	0x14, 0x12, 0x07, 0x4E, 0x89, 0x80, 0x04, 0x21, 0x16, 0x14, 0x22, 0x32, 0x80, 0x43, 0x86, 0x51,
+	0x00, 0x73, 0x83, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8A, 0x18,
+	0x01, 0x05, 0x02, 0x80, 0x74, 0x05, 0x61, 0x43, 0x14, 0x22, 0x30, 0x33, 0x81, 0x43, 0x02, 0x4F,
+	0x51, 0x4F, 0x84, 0x51, 0x04, 0x45, 0x19, 0x0B, 0x51, 0x4F, 0x87, 0x51, 0x81, 0x43, 0x80, 0x32,
+	0x03, 0x22, 0x12, 0x1B, 0x6F, 0x87, 0x80, 0x04, 0x6F, 0x46, 0x13, 0x22, 0x32, 0x80, 0x43, 0x00,
+	0x45, 0x87, 0x51, 0x00, 0x73, 0x82, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E,
+	0x10, 0x8B, 0x18, 0x80, 0x02, 0x81, 0x74, 0x01, 0x61, 0x33, 0x82, 0x43, 0x80, 0x4F, 0x84, 0x51,
+	0x07, 0x45, 0x43, 0x19, 0x6C, 0x80, 0x6C, 0x15, 0x43, 0x88, 0x51, 0x80, 0x43, 0x80, 0x32, 0x03,
+	0x22, 0x11, 0x3A, 0x6E, 0x85, 0x80, 0x06, 0x5E, 0x78, 0x11, 0x22, 0x32, 0x42, 0x43, 0x8A, 0x51,
+	0x00, 0x73, 0x81, 0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8C, 0x18,
+	0x83, 0x02, 0x00, 0x74, 0x81, 0x43, 0x00, 0x4F, 0x85, 0x51, 0x03, 0x45, 0x43, 0x35, 0x0F, 0x81,
+	0x80, 0x04, 0x5A, 0x16, 0x43, 0x51, 0x4F, 0x86, 0x51, 0x80, 0x43, 0x04, 0x42, 0x32, 0x22, 0x23,
+	0x40, 0x85, 0x80, 0x06, 0x29, 0x00, 0x22, 0x32, 0x42, 0x43, 0x45, 0x8B, 0x51, 0x00, 0x73, 0x80,
+	0x74, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8D, 0x18, 0x00, 0x04, 0x82,
+	0x02, 0x00, 0x74, 0x80, 0x4F, 0x84, 0x51, 0x80, 0x45, 0x02, 0x43, 0x26, 0x0F, 0x83, 0x80, 0x02,
+	0x5A, 0x61, 0x43, 0x88, 0x51, 0x80, 0x43, 0x02, 0x32, 0x33, 0x3E, 0x86, 0x80, 0x05, 0x59, 0x22,
+	0x32, 0x42, 0x43, 0x45, 0x8D, 0x51, 0x03, 0x73, 0x74, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x8B, 0x18, 0x85, 0x05, 0x01, 0x04, 0x02, 0x86, 0x51, 0x02, 0x43, 0x16, 0x6C, 0x85,
+	0x80, 0x03, 0x5D, 0x75, 0x43, 0x4F, 0x87, 0x51, 0x03, 0x43, 0x51, 0x69, 0x6F, 0x86, 0x80, 0x04,
+	0x6F, 0x16, 0x32, 0x43, 0x45, 0x8F, 0x51, 0x02, 0x73, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x88, 0x18, 0x87, 0x05, 0x81, 0x04, 0x00, 0x02, 0x83, 0x51, 0x03, 0x45, 0x43, 0x35,
+	0x7D, 0x87, 0x80, 0x03, 0x4C, 0x19, 0x4F, 0x45, 0x85, 0x51, 0x80, 0x43, 0x01, 0x29, 0x4E, 0x88,
+	0x80, 0x01, 0x6C, 0x51, 0x80, 0x43, 0x90, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x86, 0x18, 0x86, 0x05, 0x85, 0x04, 0x00, 0x02, 0x81, 0x51, 0x03, 0x45, 0x43, 0x27,
+	0x0F, 0x89, 0x80, 0x02, 0x4C, 0x71, 0x43, 0x84, 0x51, 0x03, 0x4F, 0x43, 0x67, 0x5E, 0x89, 0x80,
+	0x02, 0x6F, 0x77, 0x43, 0x91, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10,
+	0x80, 0x18, 0x8A, 0x05, 0x88, 0x04, 0x01, 0x02, 0x51, 0x80, 0x43, 0x01, 0x16, 0x6C, 0x8B, 0x80,
+	0x02, 0x4C, 0x71, 0x43, 0x82, 0x51, 0x80, 0x45, 0x01, 0x48, 0x6F, 0x84, 0x80, 0x80, 0x5E, 0x83,
+	0x80, 0x02, 0x3F, 0x61, 0x43, 0x90, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E,
+	0x10, 0x88, 0x05, 0x8C, 0x04, 0x04, 0x02, 0x74, 0x43, 0x27, 0x6C, 0x8D, 0x80, 0x02, 0x4C, 0x03,
+	0x43, 0x81, 0x51, 0x02, 0x43, 0x35, 0x0F, 0x84, 0x80, 0x02, 0x40, 0x36, 0x6A, 0x83, 0x80, 0x02,
+	0x4D, 0x49, 0x43, 0x90, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x84,
+	0x05, 0x8F, 0x04, 0x81, 0x02, 0x01, 0x53, 0x0F, 0x85, 0x80, 0x01, 0x2F, 0x57, 0x86, 0x80, 0x06,
+	0x3C, 0x74, 0x43, 0x4F, 0x43, 0x61, 0x6C, 0x84, 0x80, 0x04, 0x4E, 0x27, 0x00, 0x24, 0x41, 0x83,
+	0x80, 0x01, 0x69, 0x43, 0x90, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10,
+	0x94, 0x04, 0x81, 0x02, 0x01, 0x48, 0x0F, 0x85, 0x80, 0x04, 0x5E, 0x36, 0x70, 0x46, 0x6E, 0x85,
+	0x80, 0x04, 0x2C, 0x51, 0x43, 0x51, 0x6C, 0x84, 0x80, 0x05, 0x5E, 0x78, 0x11, 0x13, 0x14, 0x4C,
+	0x83, 0x80, 0x02, 0x2E, 0x51, 0x43, 0x8F, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x93, 0x04, 0x81, 0x02, 0x01, 0x48, 0x7F, 0x85, 0x80, 0x06, 0x21, 0x27, 0x00, 0x14,
+	0x00, 0x54, 0x40, 0x85, 0x80, 0x02, 0x2C, 0x26, 0x0C, 0x85, 0x80, 0x05, 0x3A, 0x22, 0x14, 0x22,
+	0x14, 0x36, 0x84, 0x80, 0x01, 0x53, 0x43, 0x8F, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80,
+	0x01, 0x5E, 0x10, 0x92, 0x04, 0x81, 0x02, 0x01, 0x56, 0x1F, 0x85, 0x80, 0x02, 0x2E, 0x27, 0x00,
+	0x82, 0x22, 0x01, 0x64, 0x6E, 0x85, 0x80, 0x01, 0x21, 0x6E, 0x84, 0x80, 0x00, 0x4A, 0x80, 0x22,
+	0x80, 0x32, 0x80, 0x22, 0x00, 0x21, 0x83, 0x80, 0x02, 0x4C, 0x42, 0x43, 0x8E, 0x51, 0x01, 0x20,
+	0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x91, 0x04, 0x81, 0x02, 0x01, 0x48, 0x0F, 0x85,
+	0x80, 0x03, 0x5E, 0x35, 0x11, 0x22, 0x80, 0x32, 0x80, 0x22, 0x01, 0x00, 0x49, 0x8C, 0x80, 0x02,
+	0x0C, 0x14, 0x22, 0x82, 0x32, 0x01, 0x22, 0x1B, 0x84, 0x80, 0x01, 0x61, 0x43, 0x8E, 0x51, 0x01,
+	0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8F, 0x04, 0x82, 0x02, 0x01, 0x48, 0x7C,
+	0x85, 0x80, 0x03, 0x2E, 0x36, 0x11, 0x22, 0x80, 0x32, 0x00, 0x43, 0x80, 0x32, 0x03, 0x22, 0x11,
+	0x64, 0x40, 0x89, 0x80, 0x04, 0x4C, 0x50, 0x22, 0x32, 0x42, 0x80, 0x43, 0x03, 0x42, 0x32, 0x61,
+	0x5E, 0x83, 0x80, 0x01, 0x67, 0x42, 0x8E, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x8C, 0x04, 0x01, 0x02, 0x04, 0x82, 0x02, 0x01, 0x66, 0x1F, 0x85, 0x80, 0x04, 0x20,
+	0x27, 0x11, 0x22, 0x32, 0x83, 0x43, 0x00, 0x32, 0x80, 0x22, 0x01, 0x68, 0x5E, 0x87, 0x80, 0x04,
+	0x10, 0x61, 0x14, 0x32, 0x42, 0x82, 0x43, 0x02, 0x32, 0x43, 0x5B, 0x83, 0x80, 0x02, 0x69, 0x42,
+	0x45, 0x8C, 0x51, 0x02, 0x60, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x89, 0x04,
+	0x86, 0x02, 0x01, 0x48, 0x1F, 0x85, 0x80, 0x04, 0x4E, 0x27, 0x12, 0x22, 0x32, 0x80, 0x43, 0x80,
+	0x45, 0x81, 0x43, 0x03, 0x32, 0x22, 0x11, 0x64, 0x86, 0x80, 0x02, 0x2F, 0x31, 0x14, 0x80, 0x32,
+	0x00, 0x43, 0x80, 0x51, 0x01, 0x45, 0x43, 0x80, 0x32, 0x00, 0x59, 0x83, 0x80, 0x00, 0x4C, 0x80,
+	0x43, 0x8D, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x85, 0x04, 0x89,
+	0x02, 0x01, 0x48, 0x7C, 0x85, 0x80, 0x04, 0x2F, 0x36, 0x11, 0x22, 0x32, 0x80, 0x43, 0x82, 0x51,
+	0x00, 0x4F, 0x80, 0x43, 0x04, 0x32, 0x22, 0x00, 0x78, 0x4D, 0x83, 0x80, 0x02, 0x2F, 0x24, 0x14,
+	0x80, 0x32, 0x01, 0x43, 0x45, 0x81, 0x51, 0x04, 0x43, 0x42, 0x32, 0x67, 0x6F, 0x82, 0x80, 0x02,
+	0x0F, 0x03, 0x43, 0x8C, 0x51, 0x02, 0x60, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10,
+	0x8F, 0x02, 0x01, 0x66, 0x0F, 0x85, 0x80, 0x04, 0x20, 0x27, 0x11, 0x22, 0x32, 0x80, 0x43, 0x00,
+	0x45, 0x83, 0x51, 0x81, 0x43, 0x00, 0x32, 0x80, 0x22, 0x01, 0x06, 0x5E, 0x81, 0x80, 0x01, 0x6F,
+	0x54, 0x80, 0x22, 0x01, 0x32, 0x43, 0x84, 0x51, 0x03, 0x43, 0x32, 0x27, 0x40, 0x82, 0x80, 0x02,
+	0x2F, 0x35, 0x42, 0x8D, 0x51, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8E,
+	0x02, 0x01, 0x48, 0x1F, 0x85, 0x80, 0x04, 0x41, 0x27, 0x11, 0x22, 0x32, 0x80, 0x43, 0x86, 0x51,
+	0x00, 0x45, 0x80, 0x43, 0x03, 0x32, 0x22, 0x14, 0x0A, 0x81, 0x80, 0x04, 0x67, 0x14, 0x22, 0x32,
+	0x43, 0x85, 0x51, 0x03, 0x43, 0x32, 0x75, 0x0F, 0x82, 0x80, 0x02, 0x5E, 0x53, 0x42, 0x8B, 0x51,
+	0x80, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8C, 0x02, 0x02, 0x74,
+	0x48, 0x7E, 0x85, 0x80, 0x04, 0x40, 0x36, 0x11, 0x22, 0x32, 0x80, 0x43, 0x00, 0x4F, 0x87, 0x51,
+	0x0D, 0x45, 0x43, 0x42, 0x32, 0x22, 0x00, 0x1B, 0x40, 0x2A, 0x11, 0x22, 0x32, 0x42, 0x45, 0x85,
+	0x51, 0x03, 0x43, 0x42, 0x4F, 0x6C, 0x83, 0x80, 0x01, 0x06, 0x42, 0x87, 0x51, 0x00, 0x60, 0x80,
+	0x51, 0x81, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8B, 0x02, 0x02,
+	0x74, 0x56, 0x0F, 0x85, 0x80, 0x04, 0x20, 0x27, 0x11, 0x22, 0x32, 0x80, 0x43, 0x00, 0x4F, 0x89,
+	0x51, 0x0B, 0x4F, 0x43, 0x42, 0x32, 0x22, 0x14, 0x17, 0x33, 0x22, 0x32, 0x42, 0x45, 0x87, 0x51,
+	0x02, 0x42, 0x32, 0x64, 0x80, 0x2A, 0x04, 0x29, 0x2A, 0x3A, 0x16, 0x42, 0x89, 0x51, 0x82, 0x60,
+	0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8B, 0x02, 0x01, 0x52, 0x1F, 0x85,
+	0x80, 0x04, 0x40, 0x27, 0x12, 0x22, 0x32, 0x80, 0x43, 0x00, 0x4F, 0x8C, 0x51, 0x80, 0x43, 0x80,
+	0x32, 0x80, 0x22, 0x03, 0x32, 0x42, 0x43, 0x4F, 0x87, 0x51, 0x03, 0x43, 0x32, 0x22, 0x11, 0x80,
+	0x00, 0x03, 0x11, 0x13, 0x32, 0x42, 0x88, 0x51, 0x00, 0x60, 0x80, 0x51, 0x80, 0x60, 0x01, 0x20,
+	0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8A, 0x02, 0x02, 0x74, 0x48, 0x7F, 0x84, 0x80,
+	0x04, 0x4E, 0x36, 0x00, 0x22, 0x32, 0x81, 0x43, 0x8D, 0x51, 0x00, 0x45, 0x80, 0x43, 0x02, 0x42,
+	0x32, 0x42, 0x80, 0x43, 0x89, 0x51, 0x01, 0x45, 0x42, 0x80, 0x32, 0x80, 0x22, 0x80, 0x32, 0x01,
+	0x42, 0x45, 0x86, 0x51, 0x01, 0x60, 0x51, 0x83, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80,
+	0x01, 0x5E, 0x10, 0x8A, 0x02, 0x03, 0x74, 0x60, 0x16, 0x5D, 0x82, 0x80, 0x08, 0x20, 0x27, 0x00,
+	0x22, 0x32, 0x42, 0x43, 0x51, 0x45, 0x8F, 0x51, 0x83, 0x43, 0x8B, 0x51, 0x00, 0x43, 0x81, 0x42,
+	0x00, 0x32, 0x80, 0x42, 0x00, 0x45, 0x87, 0x51, 0x80, 0x60, 0x00, 0x51, 0x82, 0x60, 0x01, 0x20,
+	0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8A, 0x02, 0x04, 0x74, 0x63, 0x51, 0x61, 0x4C,
+	0x80, 0x80, 0x04, 0x2E, 0x27, 0x11, 0x22, 0x32, 0x82, 0x43, 0xA3, 0x51, 0x83, 0x45, 0x86, 0x51,
+	0x00, 0x60, 0x80, 0x51, 0x85, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10,
+	0x8A, 0x02, 0x80, 0x74, 0x09, 0x60, 0x43, 0x72, 0x6C, 0x5E, 0x35, 0x11, 0x22, 0x32, 0x42, 0x80,
+	0x43, 0x00, 0x45, 0xB2, 0x51, 0x87, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E,
+	0x10, 0x8B, 0x02, 0x09, 0x74, 0x60, 0x51, 0x43, 0x72, 0x27, 0x14, 0x22, 0x32, 0x42, 0x80, 0x43,
+	0x00, 0x45, 0xB0, 0x51, 0x00, 0x60, 0x81, 0x51, 0x86, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80,
+	0x80, 0x01, 0x5E, 0x10, 0x8A, 0x02, 0x81, 0x74, 0x80, 0x60, 0x00, 0x4F, 0x80, 0x30, 0x80, 0x32,
+	0x00, 0x43, 0x80, 0x45, 0xB2, 0x51, 0x89, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01,
+	0x5E, 0x10, 0x8B, 0x02, 0x81, 0x74, 0x00, 0x63, 0x80, 0x60, 0x00, 0x51, 0x81, 0x43, 0x00, 0x45,
+	0xB0, 0x51, 0x03, 0x60, 0x51, 0x60, 0x51, 0x88, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80,
+	0x01, 0x5E, 0x10, 0x8C, 0x02, 0x84, 0x74, 0x02, 0x51, 0x43, 0x45, 0x85, 0x51, 0x00, 0x45, 0xAA,
+	0x51, 0x8B, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x8E, 0x02, 0x82,
+	0x74, 0x01, 0x02, 0x60, 0x81, 0x51, 0x00, 0x4F, 0xAE, 0x51, 0x01, 0x60, 0x51, 0x8A, 0x60, 0x01,
+	0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x01, 0x5E, 0x10, 0x94, 0x02, 0x00, 0x60, 0x82, 0x51, 0x00,
+	0x45, 0xA9, 0x51, 0x00, 0x60, 0x80, 0x51, 0x8C, 0x60, 0x01, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80,
+	0x01, 0x5E, 0x10, 0x90, 0x02, 0x83, 0x74, 0x00, 0x60, 0x80, 0x45, 0xAC, 0x51, 0x8E, 0x60, 0x01,
+	0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x02, 0x5E, 0x20, 0x26, 0x8C, 0x02, 0x87, 0x74, 0x00, 0x60,
+	0xAC, 0x51, 0x01, 0x60, 0x51, 0x8C, 0x60, 0x02, 0x16, 0x20, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x03,
+	0x5E, 0x2F, 0x2A, 0x74, 0x86, 0x02, 0x8D, 0x74, 0x00, 0x60, 0xAB, 0x51, 0x8D, 0x60, 0x03, 0x51,
+	0x29, 0x2F, 0x5E, 0x80, 0x80, 0x80, 0x80, 0x03, 0x6F, 0x40, 0x6D, 0x16, 0x96, 0x74, 0x00, 0x60,
+	0xA7, 0x51, 0x90, 0x60, 0x03, 0x03, 0x6D, 0x40, 0x6F, 0x80, 0x80, 0x80, 0x80, 0x06, 0x6F, 0x4E,
+	0x10, 0x1C, 0x03, 0x60, 0x63, 0x94, 0x74, 0x00, 0x60, 0xA8, 0x51, 0x8B, 0x60, 0x06, 0x51, 0x43,
+	0x75, 0x2C, 0x10, 0x4E, 0x6F, 0x80, 0x80, 0x81, 0x80, 0x06, 0x6F, 0x40, 0x7D, 0x3D, 0x07, 0x27,
+	0x61, 0x94, 0x43, 0x01, 0x32, 0x14, 0xA5, 0x22, 0x8B, 0x32, 0x06, 0x51, 0x16, 0x78, 0x3D, 0x7D,
+	0x40, 0x6F, 0x81, 0x80, 0x82, 0x80, 0x05, 0x5E, 0x40, 0x10, 0x5B, 0x3D, 0x2D, 0xCA, 0x1C, 0x05,
+	0x2D, 0x3D, 0x5B, 0x10, 0x40, 0x5E, 0x82, 0x80, 0x82, 0x80, 0x04, 0x6F, 0x5E, 0x4E, 0x2F, 0x10,
+	0x80, 0x7D, 0xC8, 0x6D, 0x80, 0x7D, 0x03, 0x10, 0x2F, 0x4E, 0x5E, 0x83, 0x80, 0x84, 0x80, 0x00,
+	0x6F, 0x80, 0x5E, 0x81, 0x4E, 0xC7, 0x40, 0x80, 0x4E, 0x80, 0x5E, 0x00, 0x6F, 0x84, 0x80
+};
+
+const CompressedIcon historyIcon = {96, 67, 129, palette, data};
@@ -1,11 +1,11 @@
-#include <TFT_eSPI.h>
+#include "CompressedIcon.h"
 
-extern const uint16_t warningIcon[6432] PROGMEM;
-extern const uint16_t connectedIcon[6432] PROGMEM;
-extern const uint16_t particlesIcon[6432] PROGMEM;
-extern const uint16_t barsIcon[6432] PROGMEM;
-extern const uint16_t historyIcon[6432] PROGMEM;
-extern const uint16_t wlanIcon[6432] PROGMEM;
+extern const CompressedIcon warningIcon;
+extern const CompressedIcon connectedIcon;
+extern const CompressedIcon particlesIcon;
+extern const CompressedIcon barsIcon;
+extern const CompressedIcon historyIcon;
+extern const CompressedIcon wlanIcon;
 
 uint8_t iconWidth = 96;
 uint8_t iconHeight = 67;
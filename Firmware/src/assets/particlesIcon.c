@@ -2,810 +2,161 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t particlesIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x59C6,
-	0x779D, 0xF484, 0xB37C, 0xB37C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C, 0x937C,
-	0x937C, 0x937C, 0x937C, 0x9374, 0x9374, 0x9374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374, 0x7374,
-	0x7374, 0x7374, 0x7274, 0x7274, 0x5274, 0x5274, 0xB47C, 0x569D,
-	0x39BE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x5DE7, 0x3595, 0x7374,
-	0x7274, 0x526C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0x1164,
-	0x326C, 0xF48C, 0x5DE7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1595, 0x5274, 0x526C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0x1164, 0xF48C, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x19BE, 0x5274, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0x1164, 0x18B6, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0xF48C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xB384, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x7374, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0x1164, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1264, 0xD484, 0xD7AD, 0x18B6, 0x59BE,
-	0x7AC6, 0x39BE, 0xF8B5, 0x5695, 0x5274, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xD484, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7AC6, 0x326C, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x7374, 0x9ACE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x97A5,
-	0x1164, 0xF163, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x937C,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x59BE, 0x1164, 0xF163, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x7374, 0x9EF7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x39BE, 0xF163, 0xF163, 0x1164, 0x1164, 0x1164, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x126C, 0x5DE7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x769D, 0xF163, 0xF163, 0x1164, 0x1164, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0xF8B5, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0xB063, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x5DE7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x59C6, 0x8F5B, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x5274, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x116C, 0x8F5B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0xF163, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x1595, 0x8F5B, 0xAF5B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0xF163, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB7AD, 0x8F53, 0x8F5B, 0xB05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18BE, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xF16B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD7B5, 0x6F53, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xD05B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x76A5, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xD05B, 0x18BE, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x527C, 0x6F53, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xD063, 0xD063, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6F5B, 0x6F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x126C, 0x126C, 0x126C, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xD063, 0xB05B, 0xDBD6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x727C, 0x4E53, 0x8F53, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x7374,
-	0x1595, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB7AD, 0x7374,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xB05B, 0x76A5, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x9ACE, 0x2E53, 0x6F53, 0x8F53, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x326C, 0x326C,
-	0x326C, 0x326C, 0x326C, 0x326C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x158D, 0xBEF7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7,
-	0x7AC6, 0xF163, 0xF163, 0xF163, 0xD05B, 0x6F5B, 0xF494, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xD06B, 0x4E53, 0x6F53, 0x8F5B, 0xAF5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x326C, 0x326C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x569D, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x9ACE, 0x1164, 0xF163, 0xD063, 0xB05B, 0x6F53, 0x96AD,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9EF7, 0xAF63, 0x2E53, 0x6F53, 0x8F53, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x126C, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x1164, 0x7374, 0xDFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x59C6, 0xF163, 0xD163, 0xD05B, 0xB05B, 0x6E53,
-	0xF494, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x8F5B, 0x2E53, 0x6F53, 0x8F53, 0x8F5B, 0xAF5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x126C, 0x126C, 0x126C, 0x126C,
-	0x126C, 0x126C, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1164, 0x1164, 0x326C, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x3274, 0xF163, 0xD163, 0xD05B, 0xB05B,
-	0x6F53, 0x559D, 0xBBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF, 0x96AD, 0x2D53,
-	0x2E53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xF58C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xB7AD, 0x8F5B, 0xF163, 0xD063, 0xD05B,
-	0xB05B, 0x6F53, 0x0D4B, 0x2E53, 0x18BE, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD06B, 0x0D4B, 0x0D4B, 0x2E53,
-	0x4E53, 0x6F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1164, 0x1164, 0xF163, 0xD8AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x39BE, 0x6F53, 0x8F5B, 0xF163, 0xF163,
-	0xD05B, 0xB05B, 0xAF5B, 0x2E53, 0xED4A, 0xEC4A, 0x0D4B, 0x2D53,
-	0x2D53, 0x0D53, 0xED4A, 0xEC42, 0x2D4B, 0x2E53, 0x4E53, 0x6F53,
-	0x6F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0xF163, 0x39BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x6F53, 0x8F5B, 0x905B, 0xF163,
-	0xF163, 0xD05B, 0xD05B, 0xB05B, 0x4E53, 0x4E53, 0x2E53, 0x2E53,
-	0x2E53, 0x2E53, 0x4E53, 0x4E53, 0x4E53, 0x6F53, 0x6F53, 0x8F53,
-	0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0xF163, 0xF163, 0x39BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B,
-	0xF163, 0xF163, 0xF163, 0xD05B, 0xD05B, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B, 0x8F5B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xF163, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD163, 0xF8B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x1CDF, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B,
-	0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0x8F53, 0x8F53,
-	0x8F53, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xF163, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1164, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x359D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x96AD, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xF163, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1264, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xD063, 0x116C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xB38C, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0x905B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1264, 0x1264, 0x1264, 0x1264,
-	0x1264, 0x1264, 0x1264, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xB05B, 0x359D, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x7DEF, 0x4E53, 0x6F53, 0x8F5B, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xF163, 0xB7A5, 0xFCDE, 0x3CE7,
-	0xBBCE, 0xF163, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xD05B, 0x8F5B, 0x59C6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x3CE7, 0x4E53, 0x6E53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xAF5B, 0x937C, 0xFCDE, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xDFFF, 0xD7AD, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xD063, 0xB05B, 0x6F53, 0x7ACE, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xBEF7, 0x6E5B, 0x4E53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0x8F5B, 0xB05B, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xB7AD, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xD05B, 0xB05B, 0x6F5B, 0xB38C,
-	0xBBD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x359D,
-	0x4E5B, 0x4E53, 0x6F53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xAF5B, 0x8F5B, 0x359D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x7DEF, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xB05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xD05B, 0xB05B, 0x6F53,
-	0xED4A, 0x4E5B, 0x317C, 0x9384, 0x527C, 0xAF63, 0xED4A, 0x0D4B,
-	0x4E53, 0x4E53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x8F53, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x116C, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xD05B, 0xB05B,
-	0x8F5B, 0x2E53, 0x2D4B, 0x0D4B, 0x0D4B, 0x2D4B, 0x4E53, 0x4E53,
-	0x6F53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x6F53, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x527C, 0x8F53, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xD05B,
-	0xD05B, 0xB05B, 0x6E53, 0x4E53, 0x4E53, 0x4E53, 0x6F53, 0x6F53,
-	0x8F5B, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x905B,
-	0x8F5B, 0x6F53, 0x5DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x116C, 0x8F53, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xD163, 0xD05B, 0x6F53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B,
-	0x8F5B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B,
-	0x8F5B, 0x6F53, 0x159D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x9EF7, 0x6F53, 0x8F53, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0x8F5B, 0x8F5B, 0x8F5B, 0x905B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B,
-	0x8F5B, 0x6F53, 0x3174, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x559D, 0x6F53, 0x8F53, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x6F53, 0x4E53, 0x8F63, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xD7B5, 0x2E53, 0x6F53, 0x8F5B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0x8F5B, 0x8F53, 0x6F53, 0x2E53, 0x6E5B, 0x359D, 0xF8B5, 0x18BE,
-	0x96AD, 0x527C, 0x2D4B, 0x6F53, 0x8F53, 0x8F5B, 0x905B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0x8F5B, 0x8F53, 0x6F53, 0x2E53, 0x0D4B, 0xED4A, 0xED4A,
-	0x0D4B, 0x2E4B, 0x4E53, 0x6F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0x8F5B, 0x8F5B, 0x8F53, 0x6F53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x6F53, 0x6F53, 0x8F5B, 0x8F5B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0x8F5B, 0x8F5B, 0x8F53, 0x8F53, 0x6F53, 0x6F53,
-	0x8F53, 0x8F53, 0x8F5B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0x905B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x905B, 0x905B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x5274, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0x3174, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0x55A5, 0xF163, 0x1164, 0x1164,
-	0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0x1164, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xB05B, 0x559D, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDBDE, 0x3174, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0x116C, 0xDBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x38C6, 0x116C, 0xD05B,
-	0xD163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163, 0xF163,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B, 0xB05B,
-	0xB05B, 0xB05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B,
-	0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xD05B, 0xB05B,
-	0x8F5B, 0xF16B, 0x59C6, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x79CE, 0x149D,
-	0x527C, 0xD063, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B,
-	0x8F5B, 0x8F5B, 0x8F5B, 0x8F5B, 0x8F53, 0x8F53, 0x8F53, 0x8F53,
-	0x8F53, 0x8F53, 0x8F53, 0x8F53, 0x8F53, 0x8F53, 0x8F53, 0x8F53,
-	0x8F53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53, 0x4E53,
-	0x4E53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53,
-	0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0x6F53, 0xB05B, 0x3174,
-	0xF494, 0x79CE, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[106] = {
+	0x0D4B, 0x0D53, 0x1164, 0x116C, 0x1264, 0x126C, 0x149D, 0x158D,
+	0x1595, 0x159D, 0x18B6, 0x18BE, 0x19BE, 0x1CDF, 0x1CE7, 0x2D4B,
+	0x2D53, 0x2E4B, 0x2E53, 0x3174, 0x317C, 0x326C, 0x3274, 0x3595,
+	0x359D, 0x38C6, 0x39BE, 0x3CE7, 0x4E53, 0x4E5B, 0x526C, 0x5274,
+	0x527C, 0x559D, 0x55A5, 0x5695, 0x569D, 0x59BE, 0x59C6, 0x59CE,
+	0x5DE7, 0x5DEF, 0x6E53, 0x6E5B, 0x6F53, 0x6F5B, 0x7274, 0x727C,
+	0x7374, 0x769D, 0x76A5, 0x779D, 0x79CE, 0x7AC6, 0x7ACE, 0x7DEF,
+	0x8F53, 0x8F5B, 0x8F63, 0x905B, 0x9374, 0x937C, 0x9384, 0x96AD,
+	0x97A5, 0x9ACE, 0x9EF7, 0xAF5B, 0xAF63, 0xB05B, 0xB063, 0xB37C,
+	0xB384, 0xB38C, 0xB47C, 0xB7A5, 0xB7AD, 0xBAD6, 0xBBCE, 0xBBD6,
+	0xBEF7, 0xD05B, 0xD063, 0xD06B, 0xD163, 0xD484, 0xD7AD, 0xD7B5,
+	0xD8AD, 0xDBD6, 0xDBDE, 0xDFF7, 0xDFFF, 0xEC42, 0xEC4A, 0xED4A,
+	0xF163, 0xF16B, 0xF484, 0xF48C, 0xF494, 0xF58C, 0xF8B5, 0xFBDE,
+	0xFCDE, 0xFFFF
 };
+
+static const uint8_t data[2156] = {
+	0x83, 0x69, 0x04, 0x5C, 0x50, 0x26, 0x33, 0x62, 0x80, 0x47, 0x9D, 0x3D, 0x81, 0x3C, 0xA2, 0x30,
+	0x80, 0x2E, 0x80, 0x1F, 0x03, 0x4A, 0x24, 0x1A, 0x50, 0x84, 0x69, 0x82, 0x69, 0x05, 0x5C, 0x28,
+	0x17, 0x30, 0x2E, 0x1E, 0xA1, 0x15, 0x82, 0x05, 0x86, 0x04, 0x91, 0x02, 0x89, 0x60, 0x04, 0x02,
+	0x15, 0x63, 0x28, 0x5C, 0x82, 0x69, 0x81, 0x69, 0x04, 0x5C, 0x42, 0x08, 0x1F, 0x1E, 0xA3, 0x15,
+	0x82, 0x05, 0x85, 0x04, 0x92, 0x02, 0x8B, 0x60, 0x02, 0x02, 0x63, 0x42, 0x82, 0x69, 0x81, 0x69,
+	0x02, 0x50, 0x0C, 0x1F, 0xA5, 0x15, 0x81, 0x05, 0x86, 0x04, 0x91, 0x02, 0x8D, 0x60, 0x02, 0x02,
+	0x0A, 0x50, 0x81, 0x69, 0x80, 0x69, 0x02, 0x5C, 0x42, 0x63, 0xA5, 0x15, 0x82, 0x05, 0x86, 0x04,
+	0x91, 0x02, 0x8E, 0x60, 0x02, 0x48, 0x42, 0x5C, 0x80, 0x69, 0x80, 0x69, 0x02, 0x5C, 0x29, 0x30,
+	0xA5, 0x15, 0x81, 0x05, 0x86, 0x04, 0x92, 0x02, 0x8E, 0x60, 0x02, 0x02, 0x29, 0x5C, 0x80, 0x69,
+	0x80, 0x69, 0x01, 0x50, 0x1B, 0xA5, 0x15, 0x81, 0x05, 0x87, 0x04, 0x91, 0x02, 0x90, 0x60, 0x01,
+	0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x1B, 0xA5, 0x15, 0x81, 0x05, 0x87, 0x04, 0x91,
+	0x02, 0x90, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0xA4, 0x15, 0x81,
+	0x05, 0x87, 0x04, 0x92, 0x02, 0x90, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50,
+	0x0E, 0xA4, 0x15, 0x81, 0x05, 0x86, 0x04, 0x93, 0x02, 0x90, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69,
+	0x80, 0x69, 0x01, 0x50, 0x0E, 0xA3, 0x15, 0x81, 0x05, 0x84, 0x04, 0x95, 0x02, 0x91, 0x60, 0x01,
+	0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0xA2, 0x15, 0x82, 0x05, 0x82, 0x04, 0x81,
+	0x02, 0x09, 0x04, 0x55, 0x56, 0x0A, 0x25, 0x35, 0x1A, 0x66, 0x23, 0x1F, 0x8A, 0x02, 0x91, 0x60,
+	0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0xA2, 0x15, 0x81, 0x05, 0x81, 0x04,
+	0x82, 0x02, 0x01, 0x55, 0x5C, 0x87, 0x69, 0x01, 0x35, 0x15, 0x87, 0x02, 0x92, 0x60, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0xA1, 0x15, 0x82, 0x05, 0x80, 0x04, 0x81, 0x02,
+	0x01, 0x30, 0x41, 0x8A, 0x69, 0x03, 0x50, 0x40, 0x02, 0x60, 0x84, 0x02, 0x92, 0x60, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0xA0, 0x15, 0x82, 0x05, 0x80, 0x04, 0x81, 0x02,
+	0x00, 0x3D, 0x8E, 0x69, 0x02, 0x25, 0x02, 0x60, 0x83, 0x02, 0x92, 0x60, 0x01, 0x1B, 0x50, 0x80,
+	0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9F, 0x15, 0x82, 0x05, 0x80, 0x04, 0x81, 0x02, 0x01, 0x30,
+	0x42, 0x8F, 0x69, 0x00, 0x1A, 0x80, 0x60, 0x81, 0x02, 0x93, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69,
+	0x80, 0x69, 0x01, 0x50, 0x0E, 0x9F, 0x15, 0x81, 0x05, 0x81, 0x04, 0x80, 0x02, 0x01, 0x05, 0x28,
+	0x91, 0x69, 0x00, 0x31, 0x80, 0x60, 0x80, 0x02, 0x93, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80,
+	0x69, 0x01, 0x50, 0x0E, 0x9E, 0x15, 0x82, 0x05, 0x80, 0x04, 0x81, 0x02, 0x00, 0x66, 0x92, 0x69,
+	0x01, 0x50, 0x46, 0x96, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9D,
+	0x15, 0x81, 0x05, 0x81, 0x04, 0x82, 0x02, 0x00, 0x28, 0x93, 0x69, 0x01, 0x26, 0x39, 0x95, 0x60,
+	0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9C, 0x15, 0x82, 0x05, 0x81, 0x04,
+	0x81, 0x02, 0x00, 0x1F, 0x95, 0x69, 0x01, 0x03, 0x39, 0x94, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69,
+	0x80, 0x69, 0x01, 0x50, 0x0E, 0x9B, 0x15, 0x81, 0x05, 0x83, 0x04, 0x80, 0x02, 0x00, 0x60, 0x96,
+	0x69, 0x02, 0x08, 0x39, 0x43, 0x93, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50,
+	0x0E, 0x99, 0x15, 0x82, 0x05, 0x84, 0x04, 0x80, 0x02, 0x00, 0x60, 0x96, 0x69, 0x03, 0x4C, 0x38,
+	0x39, 0x45, 0x92, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x99, 0x15,
+	0x81, 0x05, 0x84, 0x04, 0x80, 0x02, 0x01, 0x60, 0x03, 0x96, 0x69, 0x04, 0x0B, 0x2C, 0x39, 0x3B,
+	0x45, 0x91, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x96, 0x15, 0x83,
+	0x05, 0x85, 0x04, 0x80, 0x02, 0x01, 0x60, 0x03, 0x96, 0x69, 0x03, 0x1A, 0x2C, 0x39, 0x3B, 0x80,
+	0x45, 0x90, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x96, 0x15, 0x82,
+	0x05, 0x86, 0x04, 0x80, 0x02, 0x01, 0x60, 0x61, 0x96, 0x69, 0x03, 0x1A, 0x2C, 0x39, 0x3B, 0x81,
+	0x45, 0x8F, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x94, 0x15, 0x83,
+	0x05, 0x87, 0x04, 0x80, 0x02, 0x80, 0x60, 0x96, 0x69, 0x01, 0x57, 0x2C, 0x80, 0x39, 0x82, 0x45,
+	0x8E, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x92, 0x15, 0x83, 0x05,
+	0x89, 0x04, 0x80, 0x02, 0x01, 0x60, 0x51, 0x96, 0x69, 0x03, 0x32, 0x2C, 0x39, 0x3B, 0x83, 0x45,
+	0x8D, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x91, 0x15, 0x83, 0x05,
+	0x8A, 0x04, 0x80, 0x02, 0x02, 0x60, 0x51, 0x0B, 0x95, 0x69, 0x03, 0x20, 0x2C, 0x39, 0x3B, 0x84,
+	0x45, 0x8C, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x8E, 0x15, 0x84,
+	0x05, 0x84, 0x04, 0x88, 0x02, 0x00, 0x60, 0x80, 0x52, 0x95, 0x69, 0x02, 0x2D, 0x2C, 0x39, 0x86,
+	0x45, 0x8B, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x8B, 0x15, 0x85,
+	0x05, 0x83, 0x04, 0x83, 0x02, 0x81, 0x05, 0x83, 0x02, 0x03, 0x60, 0x52, 0x45, 0x59, 0x93, 0x69,
+	0x03, 0x2F, 0x1C, 0x38, 0x39, 0x87, 0x45, 0x8A, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69,
+	0x01, 0x50, 0x0E, 0x88, 0x15, 0x87, 0x05, 0x83, 0x04, 0x81, 0x02, 0x02, 0x30, 0x08, 0x50, 0x82,
+	0x69, 0x01, 0x4C, 0x30, 0x80, 0x02, 0x80, 0x60, 0x01, 0x45, 0x32, 0x92, 0x69, 0x04, 0x41, 0x12,
+	0x2C, 0x38, 0x3B, 0x88, 0x45, 0x89, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50,
+	0x0E, 0x86, 0x15, 0x86, 0x05, 0x85, 0x04, 0x81, 0x02, 0x01, 0x07, 0x50, 0x85, 0x69, 0x01, 0x50,
+	0x35, 0x81, 0x60, 0x02, 0x51, 0x2D, 0x64, 0x91, 0x69, 0x04, 0x53, 0x1C, 0x2C, 0x39, 0x43, 0x89,
+	0x45, 0x88, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x80, 0x15, 0x8A,
+	0x05, 0x86, 0x04, 0x81, 0x02, 0x00, 0x24, 0x89, 0x69, 0x06, 0x41, 0x02, 0x60, 0x52, 0x45, 0x2C,
+	0x3F, 0x8E, 0x69, 0x05, 0x42, 0x44, 0x12, 0x2C, 0x38, 0x3B, 0x8B, 0x45, 0x87, 0x60, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x88, 0x05, 0x89, 0x04, 0x81, 0x02, 0x01, 0x30,
+	0x5B, 0x8A, 0x69, 0x06, 0x26, 0x60, 0x54, 0x51, 0x45, 0x2A, 0x64, 0x8D, 0x69, 0x05, 0x39, 0x12,
+	0x2C, 0x38, 0x39, 0x43, 0x8C, 0x45, 0x86, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01,
+	0x50, 0x0E, 0x84, 0x05, 0x8D, 0x04, 0x80, 0x02, 0x01, 0x15, 0x50, 0x8C, 0x69, 0x07, 0x16, 0x60,
+	0x54, 0x51, 0x45, 0x2C, 0x21, 0x4F, 0x88, 0x69, 0x03, 0x37, 0x3F, 0x10, 0x12, 0x80, 0x2C, 0x80,
+	0x39, 0x8E, 0x45, 0x85, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x92,
+	0x04, 0x80, 0x02, 0x01, 0x60, 0x65, 0x8D, 0x69, 0x09, 0x4C, 0x39, 0x60, 0x52, 0x51, 0x45, 0x2C,
+	0x00, 0x12, 0x0B, 0x85, 0x69, 0x00, 0x53, 0x80, 0x00, 0x04, 0x12, 0x1C, 0x2C, 0x39, 0x3B, 0x90,
+	0x45, 0x84, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x92, 0x04, 0x80,
+	0x02, 0x01, 0x60, 0x58, 0x8D, 0x69, 0x02, 0x1A, 0x2C, 0x39, 0x80, 0x60, 0x06, 0x51, 0x45, 0x43,
+	0x12, 0x5F, 0x5E, 0x00, 0x80, 0x10, 0x05, 0x01, 0x5F, 0x5D, 0x0F, 0x12, 0x1C, 0x80, 0x2C, 0x00,
+	0x39, 0x93, 0x45, 0x83, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x91,
+	0x04, 0x81, 0x02, 0x01, 0x60, 0x1A, 0x8D, 0x69, 0x03, 0x42, 0x2C, 0x39, 0x3B, 0x80, 0x60, 0x80,
+	0x51, 0x00, 0x45, 0x80, 0x1C, 0x82, 0x12, 0x81, 0x1C, 0x80, 0x2C, 0x01, 0x38, 0x39, 0x95, 0x45,
+	0x82, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x91, 0x04, 0x80, 0x02,
+	0x80, 0x60, 0x00, 0x1A, 0x8D, 0x69, 0x01, 0x42, 0x2C, 0x80, 0x39, 0x00, 0x45, 0x81, 0x60, 0x80,
+	0x51, 0x86, 0x2C, 0x81, 0x39, 0x97, 0x45, 0x81, 0x60, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69,
+	0x01, 0x50, 0x0E, 0x8F, 0x04, 0x82, 0x02, 0x02, 0x60, 0x54, 0x66, 0x8D, 0x69, 0x01, 0x0D, 0x2C,
+	0x80, 0x39, 0x80, 0x45, 0x83, 0x60, 0x81, 0x38, 0x83, 0x39, 0x9A, 0x45, 0x80, 0x60, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x8C, 0x04, 0x01, 0x02, 0x04, 0x83, 0x02, 0x02,
+	0x60, 0x52, 0x18, 0x8D, 0x69, 0x01, 0x3F, 0x2C, 0x80, 0x39, 0x81, 0x45, 0x83, 0x60, 0x82, 0x39,
+	0x9E, 0x45, 0x02, 0x60, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x89, 0x04, 0x88,
+	0x02, 0x02, 0x60, 0x52, 0x03, 0x8D, 0x69, 0x01, 0x49, 0x2C, 0x80, 0x39, 0x82, 0x45, 0x83, 0x60,
+	0x80, 0x3B, 0xA0, 0x45, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x85, 0x04,
+	0x8C, 0x02, 0x80, 0x60, 0x01, 0x45, 0x18, 0x8B, 0x69, 0x04, 0x37, 0x1C, 0x2C, 0x39, 0x3B, 0x83,
+	0x45, 0x05, 0x60, 0x4B, 0x68, 0x1B, 0x4E, 0x60, 0x9F, 0x45, 0x02, 0x51, 0x1B, 0x50, 0x80, 0x69,
+	0x80, 0x69, 0x01, 0x50, 0x0E, 0x93, 0x02, 0x80, 0x60, 0x02, 0x51, 0x39, 0x26, 0x89, 0x69, 0x04,
+	0x1B, 0x1C, 0x2A, 0x2C, 0x39, 0x82, 0x45, 0x02, 0x43, 0x3D, 0x68, 0x82, 0x69, 0x01, 0x5C, 0x56,
+	0x9F, 0x45, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x94, 0x02, 0x04, 0x60,
+	0x52, 0x45, 0x2C, 0x36, 0x87, 0x69, 0x03, 0x50, 0x2B, 0x1C, 0x2C, 0x80, 0x39, 0x81, 0x45, 0x02,
+	0x39, 0x45, 0x5C, 0x85, 0x69, 0x01, 0x4C, 0x39, 0x9B, 0x45, 0x80, 0x51, 0x01, 0x1B, 0x50, 0x80,
+	0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x94, 0x02, 0x80, 0x60, 0x04, 0x51, 0x45, 0x2D, 0x49, 0x4F,
+	0x83, 0x69, 0x03, 0x42, 0x18, 0x1D, 0x1C, 0x80, 0x2C, 0x00, 0x39, 0x81, 0x45, 0x02, 0x43, 0x39,
+	0x18, 0x86, 0x69, 0x00, 0x37, 0x80, 0x39, 0x96, 0x45, 0x00, 0x51, 0x80, 0x45, 0x81, 0x51, 0x01,
+	0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x95, 0x02, 0x80, 0x60, 0x0A, 0x51, 0x45,
+	0x2C, 0x5F, 0x1D, 0x14, 0x3E, 0x20, 0x44, 0x5F, 0x00, 0x80, 0x1C, 0x01, 0x2C, 0x39, 0x82, 0x45,
+	0x02, 0x39, 0x38, 0x42, 0x87, 0x69, 0x01, 0x03, 0x39, 0x98, 0x45, 0x82, 0x51, 0x01, 0x1B, 0x50,
+	0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x96, 0x02, 0x80, 0x60, 0x04, 0x51, 0x45, 0x39, 0x12,
+	0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x1C, 0x80, 0x2C, 0x80, 0x39, 0x82, 0x45, 0x02, 0x39, 0x2C,
+	0x5C, 0x87, 0x69, 0x01, 0x20, 0x38, 0x97, 0x45, 0x00, 0x51, 0x80, 0x45, 0x80, 0x51, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x97, 0x02, 0x80, 0x60, 0x80, 0x51, 0x01, 0x45,
+	0x2A, 0x81, 0x1C, 0x80, 0x2C, 0x80, 0x39, 0x00, 0x3B, 0x81, 0x45, 0x80, 0x3B, 0x02, 0x39, 0x2C,
+	0x28, 0x87, 0x69, 0x02, 0x03, 0x38, 0x3B, 0x94, 0x45, 0x01, 0x51, 0x45, 0x83, 0x51, 0x01, 0x1B,
+	0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x97, 0x02, 0x82, 0x60, 0x01, 0x54, 0x51, 0x81,
+	0x2C, 0x81, 0x39, 0x84, 0x45, 0x03, 0x3B, 0x39, 0x2C, 0x09, 0x86, 0x69, 0x03, 0x42, 0x2C, 0x38,
+	0x3B, 0x94, 0x45, 0x80, 0x51, 0x00, 0x45, 0x82, 0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69,
+	0x01, 0x50, 0x0E, 0x98, 0x02, 0x84, 0x60, 0x81, 0x39, 0x00, 0x3B, 0x85, 0x45, 0x04, 0x3B, 0x39,
+	0x2C, 0x13, 0x5C, 0x85, 0x69, 0x02, 0x21, 0x2C, 0x38, 0x92, 0x45, 0x00, 0x51, 0x80, 0x45, 0x85,
+	0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9C, 0x02, 0x81, 0x60, 0x89,
+	0x45, 0x04, 0x39, 0x2C, 0x1C, 0x3A, 0x5C, 0x83, 0x69, 0x03, 0x57, 0x12, 0x2C, 0x39, 0x93, 0x45,
+	0x87, 0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9F, 0x02, 0x00, 0x60,
+	0x88, 0x45, 0x0E, 0x39, 0x38, 0x2C, 0x12, 0x2B, 0x18, 0x66, 0x0B, 0x3F, 0x20, 0x0F, 0x2C, 0x38,
+	0x39, 0x3B, 0x8F, 0x45, 0x00, 0x51, 0x81, 0x45, 0x86, 0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80,
+	0x69, 0x01, 0x50, 0x0E, 0x9D, 0x02, 0x82, 0x60, 0x88, 0x45, 0x04, 0x39, 0x38, 0x2C, 0x12, 0x00,
+	0x80, 0x5F, 0x05, 0x00, 0x11, 0x1C, 0x2C, 0x39, 0x3B, 0x91, 0x45, 0x89, 0x51, 0x01, 0x1B, 0x50,
+	0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x9B, 0x02, 0x85, 0x60, 0x87, 0x45, 0x80, 0x39, 0x01,
+	0x38, 0x2C, 0x82, 0x1C, 0x80, 0x2C, 0x80, 0x39, 0x8F, 0x45, 0x03, 0x51, 0x45, 0x51, 0x45, 0x88,
+	0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x99, 0x02, 0x88, 0x60, 0x87,
+	0x45, 0x80, 0x39, 0x80, 0x38, 0x80, 0x2C, 0x80, 0x38, 0x01, 0x39, 0x3B, 0x91, 0x45, 0x8B, 0x51,
+	0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x96, 0x02, 0x8C, 0x60, 0x88, 0x45,
+	0x00, 0x3B, 0x82, 0x39, 0x80, 0x3B, 0x91, 0x45, 0x01, 0x51, 0x45, 0x8A, 0x51, 0x01, 0x1B, 0x50,
+	0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x94, 0x02, 0x8F, 0x60, 0x9E, 0x45, 0x00, 0x51, 0x80,
+	0x45, 0x8C, 0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x01, 0x50, 0x0E, 0x90, 0x02, 0x94,
+	0x60, 0x9E, 0x45, 0x8E, 0x51, 0x01, 0x1B, 0x50, 0x80, 0x69, 0x80, 0x69, 0x02, 0x50, 0x1B, 0x1F,
+	0x8C, 0x02, 0x98, 0x60, 0x9C, 0x45, 0x01, 0x51, 0x45, 0x8C, 0x51, 0x02, 0x13, 0x1B, 0x50, 0x80,
+	0x69, 0x80, 0x69, 0x03, 0x50, 0x29, 0x22, 0x60, 0x86, 0x02, 0x9E, 0x60, 0x9B, 0x45, 0x8D, 0x51,
+	0x03, 0x45, 0x21, 0x29, 0x50, 0x80, 0x69, 0x80, 0x69, 0x03, 0x5C, 0x37, 0x5A, 0x13, 0xA7, 0x60,
+	0x97, 0x45, 0x90, 0x51, 0x03, 0x03, 0x5A, 0x37, 0x5C, 0x80, 0x69, 0x80, 0x69, 0x06, 0x5C, 0x42,
+	0x0E, 0x19, 0x03, 0x51, 0x54, 0xA5, 0x60, 0x98, 0x45, 0x8B, 0x51, 0x06, 0x45, 0x39, 0x61, 0x26,
+	0x0E, 0x42, 0x5C, 0x80, 0x69, 0x81, 0x69, 0x06, 0x5C, 0x37, 0x67, 0x34, 0x06, 0x20, 0x52, 0x98,
+	0x39, 0x8B, 0x38, 0x96, 0x1C, 0x8B, 0x2C, 0x06, 0x45, 0x13, 0x64, 0x34, 0x67, 0x37, 0x5C, 0x81,
+	0x69, 0x82, 0x69, 0x05, 0x50, 0x37, 0x0E, 0x4D, 0x34, 0x27, 0xCA, 0x19, 0x05, 0x27, 0x34, 0x4D,
+	0x0E, 0x37, 0x50, 0x82, 0x69, 0x82, 0x69, 0x04, 0x5C, 0x50, 0x42, 0x29, 0x0E, 0x80, 0x67, 0xC8,
+	0x5A, 0x80, 0x67, 0x03, 0x0E, 0x29, 0x42, 0x50, 0x83, 0x69, 0x84, 0x69, 0x00, 0x5C, 0x80, 0x50,
+	0x81, 0x42, 0xC7, 0x37, 0x80, 0x42, 0x80, 0x50, 0x00, 0x5C, 0x84, 0x69
+};
+
+const CompressedIcon particlesIcon = {96, 67, 106, palette, data};
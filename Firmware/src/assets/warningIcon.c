@@ -2,810 +2,157 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t warningIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0xB4F6,
-	0xEDF5, 0x68FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD,
-	0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD,
-	0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD, 0x45FD,
-	0x45FD, 0x45FD, 0x45FD, 0x44FD, 0x44FD, 0x44FD, 0x44FD, 0x44FD,
-	0x44FD, 0x44FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD,
-	0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD,
-	0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD,
-	0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x24FD, 0x23FD, 0x23FD,
-	0x23FD, 0x23FD, 0x23FD, 0x23FD, 0x23FD, 0x23FD, 0x23FD, 0x23FD,
-	0x23FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x46FD, 0xCCF5,
-	0x93F6, 0xBEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7CF7, 0xAAFD, 0x24FD,
-	0x03FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xE1FC,
-	0xE2FC, 0x88FD, 0x5BF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0xAAF5, 0x03FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0x68F5, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x53EE, 0x03FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0x53EE, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x89F5, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0x47F5, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x23FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xE1FC, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC,
-	0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0x02FD, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x02FD, 0x02FD, 0x02FD, 0x02FD,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x02FD, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0x67FD,
-	0x67FD, 0xC1FC, 0xC1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xF7F6,
-	0xF7F6, 0xA1F4, 0xC1FC, 0xC1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0x89F5, 0xFFFF,
-	0xFFFF, 0x49E5, 0xA1F4, 0xC1FC, 0xC1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1F4, 0x9BFF, 0xFFFF,
-	0xFFFF, 0x7BF7, 0x41E4, 0xA1F4, 0xC1FC, 0xC1FC, 0xE1FC, 0xE1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0x73F6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x52EE, 0x41E4, 0xA1F4, 0xC1FC, 0xE1FC, 0xE1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xE3F4, 0xDEFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDEFF, 0x42DC, 0x41E4, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1F4, 0xF6F6, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xB6EE, 0x41DC, 0x61E4, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0x27F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC6DC, 0x41DC, 0x61E4, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xC1FC, 0xC1F4, 0xBDFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DFF, 0x41DC, 0x41E4, 0x61E4,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xC1FC, 0xC1FC, 0xCDF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DE5, 0x41DC, 0x41E4,
-	0x61EC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE2FC, 0xE2FC, 0xE2FC,
-	0xE2FC, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xC1FC, 0xC2F4, 0xBEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEFF, 0x41DC, 0x41E4,
-	0x41E4, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE2FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC,
-	0xC1F4, 0x51F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x11EE, 0x41DC,
-	0x41E4, 0x40E4, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC,
-	0x05F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84DC,
-	0x40E4, 0x40E4, 0x60E4, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1F4,
-	0x18F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x18F7,
-	0x20DC, 0x40E4, 0x60E4, 0x60E4, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0x26F5,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xC6DC, 0x40E4, 0x40E4, 0x60E4, 0x60EC, 0x80EC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xA1F4, 0x9CFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9CFF, 0x41DC, 0x40E4, 0x60E4, 0x60EC, 0x60EC, 0x60EC, 0xA0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xCDF5, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x8DE5, 0x40E4, 0x40E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xE4F4, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x34DE, 0x34DE,
-	0x34DE, 0x34DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x83DC, 0x40E4, 0x60EC, 0x60E4, 0x60EC, 0x60EC,
-	0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1F4, 0x73F6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B3, 0x81B3,
-	0x81B3, 0x81B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x53EE, 0x40E4, 0x40E4, 0x60E4, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0x47F5, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC1C3, 0xC1CB,
-	0xC1CB, 0xC1C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xE6E4, 0x40E4, 0x60E4, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xC1FC, 0xC1FC, 0xA1F4, 0x18F7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1CB, 0xE1D3,
-	0xE1CB, 0xE0CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xF8F6, 0x40E4, 0x40E4, 0x60E4, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x80EC, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xCDF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1D3, 0x01D4,
-	0x00D4, 0xE0D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CE5, 0x40E4, 0x40E4, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0xA0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xA1F4, 0x9CFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01D4, 0x20DC,
-	0x20DC, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CFF, 0x41E4, 0x40E4, 0x60E4,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0xA0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC,
-	0xC1FC, 0xA1F4, 0x51F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D4, 0x20DC,
-	0x20DC, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x31EE, 0x40E4, 0x60E4,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x80F4, 0xA0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC3F4, 0xBEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D4, 0x20DC,
-	0x20DC, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEFF, 0x62DC, 0x40E4,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x80F4,
-	0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC,
-	0xA1F4, 0x39F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00D4, 0x20DC,
-	0x20DC, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x19F7, 0x40E4,
-	0x60E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xE4F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x11E6, 0x11EE,
-	0x11EE, 0x11E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x83E4,
-	0x40E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1F4,
-	0xDEFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDEFF,
-	0x41E4, 0x40EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0x8AF5,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x4AE5, 0x40E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xE3F4, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x83E4, 0x40EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xA1F4, 0x51F6, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD8EE, 0xD8EE,
-	0xD8EE, 0xD8EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x31EE, 0x40E4, 0x40EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x80F4, 0xA0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0x26F5, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60B3, 0x60B3,
-	0x60B3, 0x60B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xC5E4, 0x40EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60F4, 0x60EC, 0x80F4, 0xA0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xA1F4, 0xD6F6, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xC0CB, 0xC0CB,
-	0xC0CB, 0xC0CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xB6EE, 0x40E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60F4, 0x60EC, 0x60F4, 0x60F4, 0x60F4, 0x80F4, 0x80F4,
-	0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xA1FC, 0xABF5, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0CB, 0xE0D3,
-	0xE0D3, 0xE0CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x4AE5, 0x40EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60F4, 0x60F4, 0x80F4, 0x60F4,
-	0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xA1F4, 0x7BFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0D3, 0x00D4,
-	0x00D4, 0xE0D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x5BF7, 0x40E4, 0x40EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60F4, 0x60F4, 0x80F4, 0x60F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xA1FC, 0x30F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x19F7, 0x19F7,
-	0x19F7, 0x19F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x10EE, 0x40EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60F4, 0x80F4, 0x60F4, 0x80F4, 0x60F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xE1FC, 0xE1FC, 0xE1FC, 0xE1FC,
-	0xE1FC, 0xE1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC2F4, 0xBDFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBDFF, 0x61E4, 0x40EC, 0x60EC,
-	0x60EC, 0x60F4, 0x60F4, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC,
-	0xC0FC, 0xA1F4, 0xF7F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xD6F6, 0x40EC, 0x60EC,
-	0x60EC, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xA0FC, 0x05F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xA4E4, 0x60EC,
-	0x60EC, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC1F4, 0x9CFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CFF, 0x60EC,
-	0x60EC, 0x60EC, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0xA0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC1FC, 0xC1FC, 0xC1FC, 0xC1FC,
-	0xC1FC, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xA0FC,
-	0xABF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6AED,
-	0x40EC, 0x60EC, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0xA0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC1F4,
-	0xB5F6, 0xD7EE, 0xB7EE, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
-	0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
-	0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
-	0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
-	0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6,
-	0xB7E6, 0xB7E6, 0xB7E6, 0xB7E6, 0xB7EE, 0xB7EE, 0xD7EE, 0x94EE,
-	0x60EC, 0x60EC, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0xA0FC, 0xC0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xA0F4,
-	0x40E4, 0xC0CB, 0xA0C3, 0x80BB, 0x60BB, 0x60B3, 0x60BB, 0x60BB,
-	0x60B3, 0x60B3, 0x60B3, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB,
-	0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB,
-	0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB,
-	0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80BB,
-	0x80BB, 0x80BB, 0x80BB, 0x80BB, 0x80C3, 0xA0C3, 0xC0CB, 0xE0D3,
-	0x40EC, 0x60EC, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0xA0FC, 0xC0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xA0FC,
-	0x80F4, 0x80EC, 0x20DC, 0x00D4, 0xE0CB, 0xE0CB, 0xE0CB, 0xE0CB,
-	0xE0CB, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3,
-	0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3,
-	0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3,
-	0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3, 0xE0D3,
-	0xE0D3, 0x00D4, 0x00D4, 0x00D4, 0x00DC, 0x00DC, 0x20DC, 0x40E4,
-	0x40EC, 0x60EC, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xA0FC,
-	0xA0F4, 0x80F4, 0x80F4, 0x40E4, 0x20DC, 0x00DC, 0x00DC, 0x00DC,
-	0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x20DC,
-	0x00DC, 0x00DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC,
-	0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC,
-	0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20E4, 0x20DC,
-	0x20E4, 0x20E4, 0x20DC, 0x20E4, 0x20E4, 0x20E4, 0x40E4, 0x40EC,
-	0x60EC, 0x60EC, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0xA0FC, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xA0FC, 0xA0FC, 0xA0F4, 0x60EC, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40EC, 0x40E4, 0x40E4, 0x40EC, 0x40EC, 0x40EC, 0x40EC,
-	0x40EC, 0x40EC, 0x40EC, 0x40EC, 0x40EC, 0x40EC, 0x60EC, 0x60EC,
-	0x60EC, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x60EC, 0x60EC, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x60E4, 0x40E4, 0x40E4,
-	0x40EC, 0x40EC, 0x40E4, 0x40EC, 0x40EC, 0x40EC, 0x40EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0xC1FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x80EC, 0x60EC,
-	0x60E4, 0x60E4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60F4, 0x80F4, 0x60F4, 0x60F4, 0x60F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0xA0FC, 0x80F4, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0xE5E4, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0x80F4,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60F4, 0x60F4, 0x60F4, 0x60F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0xC5E4, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0x90D5, 0xA0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0x80F4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60F4, 0x60EC, 0x60EC, 0x60F4, 0x80F4, 0x60EC, 0x80F4, 0x80F4,
-	0x80F4, 0x60F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0xA0FC, 0x80F4, 0x80F4, 0x90D5, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDADE, 0xA6DC, 0xA0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0x80F4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60F4, 0x60F4, 0x60F4, 0x60F4, 0x60F4, 0x80F4, 0x60F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0xA0FC, 0x80F4, 0x85D4, 0xDADE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x57D6, 0xA5DC, 0x80F4,
-	0xA0F4, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC, 0xC0FC,
-	0xC0FC, 0xC0FC, 0x80F4, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC, 0x60EC,
-	0x60EC, 0x60F4, 0x60F4, 0x60F4, 0x60F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4,
-	0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x80F4, 0x60F4,
-	0x40EC, 0x85D4, 0x57D6, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x79D6, 0x4FCD,
-	0xC8D4, 0x63DC, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4, 0x40E4,
-	0x40E4, 0x40E4, 0x40E4, 0x00DC, 0x00D4, 0xE0D3, 0xE0D3, 0xE0D3,
-	0xE0D3, 0x00D4, 0xE0D3, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0xE0D3,
-	0xE0D3, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00D4, 0x00DC,
-	0x00D4, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
-	0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC,
-	0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x00DC, 0x20DC, 0x20DC,
-	0x00DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x20DC, 0x42DC, 0xA7D4,
-	0x4ECD, 0x79D6, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[143] = {
+	0x00D4, 0x00DC, 0x01D4, 0x02FD, 0x03FD, 0x05F5, 0x10EE, 0x11E6,
+	0x11EE, 0x18F7, 0x19F7, 0x1CE7, 0x20DC, 0x20E4, 0x23FD, 0x24FD,
+	0x26F5, 0x27F5, 0x30F6, 0x31EE, 0x34DE, 0x38C6, 0x39F7, 0x3CE7,
+	0x40E4, 0x40EC, 0x41DC, 0x41E4, 0x42DC, 0x44FD, 0x45FD, 0x46FD,
+	0x47F5, 0x49E5, 0x4AE5, 0x4ECD, 0x4FCD, 0x51F6, 0x52EE, 0x53EE,
+	0x57D6, 0x59CE, 0x5BF7, 0x5DEF, 0x60B3, 0x60BB, 0x60E4, 0x60EC,
+	0x60F4, 0x61B3, 0x61E4, 0x61EC, 0x62DC, 0x63DC, 0x67FD, 0x68F5,
+	0x68FD, 0x6AED, 0x73F6, 0x79CE, 0x79D6, 0x7BF7, 0x7BFF, 0x7CF7,
+	0x7DEF, 0x80BB, 0x80C3, 0x80EC, 0x80F4, 0x81B3, 0x83DC, 0x83E4,
+	0x84DC, 0x85D4, 0x88FD, 0x89F5, 0x8AF5, 0x8CE5, 0x8DE5, 0x90D5,
+	0x93F6, 0x94EE, 0x9BFF, 0x9CFF, 0x9DFF, 0x9EF7, 0xA0C3, 0xA0F4,
+	0xA0FC, 0xA1F4, 0xA1FC, 0xA4E4, 0xA5DC, 0xA6DC, 0xA7D4, 0xAAF5,
+	0xAAFD, 0xABF5, 0xB4F6, 0xB5F6, 0xB6EE, 0xB7E6, 0xB7EE, 0xBAD6,
+	0xBDFF, 0xBEF7, 0xBEFF, 0xC0CB, 0xC0FC, 0xC1C3, 0xC1CB, 0xC1F4,
+	0xC1FC, 0xC2F4, 0xC3F4, 0xC5E4, 0xC6DC, 0xC8D4, 0xCCF5, 0xCDF5,
+	0xD6F6, 0xD7EE, 0xD8EE, 0xDADE, 0xDBDE, 0xDEFF, 0xDFFF, 0xE0CB,
+	0xE0D3, 0xE1CB, 0xE1D3, 0xE1FC, 0xE2FC, 0xE3F4, 0xE4F4, 0xE5E4,
+	0xE6E4, 0xEDF5, 0xF6F6, 0xF7F6, 0xF8F6, 0xFBDE, 0xFFFF
 };
+
+static const uint8_t data[2019] = {
+	0x83, 0x8E, 0x04, 0x7E, 0x69, 0x62, 0x89, 0x38, 0x97, 0x1E, 0x85, 0x1D, 0x9A, 0x0F, 0x89, 0x0E,
+	0x83, 0x04, 0x03, 0x1F, 0x76, 0x50, 0x6A, 0x84, 0x8E, 0x82, 0x8E, 0x04, 0x7E, 0x3F, 0x60, 0x0F,
+	0x04, 0x8A, 0x03, 0x8C, 0x84, 0x98, 0x83, 0x83, 0x70, 0x93, 0x6C, 0x04, 0x83, 0x84, 0x4A, 0x2A,
+	0x7E, 0x82, 0x8E, 0x81, 0x8E, 0x03, 0x7E, 0x55, 0x5F, 0x04, 0x8B, 0x03, 0x8C, 0x84, 0x9A, 0x83,
+	0x82, 0x70, 0x96, 0x6C, 0x01, 0x37, 0x55, 0x82, 0x8E, 0x81, 0x8E, 0x02, 0x69, 0x27, 0x04, 0x8C,
+	0x03, 0x8C, 0x84, 0x98, 0x83, 0x84, 0x70, 0x97, 0x6C, 0x01, 0x27, 0x69, 0x81, 0x8E, 0x80, 0x8E,
+	0x02, 0x7E, 0x55, 0x4B, 0x8C, 0x03, 0x8C, 0x84, 0x9A, 0x83, 0x82, 0x70, 0x98, 0x6C, 0x02, 0x20,
+	0x55, 0x7E, 0x80, 0x8E, 0x80, 0x8E, 0x02, 0x7E, 0x2B, 0x0E, 0x8A, 0x03, 0x8D, 0x84, 0x9A, 0x83,
+	0x83, 0x70, 0x98, 0x6C, 0x02, 0x83, 0x2B, 0x7E, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x17, 0x89,
+	0x03, 0x01, 0x84, 0x03, 0x8D, 0x84, 0x9A, 0x83, 0x83, 0x70, 0x99, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x17, 0x89, 0x03, 0x8E, 0x84, 0x9A, 0x83, 0x83, 0x70, 0x9A, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x86, 0x03, 0x90, 0x84, 0x9B, 0x83,
+	0x83, 0x70, 0x9A, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x84, 0x03,
+	0x91, 0x84, 0x9C, 0x83, 0x82, 0x70, 0x9B, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01,
+	0x69, 0x0B, 0x82, 0x03, 0x92, 0x84, 0x9D, 0x83, 0x82, 0x70, 0x9B, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x02, 0x69, 0x0B, 0x03, 0x94, 0x84, 0x92, 0x83, 0x80, 0x36, 0x80, 0x70, 0x85,
+	0x83, 0x83, 0x70, 0x9B, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x94,
+	0x84, 0x92, 0x83, 0x00, 0x70, 0x80, 0x8B, 0x00, 0x59, 0x80, 0x70, 0x84, 0x83, 0x82, 0x70, 0x9C,
+	0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x93, 0x84, 0x92, 0x83, 0x01,
+	0x70, 0x4B, 0x80, 0x8E, 0x01, 0x21, 0x59, 0x80, 0x70, 0x82, 0x83, 0x83, 0x70, 0x9C, 0x6C, 0x01,
+	0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x92, 0x84, 0x92, 0x83, 0x02, 0x70, 0x6F,
+	0x52, 0x80, 0x8E, 0x02, 0x3D, 0x1B, 0x59, 0x80, 0x70, 0x80, 0x83, 0x83, 0x70, 0x9D, 0x6C, 0x01,
+	0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x91, 0x84, 0x92, 0x83, 0x80, 0x70, 0x00,
+	0x3A, 0x82, 0x8E, 0x03, 0x26, 0x1B, 0x59, 0x70, 0x80, 0x83, 0x83, 0x70, 0x9D, 0x6C, 0x01, 0x17,
+	0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x8F, 0x84, 0x94, 0x83, 0x02, 0x70, 0x85, 0x7D,
+	0x82, 0x8E, 0x02, 0x7D, 0x1C, 0x1B, 0x85, 0x70, 0x9E, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80,
+	0x8E, 0x01, 0x69, 0x0B, 0x8E, 0x84, 0x94, 0x83, 0x02, 0x70, 0x6F, 0x8A, 0x84, 0x8E, 0x02, 0x64,
+	0x1A, 0x32, 0x84, 0x70, 0x9E, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B,
+	0x8C, 0x84, 0x96, 0x83, 0x01, 0x70, 0x11, 0x86, 0x8E, 0x02, 0x74, 0x1A, 0x32, 0x82, 0x70, 0x9F,
+	0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x8A, 0x84, 0x97, 0x83, 0x02,
+	0x70, 0x6F, 0x68, 0x86, 0x8E, 0x03, 0x54, 0x1A, 0x1B, 0x32, 0x81, 0x70, 0x9F, 0x6C, 0x01, 0x17,
+	0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x87, 0x84, 0x99, 0x83, 0x80, 0x70, 0x00, 0x77,
+	0x88, 0x8E, 0x04, 0x4E, 0x1A, 0x1B, 0x33, 0x70, 0xA0, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80,
+	0x8E, 0x01, 0x69, 0x0B, 0x84, 0x84, 0x9C, 0x83, 0x02, 0x70, 0x71, 0x6A, 0x88, 0x8E, 0x01, 0x6A,
+	0x1A, 0x80, 0x1B, 0x00, 0x2F, 0xA0, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x02, 0x69,
+	0x0B, 0x84, 0xA0, 0x83, 0x02, 0x70, 0x6F, 0x25, 0x8A, 0x8E, 0x04, 0x08, 0x1A, 0x1B, 0x18, 0x2F,
+	0x9F, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0xA1, 0x83, 0x01, 0x70,
+	0x05, 0x8C, 0x8E, 0x00, 0x48, 0x80, 0x18, 0x01, 0x2E, 0x2F, 0x9E, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0xA0, 0x83, 0x02, 0x70, 0x6F, 0x09, 0x8C, 0x8E, 0x02, 0x09,
+	0x0C, 0x18, 0x80, 0x2E, 0x00, 0x2F, 0x9D, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01,
+	0x69, 0x0B, 0x9E, 0x83, 0x81, 0x70, 0x00, 0x10, 0x8E, 0x8E, 0x00, 0x74, 0x80, 0x18, 0x02, 0x2E,
+	0x2F, 0x43, 0x9C, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9E, 0x83,
+	0x80, 0x70, 0x01, 0x59, 0x53, 0x8E, 0x8E, 0x03, 0x53, 0x1A, 0x18, 0x2E, 0x81, 0x2F, 0x00, 0x58,
+	0x9A, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9D, 0x83, 0x81, 0x70,
+	0x00, 0x77, 0x90, 0x8E, 0x00, 0x4E, 0x80, 0x18, 0x82, 0x2F, 0x9A, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9C, 0x83, 0x81, 0x70, 0x00, 0x86, 0x86, 0x8E, 0x82, 0x14,
+	0x86, 0x8E, 0x03, 0x46, 0x18, 0x2F, 0x2E, 0x81, 0x2F, 0x99, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E,
+	0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9C, 0x83, 0x80, 0x70, 0x01, 0x6F, 0x3A, 0x86, 0x8E, 0x00, 0x31,
+	0x81, 0x45, 0x86, 0x8E, 0x00, 0x27, 0x80, 0x18, 0x00, 0x2E, 0x82, 0x2F, 0x98, 0x6C, 0x01, 0x17,
+	0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9B, 0x83, 0x81, 0x70, 0x00, 0x20, 0x87, 0x8E,
+	0x00, 0x6D, 0x80, 0x6E, 0x00, 0x6D, 0x87, 0x8E, 0x02, 0x88, 0x18, 0x2E, 0x83, 0x2F, 0x97, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x9B, 0x83, 0x80, 0x70, 0x01, 0x59,
+	0x09, 0x87, 0x8E, 0x03, 0x81, 0x82, 0x81, 0x7F, 0x87, 0x8E, 0x00, 0x8C, 0x80, 0x18, 0x00, 0x2E,
+	0x82, 0x2F, 0x01, 0x43, 0x58, 0x95, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69,
+	0x0B, 0x9A, 0x83, 0x81, 0x70, 0x00, 0x77, 0x88, 0x8E, 0x03, 0x82, 0x02, 0x00, 0x80, 0x88, 0x8E,
+	0x00, 0x4D, 0x80, 0x18, 0x84, 0x2F, 0x00, 0x58, 0x94, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80,
+	0x8E, 0x01, 0x69, 0x0B, 0x99, 0x83, 0x81, 0x70, 0x01, 0x59, 0x53, 0x88, 0x8E, 0x00, 0x02, 0x80,
+	0x0C, 0x00, 0x00, 0x88, 0x8E, 0x03, 0x53, 0x1B, 0x18, 0x2E, 0x84, 0x2F, 0x00, 0x58, 0x93, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x99, 0x83, 0x80, 0x70, 0x01, 0x59,
+	0x25, 0x89, 0x8E, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x89, 0x8E, 0x02, 0x13, 0x18, 0x2E, 0x84,
+	0x2F, 0x01, 0x44, 0x58, 0x92, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B,
+	0x98, 0x83, 0x81, 0x70, 0x01, 0x72, 0x6A, 0x89, 0x8E, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x89,
+	0x8E, 0x02, 0x6A, 0x34, 0x18, 0x85, 0x2F, 0x01, 0x44, 0x58, 0x91, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x98, 0x83, 0x80, 0x70, 0x01, 0x59, 0x16, 0x8A, 0x8E, 0x00,
+	0x00, 0x80, 0x0C, 0x00, 0x00, 0x8A, 0x8E, 0x02, 0x0A, 0x18, 0x2E, 0x85, 0x2F, 0x01, 0x44, 0x58,
+	0x90, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x97, 0x83, 0x81, 0x70,
+	0x00, 0x86, 0x8B, 0x8E, 0x00, 0x07, 0x80, 0x08, 0x00, 0x07, 0x8B, 0x8E, 0x01, 0x47, 0x18, 0x86,
+	0x2F, 0x01, 0x44, 0x58, 0x8F, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B,
+	0x97, 0x83, 0x80, 0x70, 0x01, 0x6F, 0x7D, 0x9C, 0x8E, 0x02, 0x7D, 0x1B, 0x19, 0x86, 0x2F, 0x01,
+	0x44, 0x58, 0x8E, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x96, 0x83,
+	0x81, 0x70, 0x00, 0x4C, 0x9E, 0x8E, 0x01, 0x22, 0x18, 0x87, 0x2F, 0x01, 0x44, 0x58, 0x8D, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x95, 0x83, 0x81, 0x70, 0x00, 0x85,
+	0xA0, 0x8E, 0x01, 0x47, 0x19, 0x87, 0x2F, 0x01, 0x44, 0x58, 0x8C, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x95, 0x83, 0x80, 0x70, 0x01, 0x59, 0x25, 0x8D, 0x8E, 0x82,
+	0x7A, 0x8D, 0x8E, 0x02, 0x13, 0x18, 0x19, 0x87, 0x2F, 0x01, 0x44, 0x58, 0x8B, 0x6C, 0x01, 0x17,
+	0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x94, 0x83, 0x81, 0x70, 0x00, 0x10, 0x8E, 0x8E,
+	0x82, 0x2C, 0x8E, 0x8E, 0x01, 0x73, 0x19, 0x86, 0x2F, 0x03, 0x30, 0x2F, 0x44, 0x58, 0x8A, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x91, 0x83, 0x83, 0x70, 0x01, 0x59,
+	0x78, 0x8E, 0x8E, 0x82, 0x6B, 0x8E, 0x8E, 0x01, 0x64, 0x18, 0x83, 0x2F, 0x01, 0x30, 0x2F, 0x81,
+	0x30, 0x80, 0x44, 0x00, 0x58, 0x89, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69,
+	0x0B, 0x8F, 0x83, 0x84, 0x70, 0x01, 0x5A, 0x61, 0x8F, 0x8E, 0x00, 0x7F, 0x80, 0x80, 0x00, 0x7F,
+	0x8F, 0x8E, 0x01, 0x22, 0x19, 0x85, 0x2F, 0x80, 0x30, 0x03, 0x44, 0x30, 0x44, 0x58, 0x88, 0x6C,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x8B, 0x83, 0x88, 0x70, 0x01, 0x59,
+	0x3E, 0x8F, 0x8E, 0x00, 0x80, 0x80, 0x00, 0x00, 0x80, 0x8F, 0x8E, 0x02, 0x2A, 0x18, 0x19, 0x82,
+	0x2F, 0x80, 0x30, 0x01, 0x44, 0x30, 0x82, 0x44, 0x00, 0x58, 0x87, 0x6C, 0x01, 0x17, 0x69, 0x80,
+	0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x87, 0x83, 0x8B, 0x70, 0x01, 0x5A, 0x12, 0x90, 0x8E, 0x82,
+	0x0A, 0x90, 0x8E, 0x01, 0x06, 0x19, 0x81, 0x2F, 0x04, 0x30, 0x44, 0x30, 0x44, 0x30, 0x83, 0x44,
+	0x00, 0x58, 0x86, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x84, 0x83,
+	0x8E, 0x70, 0x01, 0x71, 0x68, 0xA6, 0x8E, 0x02, 0x68, 0x32, 0x19, 0x80, 0x2F, 0x81, 0x30, 0x86,
+	0x44, 0x00, 0x58, 0x85, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x91,
+	0x70, 0x80, 0x6C, 0x01, 0x59, 0x8B, 0xA8, 0x8E, 0x01, 0x78, 0x19, 0x80, 0x2F, 0x00, 0x30, 0x89,
+	0x44, 0x00, 0x58, 0x84, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x8E,
+	0x70, 0x82, 0x6C, 0x01, 0x58, 0x05, 0xAA, 0x8E, 0x00, 0x5B, 0x80, 0x2F, 0x00, 0x30, 0x8A, 0x44,
+	0x00, 0x58, 0x83, 0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x8A, 0x70,
+	0x86, 0x6C, 0x01, 0x6F, 0x53, 0xAA, 0x8E, 0x00, 0x53, 0x81, 0x2F, 0x8B, 0x44, 0x00, 0x58, 0x82,
+	0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x84, 0x70, 0x8B, 0x6C, 0x01,
+	0x58, 0x61, 0xAC, 0x8E, 0x03, 0x39, 0x19, 0x2F, 0x30, 0x8B, 0x44, 0x00, 0x58, 0x81, 0x6C, 0x01,
+	0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x91, 0x6C, 0x03, 0x6F, 0x63, 0x79, 0x66,
+	0xA7, 0x65, 0x80, 0x66, 0x01, 0x79, 0x51, 0x80, 0x2F, 0x00, 0x30, 0x8C, 0x44, 0x00, 0x58, 0x80,
+	0x6C, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x91, 0x6C, 0x06, 0x57, 0x18,
+	0x6B, 0x56, 0x41, 0x2D, 0x2C, 0x80, 0x2D, 0x81, 0x2C, 0x9F, 0x41, 0x05, 0x42, 0x56, 0x6B, 0x80,
+	0x19, 0x2F, 0x8E, 0x44, 0x03, 0x58, 0x6C, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B,
+	0x91, 0x6C, 0x04, 0x58, 0x44, 0x43, 0x0C, 0x00, 0x83, 0x7F, 0x9E, 0x80, 0x81, 0x00, 0x80, 0x01,
+	0x03, 0x0C, 0x18, 0x19, 0x2F, 0x8F, 0x44, 0x02, 0x58, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01,
+	0x69, 0x0B, 0x91, 0x6C, 0x01, 0x58, 0x57, 0x80, 0x44, 0x01, 0x18, 0x0C, 0x88, 0x01, 0x00, 0x0C,
+	0x80, 0x01, 0x92, 0x0C, 0x01, 0x0D, 0x0C, 0x80, 0x0D, 0x00, 0x0C, 0x81, 0x0D, 0x01, 0x18, 0x19,
+	0x80, 0x2F, 0x8F, 0x44, 0x02, 0x58, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x93,
+	0x6C, 0x80, 0x58, 0x01, 0x57, 0x2F, 0x9A, 0x18, 0x00, 0x19, 0x80, 0x18, 0x88, 0x19, 0x81, 0x2F,
+	0x91, 0x44, 0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x01, 0x69, 0x0B, 0x97, 0x6C, 0x80, 0x2F,
+	0x84, 0x18, 0x00, 0x2E, 0x80, 0x18, 0x80, 0x19, 0x00, 0x18, 0x82, 0x19, 0x97, 0x2F, 0x92, 0x44,
+	0x01, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x02, 0x69, 0x0B, 0x70, 0x97, 0x6C, 0x01, 0x43, 0x2F,
+	0x80, 0x2E, 0x9D, 0x2F, 0x01, 0x30, 0x44, 0x81, 0x30, 0x92, 0x44, 0x03, 0x58, 0x44, 0x17, 0x69,
+	0x80, 0x8E, 0x80, 0x8E, 0x02, 0x69, 0x17, 0x87, 0x98, 0x6C, 0x00, 0x44, 0x9A, 0x2F, 0x82, 0x30,
+	0x99, 0x44, 0x02, 0x73, 0x17, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x03, 0x69, 0x2B, 0x4F, 0x58, 0x98,
+	0x6C, 0x00, 0x44, 0x95, 0x2F, 0x00, 0x30, 0x80, 0x2F, 0x02, 0x30, 0x44, 0x2F, 0x81, 0x44, 0x00,
+	0x30, 0x94, 0x44, 0x00, 0x58, 0x80, 0x44, 0x02, 0x4F, 0x2B, 0x69, 0x80, 0x8E, 0x80, 0x8E, 0x04,
+	0x7E, 0x40, 0x7B, 0x5D, 0x58, 0x98, 0x6C, 0x00, 0x44, 0x94, 0x2F, 0x83, 0x30, 0x01, 0x44, 0x30,
+	0x97, 0x44, 0x05, 0x58, 0x44, 0x49, 0x7B, 0x40, 0x7E, 0x80, 0x8E, 0x80, 0x8E, 0x06, 0x7E, 0x55,
+	0x0B, 0x28, 0x5C, 0x44, 0x57, 0x97, 0x6C, 0x00, 0x44, 0x94, 0x2F, 0x82, 0x30, 0x98, 0x44, 0x06,
+	0x30, 0x19, 0x49, 0x28, 0x0B, 0x55, 0x7E, 0x80, 0x8E, 0x81, 0x8E, 0x06, 0x7E, 0x40, 0x8D, 0x3C,
+	0x24, 0x75, 0x35, 0x97, 0x18, 0x01, 0x01, 0x00, 0x82, 0x80, 0x01, 0x00, 0x80, 0x82, 0x00, 0x80,
+	0x80, 0x84, 0x00, 0x01, 0x01, 0x00, 0x93, 0x01, 0x80, 0x0C, 0x00, 0x01, 0x83, 0x0C, 0x06, 0x1C,
+	0x5E, 0x23, 0x3C, 0x8D, 0x40, 0x7E, 0x81, 0x8E, 0x82, 0x8E, 0x05, 0x69, 0x40, 0x0B, 0x67, 0x3B,
+	0x29, 0xCA, 0x15, 0x05, 0x29, 0x3B, 0x67, 0x0B, 0x40, 0x69, 0x82, 0x8E, 0x82, 0x8E, 0x04, 0x7E,
+	0x69, 0x55, 0x2B, 0x0B, 0x80, 0x8D, 0xC8, 0x7C, 0x80, 0x8D, 0x03, 0x0B, 0x2B, 0x55, 0x69, 0x83,
+	0x8E, 0x84, 0x8E, 0x00, 0x7E, 0x80, 0x69, 0x81, 0x55, 0xC7, 0x40, 0x80, 0x55, 0x80, 0x69, 0x00,
+	0x7E, 0x84, 0x8E
+};
+
+const CompressedIcon warningIcon = {96, 67, 143, palette, data};
@@ -2,810 +2,198 @@
 // http://github.com/dangrie158
 
 #include <Arduino.h>
+#include "CompressedIcon.h"
 
-const uint16_t wlanIcon[6432] = {
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0xDDA6,
-	0x3E6E, 0xFE45, 0xDE2D, 0xDE2D, 0xDE2D, 0xDE2D, 0xDE2D, 0xDE2D,
-	0xDE2D, 0xDE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D,
-	0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D,
-	0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D,
-	0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE2D, 0xBE25, 0xBE25,
-	0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25,
-	0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25, 0xBE25,
-	0xBE25, 0xBE25, 0xBE25, 0x9E25, 0x9E25, 0x9E25, 0x9E25, 0x9E25,
-	0x9E25, 0x9E25, 0x9E25, 0x9E25, 0x9E25, 0x9E25, 0x9E25, 0x9E25,
-	0x9E25, 0x9E1D, 0x9E1D, 0x9E1D, 0x9E1D, 0x9E1D, 0xBE35, 0x1D66,
-	0xBDA6, 0xBFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7EE7, 0x1E56, 0xBE25,
-	0x9E1D, 0x9E1D, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15,
-	0x9E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x7E0D,
-	0x7E15, 0xDE4D, 0x7EDF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1D56, 0x9E1D, 0x9E15,
-	0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15,
-	0x9E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E0D, 0xDD4D, 0x9EF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x9C9E, 0x9E1D, 0x9E15, 0x9E15,
-	0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E0D, 0x7C9E, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0xDD4D, 0x9E15, 0x9E15, 0x9E15,
-	0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0xBD3D, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x5DEF, 0x9E25, 0x9E15, 0x9E15, 0x9E15,
-	0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x9E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x7E0D, 0x5DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x9E15, 0x9E15, 0x9E15, 0x9E15,
-	0x9E15, 0x9E15, 0x9E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x9E15, 0x9E15, 0x9E15, 0x9E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x9E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x5E15,
-	0x7E15, 0xBD35, 0xFE55, 0x7E7E, 0xFEA6, 0x3EC7, 0x7FD7, 0xBFE7,
-	0xBFE7, 0x7FD7, 0x3EC7, 0xFEAE, 0x7E7E, 0xFD55, 0xBE35, 0x7E15,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E1D, 0xFE4D, 0x7E7E, 0xDE9E, 0x5ECF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x7FD7, 0xDEA6, 0x7E7E, 0xDD4D, 0x7D1D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x5E15, 0x9D2D, 0xDE9E, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFF7, 0xFEAE, 0x9D2D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x9E2D, 0x7E7E,
-	0x3EC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3EC7,
-	0x7E7E, 0x9D25, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x3D6E, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0x5D7E, 0x5D15, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E1D, 0x5D7E, 0x7ED7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x7EDF, 0x7D7E, 0x7D1D, 0x5E0D, 0x5E0D,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7D25, 0x5ECF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7ED7, 0x7D25, 0x5E0D,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFF7, 0x9EEF, 0x7EE7, 0x7EE7,
-	0x7EE7, 0x7EE7, 0x9EEF, 0xBFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7D86,
-	0x5D0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x5E15, 0x9D25, 0x9FDF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEEF,
-	0x3DD7, 0x1A9E, 0x352C, 0xB50B, 0xB50B, 0xD50B, 0xD50B, 0xD50B,
-	0xD50B, 0xD50B, 0xD50B, 0xD50B, 0xD50B, 0x362C, 0x1A96, 0x3DD7,
-	0xBEEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9FE7, 0x7D1D, 0x3E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0xDD4D, 0x7ED7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDCC6, 0x5875, 0xD74C, 0xD513,
-	0xD50B, 0xF60B, 0x370C, 0x580C, 0x580C, 0x580C, 0x580C, 0x580C,
-	0x580C, 0x580C, 0x580C, 0x580C, 0x580C, 0x370C, 0xF60B, 0xD50B,
-	0xD50B, 0xB74C, 0x586D, 0xDCBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x5ED7, 0xBD45, 0x3D05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x5E15, 0xFD5D, 0xFFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xBFF7, 0x9CB6, 0xD40B, 0xD50B, 0x160C, 0x370C, 0x580C,
-	0x580C, 0x580C, 0x780C, 0x790C, 0x790C, 0x990C, 0x790C, 0x790C,
-	0x790C, 0x990C, 0x990C, 0x790C, 0x790C, 0x790C, 0x780C, 0x580C,
-	0x580C, 0x370C, 0x170C, 0xF60B, 0xD50B, 0x9CB6, 0xBFF7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0xDD55, 0x3D05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x5E15, 0x5D7E, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7,
-	0xD98D, 0x763C, 0xF50B, 0x370C, 0x580C, 0x580C, 0x780C, 0x790C,
-	0x990C, 0x990C, 0x990C, 0x9A0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C,
-	0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0x9A0C, 0x990C,
-	0x790C, 0x790C, 0x790C, 0x580C, 0x580C, 0xF60B, 0x7734, 0xDA85,
-	0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0x3D76, 0x3D05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x5E15, 0xDD45, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDCC6, 0xB40B,
-	0xF60B, 0x370C, 0x580C, 0x780C, 0x790C, 0x990C, 0x990C, 0xBA0C,
-	0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xDA0C, 0xDA0C,
-	0xDA0C, 0xDA0C, 0xDA0C, 0xDA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C,
-	0xBA0C, 0x9A0C, 0x9A0C, 0x990C, 0x790C, 0x780C, 0x580C, 0x160C,
-	0xD503, 0xDCBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0x7C3D, 0x3E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x5E15, 0x3C15, 0x5A4D, 0x9EEF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EE7, 0x175D, 0xF513, 0x370C,
-	0x580C, 0x790C, 0x990C, 0x990C, 0xBA0C, 0xBA0C, 0xBA0C, 0xDA0C,
-	0xBA0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xBA0C, 0xBA0C, 0xBA0C, 0x990C, 0x990C, 0x780C,
-	0x5804, 0x160C, 0x1855, 0x5EDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x9EEF, 0x1945, 0x9A04, 0xFC04, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x5E15, 0x3D15, 0xFB14, 0x3955, 0xBFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0x1DD7, 0x1524, 0x170C, 0x580C, 0x780C,
-	0x990C, 0x990C, 0xBA0C, 0xBA0C, 0xBA0C, 0xDA0C, 0xDA0C, 0xDA0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDA0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xBA0C, 0xBA0C, 0x9A0C,
-	0x7904, 0x5804, 0x3704, 0x161C, 0x1DCF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBFF7, 0xF84C, 0x7904, 0xBA04, 0xDB04, 0xFC04,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x5E15, 0x3D15, 0x1C15, 0xDA14, 0xF84C, 0x9EEF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFA95, 0xD50B, 0x370C, 0x780C, 0x790C, 0x990C,
-	0xBA0C, 0xBA0C, 0xBA0C, 0xDA0C, 0xDA0C, 0xDA0C, 0xDB0C, 0xDA0C,
-	0xDA0C, 0xDA0C, 0xFB1C, 0xBB5D, 0x9D9E, 0xDDAE, 0xDDB6, 0xDDB6,
-	0xDDB6, 0xDDB6, 0xDDAE, 0x9D9E, 0xDC65, 0xFB1C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xBA0C,
-	0xBA0C, 0x9A0C, 0x7904, 0x5804, 0xF603, 0xFA95, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x9EEF, 0xD844, 0x5804, 0x9A04, 0xBB04, 0xDB04, 0xFC04,
-	0xFC04, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x5D15, 0x3D15, 0x1C15, 0xBA14, 0x1855, 0xBFF7,
-	0xDFF7, 0xB97D, 0xF60B, 0x580C, 0x790C, 0x990C, 0x990C, 0xBA0C,
-	0xBA0C, 0xDA0C, 0xDA0C, 0xDA0C, 0xDB0C, 0xDA0C, 0xFB1C, 0x5B45,
-	0x5C8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7D96,
-	0x7B3D, 0x1B25, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xBA0C, 0x9A04, 0x9904, 0x7904, 0x1704, 0x997D, 0xDFF7,
-	0xBFF7, 0xF84C, 0x3804, 0x9904, 0xBA04, 0xDB04, 0xDB04, 0xFC04,
-	0xFC04, 0x1C05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x5E15, 0x5D15, 0x3C15, 0xFC0C, 0xBA0C, 0xD844,
-	0x385D, 0x160C, 0x580C, 0x790C, 0x990C, 0x9A0C, 0xBA0C, 0xDA0C,
-	0xDA0C, 0xDA0C, 0xDA0C, 0xBA0C, 0xFA1C, 0xDDB6, 0x5ED7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x7EDF, 0xFDB6, 0x3B2D, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xBB04, 0xBA04, 0x9A04, 0x7904, 0x3704, 0x385D,
-	0xB83C, 0x5804, 0x7904, 0x9A04, 0xDB04, 0xDB04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x5E0D, 0x5D0D, 0x3C0D, 0x1C0D, 0xDB0C,
-	0x580C, 0x780C, 0x790C, 0x990C, 0xBA0C, 0xBA0C, 0xDA0C, 0xDA0C,
-	0xDA0C, 0xDA0C, 0x1B2D, 0xFC6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x3C86, 0x3B2D, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xFB04, 0xDB04, 0xDB04, 0xBA04, 0x9A04, 0x7904, 0x5804,
-	0x5904, 0x9A04, 0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5D0D, 0x3D0D, 0x1C0D,
-	0x1C0D, 0xBA0C, 0x9A0C, 0xBA0C, 0xBA0C, 0xDA0C, 0xDA0C, 0xDA0C,
-	0xBA0C, 0xDB65, 0x9EE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE7, 0x1C76, 0xDB0C,
-	0xDB04, 0xFC04, 0xFB04, 0xDB04, 0xDB04, 0xBB04, 0xBA04, 0x9A04,
-	0x9A04, 0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1D05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E15, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5D0D, 0x5D0D,
-	0x5D0D, 0x5D0D, 0xDB0C, 0xBA0C, 0xDA0C, 0xDA0C, 0xBA0C, 0xDA1C,
-	0xBDAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDDB6,
-	0xFB14, 0xDB04, 0xFB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1D05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E15, 0x7E15, 0x7E15, 0x7E15,
-	0x7E15, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x7E0D, 0xFB0C, 0xDA0C, 0xBA0C, 0x3A35, 0x5ED7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x5ED7, 0x3B35, 0xDB04, 0xDB04, 0xFC04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1D05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0xDB0C, 0xFA24, 0x5ED7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7, 0x3DD7, 0xDCBE,
-	0xDCBE, 0x3DD7, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x5ED7, 0x1B1D, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1D05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0xFA24, 0x5ED7, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFF7, 0x586D, 0x9644, 0x7634, 0x361C, 0xF50B,
-	0xF50B, 0x161C, 0x7634, 0x9744, 0x586D, 0xDFF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0x5ED7, 0xFB1C, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0x1D05, 0x5E05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5D0D, 0x3D0D, 0xF844, 0x9EE7,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFF7,
-	0x9CB6, 0x963C, 0xD50B, 0x160C, 0x370C, 0x370C, 0x580C, 0x580C,
-	0x580C, 0x580C, 0x370C, 0x370C, 0x170C, 0xD50B, 0x763C, 0x9CB6,
-	0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0x9EE7, 0xF93C, 0xBA04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05,
-	0x1C05, 0x1D05, 0x5E05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5D0D, 0x3D0D, 0xFB0C, 0x972C,
-	0x7EE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xB985, 0x562C,
-	0xF60B, 0x370C, 0x580C, 0x790C, 0x790C, 0x790C, 0x990C, 0x990C,
-	0x990C, 0x990C, 0x990C, 0x790C, 0x790C, 0x580C, 0x3704, 0xF60B,
-	0x562C, 0xB985, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x7EE7,
-	0x972C, 0x7904, 0xBA04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04,
-	0xFC04, 0x1C05, 0x1D05, 0x5E05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x3D0D, 0x1C0D, 0xDA0C,
-	0xF84C, 0xBEEF, 0xFFFF, 0xFFFF, 0xFCC6, 0x7634, 0xF60B, 0x370C,
-	0x780C, 0x790C, 0x990C, 0x990C, 0x9A0C, 0xBA0C, 0xBA0C, 0xBA0C,
-	0xBA0C, 0xBA0C, 0xBA0C, 0xBA0C, 0x9A0C, 0x990C, 0x7904, 0x7904,
-	0x3804, 0x1604, 0x762C, 0xFCC6, 0xFFFF, 0xFFFF, 0xBFEF, 0xF84C,
-	0x5804, 0x9A04, 0xBB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1D05,
-	0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x3D0D, 0x1D0D, 0xFC0C,
-	0xBA0C, 0x9734, 0xBEEF, 0x3A9E, 0x161C, 0x370C, 0x780C, 0x790C,
-	0x990C, 0x9A0C, 0xBA0C, 0xBA0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xBB0C, 0xBA0C, 0xBA0C, 0x9A0C,
-	0x990C, 0x7904, 0x3804, 0x1614, 0x3B9E, 0xBFEF, 0x9734, 0x5804,
-	0x9A04, 0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1C05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D, 0x1D0D,
-	0xFC0C, 0xDA0C, 0x772C, 0x170C, 0x580C, 0x790C, 0x990C, 0x9A0C,
-	0xBA0C, 0xBA0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xBA04, 0x9A04, 0x9904, 0x7904, 0x1704, 0x772C, 0x5804, 0x9A04,
-	0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1D05, 0x1C05, 0x1D05,
-	0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D,
-	0x1D0D, 0x1C0D, 0xFB0C, 0x990C, 0x990C, 0x9A0C, 0xBA0C, 0xBA0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB04, 0xDB04, 0xBA04, 0x9A04, 0x9A04, 0x7904, 0x9A04, 0xBA04,
-	0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0x1C05, 0x1C05, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1C05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x3D0D, 0x3D0D, 0x3D0D, 0x3D0D, 0xBA0C, 0xBA0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0xDB0C, 0xDB0C, 0x9C45, 0xDC65, 0x1C76, 0x9D9E,
-	0x9D9E, 0x1C76, 0xDC65, 0x9C45, 0xDB0C, 0xDB0C, 0xDB0C, 0xFB04,
-	0xDB04, 0xDB04, 0xDB04, 0xBB04, 0xBA04, 0xBA04, 0xBB04, 0xDB04,
-	0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1C05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5D0D, 0x5D0D, 0x5D0D, 0x5E0D, 0xDB0C, 0xDB0C, 0xDB0C,
-	0xDB0C, 0xDB0C, 0x5B3D, 0x7EDF, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7, 0x7EDF, 0x7B3D, 0xDB04, 0xFB04,
-	0xFB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0x1C05, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0xDB0C, 0xDB0C,
-	0xFB1C, 0x5C86, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x5C86, 0xFB14,
-	0xDB04, 0xFC04, 0xFC04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04,
-	0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1C05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0xFB14,
-	0xFDBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFDB6,
-	0xFB0C, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04,
-	0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D,
-	0x5A55, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0x5A55,
-	0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1C05, 0x1D05,
-	0x1C05, 0x1D05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D,
-	0xFB0C, 0xB834, 0xBFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7, 0xB834, 0x7904,
-	0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1C05, 0xFC04, 0x1D05, 0x1C05,
-	0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D,
-	0x1C0D, 0xDB0C, 0x1855, 0xBFEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBFEF, 0x1855, 0x7904, 0x9A04,
-	0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x3D0D,
-	0x1D0D, 0xFC0C, 0x9A0C, 0x9734, 0xDFF7, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFF7, 0x9734, 0x5804, 0x9A04, 0xBA04,
-	0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x3D0D, 0x1C0D, 0xFB0C, 0xBA0C, 0xF84C, 0xBFEF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBFEF, 0xF84C, 0x5804, 0x7904, 0x9A04, 0xBB04,
-	0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05,
-	0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5D0D, 0x3D0D, 0x1C0D, 0xFB04, 0x9A04, 0x9734, 0xBFF7, 0xFFFF,
-	0xFFFF, 0xBFF7, 0x9734, 0x3804, 0x7904, 0x9A04, 0xDB04, 0xDB04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x7E0D, 0x7E0D, 0x7E0D, 0x7E0D,
-	0x7E0D, 0x7E0D, 0x7E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5D05, 0x3D05, 0x1C05, 0xFB04, 0xBA04, 0xF84C, 0xBFEF,
-	0xBFEF, 0xF84C, 0x5804, 0x7904, 0xBA04, 0xBB04, 0xDB04, 0xDB04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0x1D05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x7E0D, 0x7E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E05, 0x5E05, 0x3D05, 0x3D05, 0x1C05, 0xDB04, 0xBA04, 0x9734,
-	0x9734, 0x5804, 0x7904, 0x9A04, 0xDB04, 0xDB04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05,
-	0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x3D05, 0x3D05, 0x1C05, 0xFC04, 0xDB04,
-	0x7904, 0x9A04, 0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1D05,
-	0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x3D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3D05, 0x3D05, 0x1D05, 0x1C05,
-	0x1C05, 0xBA04, 0xDB04, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1C05, 0xFC04, 0xFC04, 0x1C05,
-	0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x3E05, 0x3D05, 0x3D05,
-	0x3D05, 0x3D05, 0xDB04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05,
-	0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x3D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0x1C05, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x3D05, 0x1D05, 0x3D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1C05, 0x1C05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3D05,
-	0x1D05, 0x1D05, 0x3D05, 0x3D05, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x1CE7, 0x5D0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0xFC04, 0x1C05, 0x1D05, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3D05, 0x1D05, 0x3D05,
-	0x1D05, 0x3D05, 0x3D05, 0x1D0D, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x3CE7, 0x3B35, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0xFC04, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04,
-	0x1C05, 0x1C05, 0x1C05, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x3D05, 0x3D05, 0x3D05, 0x1B2D, 0x3CE7, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xBEF7, 0x5DEF, 0xDA85, 0x3D0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0xFC04,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1C05, 0x1C05,
-	0x1C05, 0xFC04, 0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3D05,
-	0x3D05, 0x3D05, 0x1C05, 0xB985, 0x5DEF, 0xBEF7, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xDBD6, 0x1A35, 0x5D0D, 0x5E0D,
-	0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D, 0x5E0D,
-	0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0xFC04, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0xFC04, 0x1C05,
-	0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x3D05, 0x3D05, 0x3D05, 0x3D05,
-	0x3D05, 0x1D05, 0xFA2C, 0xDBD6, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xDFFF, 0x9EF7, 0x1CE7, 0x5ABE, 0x1A2D, 0x1C0D,
-	0x3D0D, 0x5E0D, 0x5E0D, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05, 0x5E05,
-	0x5E05, 0xFC04, 0xFC04, 0xFC04, 0xFC04, 0x1C05, 0x1C05, 0x1C05,
-	0x1C05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05, 0x1D05,
-	0x1D05, 0x1D05, 0x1D05, 0x3D05, 0x3D05, 0x1D05, 0x1D05, 0xFC04,
-	0xDB04, 0xD92C, 0x5ABE, 0x1CE7, 0x9EF7, 0xDFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0x7DEF, 0xFBDE, 0x7ACE, 0x997D,
-	0x1945, 0xFA1C, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04, 0xDB04,
-	0xDB04, 0xDB04, 0x7904, 0x7904, 0x9A04, 0x9A04, 0x9A04, 0x9A04,
-	0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04,
-	0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04, 0x9A04,
-	0x9A04, 0xBA04, 0x9A04, 0x9A04, 0xBA04, 0xBA04, 0xDA14, 0xF93C,
-	0x787D, 0x7ACE, 0xFBDE, 0x7DEF, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xBEF7, 0x7DEF, 0x1CE7, 0xBAD6,
-	0x79CE, 0x59CE, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6,
-	0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x38C6, 0x59CE, 0x79CE,
-	0xBAD6, 0x1CE7, 0x7DEF, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7, 0x9EF7, 0x5DEF,
-	0x1CE7, 0xFBDE, 0xFBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE,
-	0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xDBDE, 0xFBDE, 0xFBDE, 0x1CE7,
-	0x5DEF, 0x9EF7, 0xBEF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
-	0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xDFFF, 0xBEF7,
-	0xBEF7, 0x9EF7, 0x9EF7, 0x9EF7, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF,
-	0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x7DEF, 0x9EF7, 0x9EF7, 0xBEF7,
-	0xBEF7, 0xDFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+static const uint16_t palette[225] = {
+	0x1524, 0x1604, 0x160C, 0x1614, 0x161C, 0x1704, 0x170C, 0x175D,
+	0x1855, 0x1945, 0x1A2D, 0x1A35, 0x1A96, 0x1A9E, 0x1B1D, 0x1B25,
+	0x1B2D, 0x1C05, 0x1C0D, 0x1C15, 0x1C76, 0x1CE7, 0x1D05, 0x1D0D,
+	0x1D56, 0x1D66, 0x1DCF, 0x1DD7, 0x1E56, 0x352C, 0x361C, 0x362C,
+	0x3704, 0x370C, 0x3804, 0x385D, 0x38C6, 0x3955, 0x3A35, 0x3A9E,
+	0x3B2D, 0x3B35, 0x3B9E, 0x3C0D, 0x3C15, 0x3C86, 0x3CE7, 0x3D05,
+	0x3D0D, 0x3D15, 0x3D6E, 0x3D76, 0x3DD7, 0x3E05, 0x3E6E, 0x3EC7,
+	0x562C, 0x5804, 0x580C, 0x586D, 0x5875, 0x5904, 0x59CE, 0x5A4D,
+	0x5A55, 0x5ABE, 0x5B3D, 0x5B45, 0x5C86, 0x5C8E, 0x5D05, 0x5D0D,
+	0x5D15, 0x5D7E, 0x5DEF, 0x5E05, 0x5E0D, 0x5E15, 0x5ECF, 0x5ED7,
+	0x5EDF, 0x762C, 0x7634, 0x763C, 0x772C, 0x7734, 0x780C, 0x787D,
+	0x7904, 0x790C, 0x79CE, 0x7ACE, 0x7B3D, 0x7C3D, 0x7C9E, 0x7D1D,
+	0x7D25, 0x7D7E, 0x7D86, 0x7D96, 0x7DEF, 0x7E0D, 0x7E15, 0x7E1D,
+	0x7E7E, 0x7E86, 0x7ED7, 0x7EDF, 0x7EE7, 0x7FD7, 0x963C, 0x9644,
+	0x972C, 0x9734, 0x9744, 0x9904, 0x990C, 0x997D, 0x9A04, 0x9A0C,
+	0x9C45, 0x9C9E, 0x9CB6, 0x9D25, 0x9D2D, 0x9D9E, 0x9E15, 0x9E1D,
+	0x9E25, 0x9E2D, 0x9EE7, 0x9EEF, 0x9EF7, 0x9FDF, 0x9FE7, 0xB40B,
+	0xB50B, 0xB74C, 0xB834, 0xB83C, 0xB97D, 0xB985, 0xBA04, 0xBA0C,
+	0xBA14, 0xBAD6, 0xBB04, 0xBB0C, 0xBB5D, 0xBD35, 0xBD3D, 0xBD45,
+	0xBDA6, 0xBDAE, 0xBE25, 0xBE2D, 0xBE35, 0xBEEF, 0xBEF7, 0xBFE7,
+	0xBFEF, 0xBFF7, 0xD40B, 0xD503, 0xD50B, 0xD513, 0xD74C, 0xD844,
+	0xD92C, 0xD98D, 0xDA0C, 0xDA14, 0xDA1C, 0xDA85, 0xDB04, 0xDB0C,
+	0xDB65, 0xDBD6, 0xDBDE, 0xDC65, 0xDCBE, 0xDCC6, 0xDD45, 0xDD4D,
+	0xDD55, 0xDDA6, 0xDDAE, 0xDDB6, 0xDE2D, 0xDE4D, 0xDE9E, 0xDEA6,
+	0xDFF7, 0xDFFF, 0xF50B, 0xF513, 0xF603, 0xF60B, 0xF844, 0xF84C,
+	0xF93C, 0xFA1C, 0xFA24, 0xFA2C, 0xFA95, 0xFB04, 0xFB0C, 0xFB14,
+	0xFB1C, 0xFBDE, 0xFC04, 0xFC0C, 0xFC6D, 0xFCC6, 0xFD55, 0xFD5D,
+	0xFDB6, 0xFDBE, 0xFE45, 0xFE4D, 0xFE55, 0xFEA6, 0xFEAE, 0xFFF7,
+	0xFFFF
 };
+
+static const uint8_t data[2505] = {
+	0x83, 0xE0, 0x04, 0xC1, 0x9E, 0xB9, 0x36, 0xDA, 0x86, 0xBC, 0x9A, 0x9B, 0x93, 0x9A, 0x8C, 0x80,
+	0x83, 0x7F, 0x03, 0x9C, 0x19, 0x98, 0xA1, 0x84, 0xE0, 0x82, 0xE0, 0x03, 0xC1, 0x6C, 0x1C, 0x9A,
+	0x80, 0x7F, 0x85, 0x7E, 0x9B, 0x66, 0x92, 0x65, 0x89, 0x4C, 0x88, 0x4B, 0x04, 0x65, 0x66, 0xBD,
+	0x6B, 0xC1, 0x82, 0xE0, 0x81, 0xE0, 0x03, 0xC1, 0x84, 0x18, 0x7F, 0x88, 0x7E, 0x9B, 0x66, 0x92,
+	0x65, 0x89, 0x4C, 0x8A, 0x4B, 0x02, 0x4C, 0xB7, 0x84, 0x82, 0xE0, 0x81, 0xE0, 0x02, 0x9E, 0x79,
+	0x7F, 0x88, 0x7E, 0x9B, 0x66, 0x93, 0x65, 0x88, 0x4C, 0x8C, 0x4B, 0x02, 0x4C, 0x5E, 0x9E, 0x81,
+	0xE0, 0x80, 0xE0, 0x02, 0xC1, 0x84, 0xB7, 0x87, 0x7E, 0x9D, 0x66, 0x92, 0x65, 0x8A, 0x4C, 0x8C,
+	0x4B, 0x02, 0x96, 0x84, 0xC1, 0x80, 0xE0, 0x80, 0xE0, 0x02, 0xC1, 0x4A, 0x80, 0x86, 0x7E, 0x9D,
+	0x66, 0x93, 0x65, 0x89, 0x4C, 0x8D, 0x4B, 0x02, 0x65, 0x4A, 0xC1, 0x80, 0xE0, 0x80, 0xE0, 0x01,
+	0x9E, 0x2E, 0x85, 0x7E, 0x9F, 0x66, 0x93, 0x65, 0x89, 0x4C, 0x8E, 0x4B, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x2E, 0x82, 0x7E, 0xA1, 0x66, 0x93, 0x65, 0x89, 0x4C, 0x8F, 0x4B,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x02, 0x9E, 0x15, 0x7E, 0xA4, 0x66, 0x93, 0x65, 0x89,
+	0x4C, 0x8F, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0xA4, 0x66, 0x88,
+	0x65, 0x80, 0x4C, 0x88, 0x65, 0x89, 0x4C, 0x8F, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0,
+	0x01, 0x9E, 0x15, 0xA4, 0x66, 0x80, 0x65, 0x8E, 0x4C, 0x81, 0x65, 0x8A, 0x4C, 0x8F, 0x4B, 0x01,
+	0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0xA1, 0x66, 0x07, 0x4D, 0x66, 0x95, 0xDC,
+	0x68, 0xDD, 0x37, 0x6D, 0x80, 0x9F, 0x06, 0x6D, 0x37, 0xDE, 0x68, 0xD6, 0x9C, 0x66, 0x90, 0x4C,
+	0x90, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x9D, 0x66, 0x04, 0x67,
+	0xDB, 0x68, 0xBE, 0x4E, 0x8E, 0xE0, 0x04, 0x6D, 0xBF, 0x68, 0xB7, 0x5F, 0x8B, 0x4C, 0x90, 0x4B,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x9A, 0x66, 0x03, 0x4D, 0x7C, 0xBE,
+	0xC0, 0x96, 0xE0, 0x02, 0xDF, 0xDE, 0x7C, 0x89, 0x4C, 0x90, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0,
+	0x80, 0xE0, 0x01, 0x9E, 0x15, 0x98, 0x66, 0x02, 0x81, 0x68, 0x37, 0x9C, 0xE0, 0x02, 0x37, 0x68,
+	0x7B, 0x85, 0x4C, 0x91, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x97,
+	0x66, 0x00, 0x32, 0xA2, 0xE0, 0x01, 0x49, 0x48, 0x83, 0x4C, 0x91, 0x4B, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x94, 0x66, 0x02, 0x67, 0x49, 0x6A, 0xA4, 0xE0, 0x02, 0x6B,
+	0x61, 0x5F, 0x80, 0x4C, 0x92, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15,
+	0x93, 0x66, 0x01, 0x60, 0x4E, 0xA8, 0xE0, 0x02, 0x6A, 0x60, 0x4C, 0x92, 0x4B, 0x01, 0x2E, 0x9E,
+	0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x92, 0x66, 0x00, 0x69, 0x91, 0xE0, 0x01, 0xA1, 0x83,
+	0x82, 0x6C, 0x01, 0x83, 0xA1, 0x91, 0xE0, 0x01, 0x62, 0x47, 0x91, 0x4B, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8F, 0x66, 0x02, 0x4D, 0x7B, 0x85, 0x8D, 0xE0, 0x03, 0x9D,
+	0x34, 0x0D, 0x1D, 0x80, 0x88, 0x86, 0xA4, 0x03, 0x1F, 0x0C, 0x34, 0x9D, 0x8D, 0xE0, 0x02, 0x86,
+	0x5F, 0x35, 0x8F, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8F, 0x66,
+	0x01, 0xB7, 0x6A, 0x8B, 0xE0, 0x06, 0xB5, 0x3C, 0xA6, 0xA5, 0xA4, 0xC5, 0x21, 0x88, 0x3A, 0x01,
+	0x21, 0xC5, 0x80, 0xA4, 0x02, 0x89, 0x3B, 0xB4, 0x8B, 0xE0, 0x02, 0x4F, 0x97, 0x2F, 0x8E, 0x4B,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8D, 0x66, 0x02, 0x4D, 0xD7, 0xDF,
+	0x89, 0xE0, 0x05, 0xA1, 0x7A, 0xA2, 0xA4, 0x02, 0x21, 0x81, 0x3A, 0x00, 0x56, 0x80, 0x59, 0x00,
+	0x74, 0x81, 0x59, 0x80, 0x74, 0x81, 0x59, 0x00, 0x56, 0x80, 0x3A, 0x05, 0x21, 0x06, 0xC5, 0xA4,
+	0x7A, 0xA1, 0x89, 0xE0, 0x02, 0xC1, 0xB8, 0x2F, 0x8D, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80,
+	0xE0, 0x01, 0x9E, 0x15, 0x8C, 0x66, 0x02, 0x4D, 0x49, 0xA0, 0x88, 0xE0, 0x04, 0xC0, 0xA9, 0x53,
+	0xC2, 0x21, 0x80, 0x3A, 0x01, 0x56, 0x59, 0x81, 0x74, 0x00, 0x77, 0x88, 0x8F, 0x01, 0x77, 0x74,
+	0x81, 0x59, 0x80, 0x3A, 0x03, 0xC5, 0x55, 0xAD, 0xC0, 0x88, 0xE0, 0x02, 0xA0, 0x33, 0x2F, 0x8C,
+	0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8B, 0x66, 0x02, 0x4D, 0xB6,
+	0xA0, 0x88, 0xE0, 0x06, 0xB5, 0x87, 0xC5, 0x21, 0x3A, 0x56, 0x59, 0x80, 0x74, 0x85, 0x8F, 0x84,
+	0xAA, 0x83, 0x8F, 0x80, 0x77, 0x06, 0x74, 0x59, 0x56, 0x3A, 0x02, 0xA3, 0xB4, 0x88, 0xE0, 0x02,
+	0xA0, 0x5D, 0x35, 0x8B, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8B,
+	0x66, 0x03, 0x4D, 0x2C, 0x3F, 0x83, 0x85, 0xE0, 0x05, 0x6C, 0x07, 0xC3, 0x21, 0x3A, 0x59, 0x80,
+	0x74, 0x81, 0x8F, 0x01, 0xAA, 0x8F, 0x8F, 0xAF, 0x81, 0x8F, 0x80, 0x74, 0x04, 0x56, 0x39, 0x02,
+	0x08, 0x50, 0x85, 0xE0, 0x03, 0x83, 0x09, 0x76, 0xD2, 0x8B, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0,
+	0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8B, 0x66, 0x04, 0x4D, 0x31, 0xCF, 0x25, 0xA1, 0x83, 0xE0, 0x04,
+	0x1B, 0x00, 0x06, 0x3A, 0x56, 0x80, 0x74, 0x81, 0x8F, 0x81, 0xAA, 0x84, 0xAF, 0x00, 0xAA, 0x8C,
+	0xAF, 0x80, 0x8F, 0x05, 0x77, 0x58, 0x39, 0x20, 0x04, 0x1A, 0x83, 0xE0, 0x05, 0xA1, 0xC7, 0x58,
+	0x8E, 0xAE, 0xD2, 0x8A, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8B,
+	0x66, 0x05, 0x4D, 0x31, 0x13, 0xAB, 0xC7, 0x83, 0x81, 0xE0, 0x05, 0xCC, 0xA4, 0x21, 0x56, 0x59,
+	0x74, 0x81, 0x8F, 0x81, 0xAA, 0x00, 0xAF, 0x81, 0xAA, 0x03, 0xD0, 0x94, 0x7D, 0xBA, 0x82, 0xBB,
+	0x03, 0xBA, 0x7D, 0xB3, 0xD0, 0x87, 0xAF, 0x80, 0x8F, 0x04, 0x77, 0x58, 0x39, 0xC4, 0xCC, 0x81,
+	0xE0, 0x05, 0x83, 0xA7, 0x39, 0x76, 0x92, 0xAE, 0x80, 0xD2, 0x89, 0x4B, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8C, 0x66, 0x0A, 0x48, 0x31, 0x13, 0x90, 0x08, 0xA1, 0xC0,
+	0x8C, 0xC5, 0x3A, 0x59, 0x80, 0x74, 0x80, 0x8F, 0x81, 0xAA, 0x04, 0xAF, 0xAA, 0xD0, 0x43, 0x45,
+	0x8C, 0xE0, 0x02, 0x63, 0x5C, 0x0F, 0x85, 0xAF, 0x0B, 0x8F, 0x76, 0x73, 0x58, 0x05, 0x75, 0xC0,
+	0xA1, 0xC7, 0x22, 0x73, 0x8E, 0x80, 0xAE, 0x80, 0xD2, 0x00, 0x11, 0x88, 0x4B, 0x01, 0x2E, 0x9E,
+	0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8C, 0x66, 0x0C, 0x4D, 0x48, 0x2C, 0xD3, 0x8F, 0xA7,
+	0x23, 0x02, 0x3A, 0x59, 0x74, 0x77, 0x8F, 0x82, 0xAA, 0x03, 0x8F, 0xC9, 0xBB, 0x4F, 0x90, 0xE0,
+	0x02, 0x6B, 0xD8, 0x28, 0x84, 0xAF, 0x09, 0x92, 0x8E, 0x76, 0x58, 0x20, 0x23, 0x8B, 0x39, 0x58,
+	0x76, 0x80, 0xAE, 0x82, 0xD2, 0x00, 0x11, 0x87, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0,
+	0x01, 0x9E, 0x15, 0x8D, 0x66, 0x08, 0x4C, 0x47, 0x2B, 0x12, 0xAF, 0x3A, 0x56, 0x59, 0x74, 0x80,
+	0x8F, 0x82, 0xAA, 0x01, 0x10, 0xD4, 0x96, 0xE0, 0x01, 0x2D, 0x28, 0x81, 0xAF, 0x00, 0xCD, 0x80,
+	0xAE, 0x06, 0x8E, 0x76, 0x58, 0x39, 0x3D, 0x76, 0x8E, 0x80, 0xAE, 0x84, 0xD2, 0x00, 0x11, 0x86,
+	0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8A, 0x66, 0x82, 0x65, 0x02,
+	0x4C, 0x47, 0x30, 0x80, 0x12, 0x01, 0x8F, 0x77, 0x80, 0x8F, 0x81, 0xAA, 0x02, 0x8F, 0xB0, 0x82,
+	0x98, 0xE0, 0x05, 0x86, 0x14, 0xAF, 0xAE, 0xD2, 0xCD, 0x80, 0xAE, 0x01, 0x92, 0x8E, 0x80, 0x76,
+	0x00, 0x8E, 0x80, 0xAE, 0x86, 0xD2, 0x00, 0x16, 0x85, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80,
+	0xE0, 0x01, 0x9E, 0x15, 0x87, 0x66, 0x86, 0x65, 0x00, 0x4C, 0x82, 0x47, 0x01, 0xAF, 0x8F, 0x80,
+	0xAA, 0x02, 0x8F, 0xAC, 0x99, 0x9C, 0xE0, 0x03, 0xBB, 0xCF, 0xAE, 0xCD, 0x86, 0xAE, 0x88, 0xD2,
+	0x00, 0x16, 0x84, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x83, 0x66,
+	0x8C, 0x65, 0x81, 0x4C, 0x05, 0x65, 0xCE, 0xAA, 0x8F, 0x26, 0x4F, 0x9E, 0xE0, 0x01, 0x4F, 0x29,
+	0x80, 0xAE, 0x00, 0xD2, 0x82, 0xAE, 0x8B, 0xD2, 0x00, 0x16, 0x83, 0x4B, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x96, 0x65, 0x02, 0xAF, 0xCA, 0x4F, 0x8C, 0xE0, 0x01, 0xC0,
+	0x34, 0x80, 0xB4, 0x01, 0x34, 0xC0, 0x8C, 0xE0, 0x02, 0x4F, 0x0E, 0xAE, 0x91, 0xD2, 0x00, 0x16,
+	0x82, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x96, 0x65, 0x02, 0x4C,
+	0xCA, 0x4F, 0x89, 0xE0, 0x04, 0xC0, 0x3B, 0x6F, 0x52, 0x1E, 0x80, 0xC2, 0x04, 0x04, 0x52, 0x72,
+	0x3B, 0xC0, 0x89, 0xE0, 0x01, 0x4F, 0xD0, 0x80, 0xAE, 0x91, 0xD2, 0x00, 0x16, 0x81, 0x4B, 0x01,
+	0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x95, 0x65, 0x04, 0x4C, 0x47, 0x30, 0xC6,
+	0x82, 0x85, 0xE0, 0x04, 0xA1, 0x7A, 0x6E, 0xA4, 0x02, 0x80, 0x21, 0x82, 0x3A, 0x80, 0x21, 0x04,
+	0x06, 0xA4, 0x53, 0x7A, 0xA0, 0x85, 0xE0, 0x03, 0x82, 0xC8, 0x8E, 0xAE, 0x91, 0xD2, 0x80, 0x11,
+	0x00, 0x16, 0x80, 0x4B, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x95, 0x65,
+	0x05, 0x4C, 0x47, 0x30, 0xCE, 0x70, 0x6C, 0x83, 0xE0, 0x04, 0x8D, 0x38, 0xC5, 0x21, 0x3A, 0x81,
+	0x59, 0x83, 0x74, 0x80, 0x59, 0x04, 0x3A, 0x20, 0xC5, 0x38, 0x8D, 0x83, 0xE0, 0x04, 0x6C, 0x70,
+	0x58, 0x8E, 0xAE, 0x90, 0xD2, 0x00, 0x11, 0x80, 0xD2, 0x04, 0x11, 0x16, 0x4B, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x95, 0x65, 0x80, 0x4C, 0x04, 0x30, 0x12, 0xAA, 0xC7, 0x9D,
+	0x80, 0xE0, 0x05, 0xD5, 0x52, 0xC5, 0x21, 0x56, 0x59, 0x80, 0x74, 0x00, 0x77, 0x85, 0x8F, 0x01,
+	0x77, 0x74, 0x80, 0x58, 0x03, 0x22, 0x01, 0x51, 0xD5, 0x80, 0xE0, 0x05, 0xA0, 0xC7, 0x39, 0x76,
+	0x92, 0xAE, 0x8F, 0xD2, 0x02, 0x11, 0xD2, 0x16, 0x81, 0x11, 0x02, 0x16, 0x2E, 0x9E, 0x80, 0xE0,
+	0x80, 0xE0, 0x01, 0x9E, 0x15, 0x95, 0x65, 0x80, 0x4C, 0x0C, 0x30, 0x17, 0xD3, 0x8F, 0x71, 0x9D,
+	0x27, 0x04, 0x21, 0x56, 0x59, 0x74, 0x77, 0x80, 0x8F, 0x86, 0xAF, 0x00, 0x93, 0x80, 0x8F, 0x0A,
+	0x77, 0x74, 0x58, 0x22, 0x03, 0x2A, 0xA0, 0x71, 0x39, 0x76, 0x8E, 0x80, 0xAE, 0x8E, 0xD2, 0x82,
+	0x11, 0x82, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x95, 0x65, 0x81,
+	0x4C, 0x09, 0x30, 0x17, 0xD3, 0xAA, 0x54, 0x06, 0x3A, 0x59, 0x74, 0x77, 0x80, 0x8F, 0x8C, 0xAF,
+	0x08, 0x8E, 0x76, 0x73, 0x58, 0x05, 0x54, 0x39, 0x76, 0x8E, 0x80, 0xAE, 0x8E, 0xD2, 0x80, 0x11,
+	0x03, 0x16, 0x11, 0x16, 0x11, 0x81, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E,
+	0x15, 0x96, 0x65, 0x81, 0x4C, 0x03, 0x30, 0x17, 0x12, 0xCE, 0x80, 0x74, 0x00, 0x77, 0x80, 0x8F,
+	0x8E, 0xAF, 0x80, 0xAE, 0x00, 0x8E, 0x80, 0x76, 0x02, 0x58, 0x76, 0x8E, 0x80, 0xAE, 0x8D, 0xD2,
+	0x80, 0x11, 0x00, 0xD2, 0x82, 0x11, 0x82, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01,
+	0x9E, 0x15, 0x97, 0x65, 0x81, 0x4C, 0x82, 0x30, 0x80, 0x8F, 0x84, 0xAF, 0x02, 0x78, 0xB3, 0x14,
+	0x80, 0x7D, 0x02, 0x14, 0xB3, 0x78, 0x81, 0xAF, 0x00, 0xCD, 0x81, 0xAE, 0x00, 0x92, 0x80, 0x8E,
+	0x00, 0x92, 0x80, 0xAE, 0x8F, 0xD2, 0x81, 0x11, 0x01, 0x16, 0x11, 0x83, 0x16, 0x01, 0x2E, 0x9E,
+	0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x98, 0x65, 0x81, 0x4C, 0x81, 0x47, 0x00, 0x4C, 0x83,
+	0xAF, 0x02, 0x42, 0x6B, 0xC0, 0x84, 0xE0, 0x03, 0xC0, 0x6B, 0x5C, 0xAE, 0x80, 0xCD, 0x85, 0xAE,
+	0x8E, 0xD2, 0x01, 0x11, 0xD2, 0x81, 0x11, 0x85, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0,
+	0x01, 0x9E, 0x15, 0x99, 0x65, 0x85, 0x4C, 0x80, 0xAF, 0x02, 0xD0, 0x44, 0xC1, 0x88, 0xE0, 0x03,
+	0xC1, 0x44, 0xCF, 0xAE, 0x80, 0xD2, 0x00, 0xAE, 0x90, 0xD2, 0x01, 0x11, 0xD2, 0x81, 0x11, 0x01,
+	0x16, 0x11, 0x85, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x9B, 0x65,
+	0x84, 0x4C, 0x01, 0xCF, 0xD9, 0x8C, 0xE0, 0x02, 0xD8, 0xCE, 0xAE, 0x92, 0xD2, 0x01, 0x11, 0xD2,
+	0x80, 0x11, 0x88, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x99, 0x65,
+	0x86, 0x4C, 0x02, 0x30, 0x40, 0xA0, 0x8A, 0xE0, 0x01, 0xA0, 0x40, 0x80, 0xAE, 0x90, 0xD2, 0x06,
+	0x11, 0xD2, 0x11, 0x16, 0x11, 0x16, 0x11, 0x87, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0,
+	0x01, 0x9E, 0x15, 0x96, 0x65, 0x89, 0x4C, 0x03, 0x30, 0xCE, 0x8A, 0xA1, 0x88, 0xE0, 0x02, 0xC0,
+	0x8A, 0x58, 0x80, 0xAE, 0x8E, 0xD2, 0x04, 0x11, 0xD2, 0x11, 0xD2, 0x16, 0x80, 0x11, 0x89, 0x16,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x94, 0x65, 0x8B, 0x4C, 0x04, 0x30,
+	0x12, 0xAF, 0x08, 0xA0, 0x86, 0xE0, 0x03, 0xA0, 0x08, 0x58, 0x76, 0x80, 0xAE, 0x90, 0xD2, 0x81,
+	0x11, 0x8B, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x91, 0x65, 0x8E,
+	0x4C, 0x05, 0x30, 0x17, 0xD3, 0x77, 0x71, 0xC0, 0x84, 0xE0, 0x04, 0xC0, 0x71, 0x39, 0x76, 0x8E,
+	0x80, 0xAE, 0x8E, 0xD2, 0x83, 0x11, 0x8B, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01,
+	0x9E, 0x15, 0x8F, 0x65, 0x91, 0x4C, 0x05, 0x30, 0x12, 0xCE, 0x8F, 0xC7, 0xA0, 0x82, 0xE0, 0x06,
+	0xA0, 0xC7, 0x39, 0x58, 0x76, 0x92, 0xAE, 0x8C, 0xD2, 0x01, 0x11, 0xD2, 0x82, 0x11, 0x8D, 0x16,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x8A, 0x65, 0x96, 0x4C, 0x06, 0x47,
+	0x30, 0x12, 0xCD, 0x76, 0x71, 0xA1, 0x80, 0xE0, 0x04, 0xA1, 0x71, 0x22, 0x58, 0x76, 0x80, 0xAE,
+	0x8E, 0xD2, 0x82, 0x11, 0x8E, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15,
+	0x85, 0x65, 0x9C, 0x4C, 0x05, 0x46, 0x2F, 0x11, 0xCD, 0x8E, 0xC7, 0x80, 0xA0, 0x04, 0xC7, 0x39,
+	0x58, 0x8E, 0x92, 0x80, 0xAE, 0x8F, 0xD2, 0x01, 0x16, 0x11, 0x8F, 0x16, 0x01, 0x2E, 0x9E, 0x80,
+	0xE0, 0x80, 0xE0, 0x02, 0x9E, 0x15, 0x4C, 0x80, 0x65, 0x9F, 0x4C, 0x80, 0x4B, 0x80, 0x2F, 0x02,
+	0x11, 0xAE, 0x8E, 0x80, 0x71, 0x02, 0x39, 0x58, 0x76, 0x80, 0xAE, 0x8F, 0xD2, 0x84, 0x11, 0x8D,
+	0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0xA0, 0x4C, 0x83, 0x4B, 0x80,
+	0x2F, 0x05, 0x11, 0xD2, 0xAE, 0x58, 0x76, 0x8E, 0x80, 0xAE, 0x8E, 0xD2, 0x80, 0x11, 0x00, 0x16,
+	0x80, 0x11, 0x8F, 0x16, 0x02, 0x2F, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x9E,
+	0x4C, 0x86, 0x4B, 0x80, 0x2F, 0x00, 0x16, 0x80, 0x11, 0x00, 0x8E, 0x80, 0xAE, 0x8C, 0xD2, 0x02,
+	0x11, 0xD2, 0x11, 0x80, 0xD2, 0x80, 0x11, 0x91, 0x16, 0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0,
+	0x01, 0x9E, 0x15, 0x9C, 0x4C, 0x89, 0x4B, 0x00, 0x35, 0x82, 0x2F, 0x00, 0xAE, 0x8F, 0xD2, 0x81,
+	0x11, 0x00, 0x16, 0x80, 0x11, 0x8F, 0x16, 0x02, 0x2F, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01,
+	0x9E, 0x15, 0x9A, 0x4C, 0x91, 0x4B, 0x8C, 0xD2, 0x01, 0x11, 0xD2, 0x81, 0x11, 0x91, 0x16, 0x04,
+	0x2F, 0x16, 0x2F, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x01, 0x9E, 0x15, 0x98, 0x4C, 0x94, 0x4B,
+	0x8C, 0xD2, 0x81, 0x11, 0x00, 0x16, 0x80, 0x11, 0x8D, 0x16, 0x00, 0x2F, 0x80, 0x16, 0x80, 0x2F,
+	0x01, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x02, 0x9E, 0x15, 0x47, 0x93, 0x4C, 0x99, 0x4B, 0x8A,
+	0xD2, 0x01, 0x11, 0x16, 0x81, 0x11, 0x8D, 0x16, 0x03, 0x2F, 0x16, 0x2F, 0x16, 0x80, 0x2F, 0x02,
+	0x17, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x02, 0x9E, 0x2E, 0x29, 0x91, 0x4C, 0x9C, 0x4B, 0x88,
+	0xD2, 0x82, 0x11, 0x92, 0x16, 0x81, 0x2F, 0x02, 0x10, 0x2E, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x03,
+	0x9E, 0x4A, 0xAD, 0x30, 0x8B, 0x4C, 0xA2, 0x4B, 0x83, 0xD2, 0x01, 0x11, 0xD2, 0x81, 0x11, 0x01,
+	0xD2, 0x11, 0x92, 0x16, 0x81, 0x2F, 0x03, 0x11, 0x8D, 0x4A, 0x9E, 0x80, 0xE0, 0x80, 0xE0, 0x04,
+	0xC1, 0x64, 0xB1, 0x0B, 0x47, 0x88, 0x4C, 0xA5, 0x4B, 0x83, 0xD2, 0x01, 0x11, 0xD2, 0x80, 0x11,
+	0x91, 0x16, 0x83, 0x2F, 0x04, 0x16, 0xCB, 0xB1, 0x64, 0xC1, 0x80, 0xE0, 0x80, 0xE0, 0x06, 0xC1,
+	0x84, 0x15, 0x41, 0x0A, 0x12, 0x30, 0x80, 0x4C, 0xAC, 0x4B, 0x82, 0xD2, 0x82, 0x11, 0x90, 0x16,
+	0x80, 0x2F, 0x80, 0x16, 0x06, 0xD2, 0xAE, 0xA8, 0x41, 0x15, 0x84, 0xC1, 0x80, 0xE0, 0x81, 0xE0,
+	0x06, 0xC1, 0x64, 0xD1, 0x5B, 0x75, 0x09, 0xC9, 0xAE, 0xAE, 0x80, 0x58, 0x93, 0x76, 0x00, 0x8E,
+	0x80, 0x76, 0x80, 0x8E, 0x06, 0xAB, 0xC8, 0x57, 0x5B, 0xD1, 0x64, 0xC1, 0x81, 0xE0, 0x82, 0xE0,
+	0x05, 0x9E, 0x64, 0x15, 0x91, 0x5A, 0x3E, 0xCA, 0x24, 0x05, 0x3E, 0x5A, 0x91, 0x15, 0x64, 0x9E,
+	0x82, 0xE0, 0x82, 0xE0, 0x04, 0xC1, 0x9E, 0x84, 0x4A, 0x15, 0x80, 0xD1, 0xC8, 0xB2, 0x80, 0xD1,
+	0x03, 0x15, 0x4A, 0x84, 0x9E, 0x83, 0xE0, 0x84, 0xE0, 0x00, 0xC1, 0x80, 0x9E, 0x81, 0x84, 0xC7,
+	0x64, 0x80, 0x84, 0x80, 0x9E, 0x00, 0xC1, 0x84, 0xE0
+};
+
+const CompressedIcon wlanIcon = {96, 67, 225, palette, data};
@@ -1,57 +1,99 @@
 #include <Arduino.h>
+#include <type_traits>
 
 #include <FS.h>
 #include <LittleFS.h>
 
-// Load the TFT definitions before including the library main header
-#include <User_Setups/Setup25_TTGO_T_Display.h>
-#define USER_SETUP_LOADED 1
-#include <TFT_eSPI.h>
+#include "Display.h"
 
 #include <Wire.h>
 #include <MAX44009.h>
 
 #include <WiFi.h>
+#include <esp_wifi.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_heap_caps.h>
+#include <esp_sntp.h>
+#include <sys/time.h>
 #include <ESPmDNS.h>
 #include <DNSServer.h>
 #include <ArduinoOTA.h>
-#include <SoftwareSerial.h>
-#include <Adafruit_PM25AQI.h>
 
 #include <MHZ19.h>
 
 #include <ESP_WiFiManager.h>
 
-#include <PubSubClient.h>
-
-#include <Ticker.h>
+#include <AsyncMqttClient.h>
 
 #include "PMS5003.h"
+#include "UartTransport.h"
 
 #include <ArduinoJson.h>
 
 #include "assets/icons.h"
-#include "ValueHistory.h"
-
-#define VALUE_FONT &Orbitron_Light_24
+#include "IconDecoder.h"
+#include "TieredHistory.h"
+#include "ParticleChart.h"
+#include "FrameCompositor.h"
+#include "HistoryLog.h"
+#include "SampleOutbox.h"
+#include "SampleQueue.h"
+#include "Sample.h"
+#include "LineProtocol.h"
+#include "Scheduler.h"
+#include "Button.h"
+#include "SleepPlanner.h"
+#include "RtcState.h"
+#include "TopicTable.h"
+#include "MqttLink.h"
+#include "Backoff.h"
+#include "InFlightWindow.h"
+#include "TimeSync.h"
+#include "Deadband.h"
+#include "SampleCodec.h"
+#include "InfluxHttpWriter.h"
+#include "HistoryServer.h"
+#include "Dashboard.h"
 
 ESP_WiFiManager wifiManager;
-WiFiClient client;
 char mqtt_server[40] = "192.168.178.150";
 char room[40] = "";
-
-PubSubClient mqtt(client);
-
+// "influx" or "cbor", how the samples go to the broker
+char payload_format[8] = "influx";
+// with a url the samples are posted straight to InfluxDB instead of the persistent topic
+char influx_url[96] = "";
+// rendered whenever room changes, publishing only formats the values on the stack
+TopicTable topics;
+
+// the live values are only published when they changed beyond both bands or as a heartbeat,
+// indexed by TopicTable::Topic, CO2 in ppm and particles in ug/m3
+#ifndef LIVE_MAX_SILENCE
+#define LIVE_MAX_SILENCE (15 * 60 * 1000)
+#endif
+Deadband liveDeadbands[TopicTable::topicCount] = {
+    Deadband({25, 30, LIVE_MAX_SILENCE}),
+    Deadband({3, 100, LIVE_MAX_SILENCE}),
+    Deadband({3, 100, LIVE_MAX_SILENCE}),
+    Deadband({3, 100, LIVE_MAX_SILENCE}),
+};
+
+// the connection is kept up in the background, nothing waits for a handshake
+AsyncMqttClient mqtt;
+MqttLink mqttLink(mqtt);
+
+// short press on either button cycles the page, a long press restarts or resets the portal
 const static uint8_t resetButton = 0;   //GPIO 0
 const static uint8_t portalButton = 35; //GPIO 35
+DebouncedButton resetButtonState;
+DebouncedButton portalButtonState;
 
-const static uint16_t pmWarnThreshold = 10;
-const static uint16_t pmDangerThreshold = 25;
-
-SoftwareSerial pmsSerial(15, 17);
+// both sensors sit on hardware UARTs, the pins are routed through the GPIO matrix
+UartTransport pmsSerial(Serial1, 15, 17);
 PMS5003 pms = PMS5003();
 
-SoftwareSerial co2Serial(13, 12);
+UartTransport co2Serial(Serial2, 13, 12);
+TransportStream co2Stream(co2Serial);
 MHZ19 co2;
 MAX44009 brightness;
 
@@ -60,28 +102,265 @@ TFT_eSPI display = TFT_eSPI();
 //flag for saving data
 bool shouldSaveConfig = false;
 
+// sensing and rendering share the app core, WiFi and MQTT run on the protocol core
+const static uint32_t samplePeriod = 60 * 1000;
+const static uint8_t sampleQueueLength = 10;
+
+// lets the chip light sleep and the radio modem sleep whenever all tasks are blocked,
+// automatic light sleep needs a core built with CONFIG_PM_ENABLE
+#ifndef POWER_SAVING
+#define POWER_SAVING 0
+#endif
+// with oversampling the PMS5003 streams and every frame of a sample period is averaged,
+// otherwise a single frame is requested per sample.
+// The UARTs don't receive in light sleep, so power saving reads the PMS on request
+#ifndef PMS_OVERSAMPLING
+#define PMS_OVERSAMPLING !POWER_SAVING
+#endif
+// a frame is 32 bytes at 9600 baud and comes every second, well within the serial buffer
+const static uint32_t pmsPollPeriod = 250;
+// the first sample is completed as soon as a few PMS frames are in,
+// the slow sensors are read just before a sample is completed
+const static uint32_t firstSampleDelay = 5000;
+const static uint32_t sensorLead = 1000;
+// espota repeats its invitation for seconds and the upload itself runs inside handle(),
+// so a slow poll only delays the start and leaves the chip long sleep windows
+const static uint32_t otaPeriod = 1000;
+const static uint32_t statsPeriod = 10 * 60 * 1000;
+
+// all periodic work on the app core runs as jobs, the task sleeps in between
+Scheduler scheduler([]() -> uint32_t { return millis(); });
+// filled in by the sensor jobs until the sample job sends it off
+Sample pendingSample;
+// woken by the button interrupts
+TaskHandle_t schedulerTaskHandle;
+
+// awake versus blocked time of the scheduler and the network task
+SleepPlanner schedulerPlanner;
+SleepPlanner networkPlanner;
+// the battery build deep sleeps between samples and keeps its state in RTC memory
+#ifndef BATTERY_MODE
+#define BATTERY_MODE 0
+#endif
+#if BATTERY_MODE
+// the PMS fan needs about 30 s after waking up before the readings are stable
+const static uint32_t pmsWarmUp = 30 * 1000;
+const static uint32_t fastConnectTimeout = 8 * 1000;
+// the wake ups stamp their samples from the SNTP mapping of the full boot, it is refreshed
+// about once an hour so the rate of the sleep clock can be estimated
+const static uint32_t timeSyncTimeout = 10 * 1000;
+const static uint32_t timeSyncWakeups = 60;
+RTC_DATA_ATTR RtcState rtcState;
+#endif
+
+#if CONFIG_PM_ENABLE
+// held while jobs run, the sensors answer over UART which doesn't work in light sleep
+esp_pm_lock_handle_t jobsAwakeLock = nullptr;
+#endif
+
+enum class DisplayPage : uint8_t
+{
+  particles,
+  climate,
+};
+// both only change while the display mutex is held
+DisplayPage displayPage = DisplayPage::particles;
+Sample displayedSample = {};
+const static BaseType_t sensorCore = 1;
+const static BaseType_t networkCore = 0;
+
+// all influx lines go out as one payload on the persistent topic, optionally several samples at once
+#ifndef PUBLISH_BATCH_SAMPLES
+#define PUBLISH_BATCH_SAMPLES 1
+#endif
+const static char *persistentTopic = "atmonode";
+const static uint8_t samplesPerPublish = PUBLISH_BATCH_SAMPLES;
+// 13 lines per sample with a room name of up to 39 escaped characters
+const static size_t sampleLinesSize = 13 * 140;
+char influxBuffer[samplesPerPublish * sampleLinesSize + 1];
+LineProtocolWriter influxBatch(influxBuffer, sizeof(influxBuffer));
+
+// nodes set to cbor send the same batches as compact binary records on their own topic
+enum class PayloadFormat : uint8_t
+{
+  influx,
+  cbor,
+};
+PayloadFormat payloadFormat = PayloadFormat::influx;
+const static char *binaryTopic = "atmonode/cbor";
+uint8_t cborBuffer[samplesPerPublish * SampleEncoder::maxRecordSize + 64];
+SampleEncoder cborBatch(cborBuffer, sizeof(cborBuffer));
+
+// a batch is posted once samplesPerPublish samples are waiting or the oldest one is INFLUX_MAX_AGE old,
+// while the server is unreachable the samples pile up in the outbox
+#ifndef INFLUX_MAX_AGE
+#define INFLUX_MAX_AGE (5 * 60 * 1000)
+#endif
+const static uint32_t influxMaxAge = INFLUX_MAX_AGE;
+uint8_t gzipBuffer[sizeof(influxBuffer)];
+InfluxHttpWriter influxHttp(gzipBuffer, sizeof(gzipBuffer));
+
+// samples wait here until the broker acknowledged them
+SampleOutbox outbox;
+const static uint32_t drainInterval = 250;
+
+// influx batches go out with QoS 1, up to MQTT_INFLIGHT_WINDOW of them before the first ack
+#ifndef MQTT_INFLIGHT_WINDOW
+#define MQTT_INFLIGHT_WINDOW 4
+#endif
+InFlightWindow inFlight(MQTT_INFLIGHT_WINDOW);
+// packet ids of the PUBACKs, handed over from the AsyncTCP task
+QueueHandle_t ackQueue;
+// how often the network task looks after the connection when nothing else wakes it,
+// with power saving the keepalive is stretched so the samples keep the connection alive
+#if POWER_SAVING
+const static uint32_t networkServiceInterval = 5 * 1000;
+const static uint16_t mqttKeepAlive = 2 * samplePeriod / 1000;
+#else
+const static uint32_t networkServiceInterval = 100;
+const static uint16_t mqttKeepAlive = 15;
+#endif
+Backoff wifiBackoff(5 * 1000, 2 * 60 * 1000);
+
+// samples are stamped from the monotonic clock, SNTP updates map it onto unix time,
+// the mapping is updated from the lwIP task and read by the sensor and network tasks
+TimeSync timeSync;
+portMUX_TYPE timeSyncMux = portMUX_INITIALIZER_UNLOCKED;
+const static uint32_t timeSyncInterval = 15 * 60 * 1000;
+// samples of an earlier boot can't be mapped, their monotonic time started over
+uint32_t bootId;
+// unix minus monotonic time at the first SNTP update of this boot; samples taken before it
+// get their timestamp from this fixed offset, so a batch built again comes out identical
+uint64_t bootEpochMicros = 0;
+// samples of an earlier boot that never got a timestamp, they were dropped instead of sent
+uint32_t unstampableSamples = 0;
+// added to the esp_timer reading, the battery build keeps counting across deep sleep
+uint64_t clockBase = 0;
+
+SampleQueue displayQueue(sampleQueueLength);
+SampleQueue publishQueue(sampleQueueLength);
+SemaphoreHandle_t displayMutex;
+
+void schedulerTask(void *parameter);
+void displayTask(void *parameter);
+void networkTask(void *parameter);
+void pollPms();
+void readCo2();
+void readBrightness();
+void completeSample();
+void printSchedulerStats();
+void setupPowerSaving();
+void holdAwake(bool hold);
+TickType_t sleepTicks(uint32_t window);
+void startBatteryMode();
+void batteryWake();
+void sleepFor(uint32_t duration);
+bool connectFast();
+bool publishPending();
+bool waitForTimeSync(uint32_t syncs, uint32_t timeout);
+void stampSample(Sample &sample);
+uint64_t monotonicMicros();
+bool resolveTimestamp(Sample &sample);
+void discardUnstampable();
+uint64_t unixMillisAt(uint64_t monotonicMicros);
+void onTimeSync(struct timeval *time);
+bool ensureConnected();
+void publishLiveValues(const Sample &sample);
+void publishLiveValue(TopicTable::Topic topic, int32_t value, uint32_t now);
+bool publishValue(TopicTable::Topic topic, int32_t value);
+void renderTopics();
+void printHeapStats();
+void drainOutbox();
+void applyPayloadFormat();
+uint8_t buildBatch(uint16_t first, uint16_t count);
+uint8_t buildInfluxBatch(uint16_t first, uint16_t count);
+uint8_t buildCborBatch(uint16_t first, uint16_t count);
+uint16_t publishBatch(bool dup, uint16_t packetId);
+void drainOutboxHttp();
+void resendInFlight();
+void restoreHistory();
+void replayHistoryRecord(const HistoryRecord &record);
+void addToHistory(const Sample &sample);
+HistoryRecord toHistoryRecord(const Sample &sample);
+void flushHistory();
 void setupOTA();
-void delayWhileCheckingButtons(uint32_t time);
 void saveConfigCallback();
-void checkButtons();
+void onButtonEdge();
+uint32_t serviceButtons();
+void handleGesture(uint8_t button, ButtonGesture gesture);
+void cyclePage();
 void loadWLANConfig();
 void saveWLANConfig();
 void setupWLAN();
 void displayPrintCenterln(const char *text, uint8_t y);
-void createInfluxMessage(char *dst, uint8_t len, const char *topic, float value);
-void createParticleMessage(char *dst, uint8_t len, const char *topic, uint16_t value, float size);
-void displayMessage(uint16_t duration, const uint16_t *icon, const char *message1, const char *message2 = "");
+void appendInfluxLines(LineProtocolWriter &line, const Sample &sample);
+void createInfluxMessage(LineProtocolWriter &line, const char *topic, int32_t value, uint64_t timestamp);
+void createParticleMessage(LineProtocolWriter &line, const char *topic, uint16_t value, const char *size, uint64_t timestamp);
+void displayMessage(uint16_t duration, const CompressedIcon &icon, const char *message1, const char *message2 = "");
+void displayCurrentPage();
 void displayParticleCount();
+void displayClimate();
 void displayConnectInfo(String ssid, String passphrase, uint16_t duration = 5000);
 
-ValueHistory<uint16_t> pm010History;
-ValueHistory<uint16_t> pm025History;
-ValueHistory<uint16_t> pm100History;
-ValueHistory<uint16_t> co2History;
-ValueHistory<float> brightnessHistory;
+// minute, hour, day and week tiers, about 2.3kB each
+ParticleHistory pm010History;
+ParticleHistory pm025History;
+ParticleHistory pm100History;
+TieredHistory<uint16_t> co2History;
+TieredHistory<float> brightnessHistory;
+
+ParticleChart particleChart(display, pm010History, pm025History, pm100History);
+FrameCompositor compositor(display);
+
+// the histories are snapshotted byte by byte
+static_assert(std::is_trivially_copyable<ParticleHistory>::value, "history must be trivially copyable");
+static_assert(std::is_trivially_copyable<TieredHistory<float>>::value, "history must be trivially copyable");
+HistoryRegion historyRegions[] = {
+    {&pm010History, sizeof(pm010History)},
+    {&pm025History, sizeof(pm025History)},
+    {&pm100History, sizeof(pm100History)},
+    {&co2History, sizeof(co2History)},
+    {&brightnessHistory, sizeof(brightnessHistory)},
+};
+HistoryLog historyLog(LITTLEFS, historyRegions, sizeof(historyRegions) / sizeof(historyRegions[0]));
+bool historyPersisted = false;
+// guards the histories and their log against the tasks that flush before a restart
+SemaphoreHandle_t historyMutex;
+
+// the history API reads every metric through the same interface
+HistorySourceOf<ParticleHistory> pm010Source(pm010History);
+HistorySourceOf<ParticleHistory> pm025Source(pm025History);
+HistorySourceOf<ParticleHistory> pm100Source(pm100History);
+HistorySourceOf<TieredHistory<uint16_t>> co2Source(co2History);
+HistorySourceOf<TieredHistory<float>> brightnessSource(brightnessHistory);
+const HistoryServer::Metric historyMetrics[] = {
+    {"pm10", &pm010Source},
+    {"pm25", &pm025Source},
+    {"pm100", &pm100Source},
+    {"co2", &co2Source},
+    {"lux", &brightnessSource},
+};
+HistoryServer historyServer(historyMetrics, sizeof(historyMetrics) / sizeof(historyMetrics[0]),
+                            []() -> uint32_t { return unixMillisAt(monotonicMicros()) / 1000; });
+Dashboard dashboard(LITTLEFS);
 
 void setup()
 {
+  bootId = esp_random();
+#if BATTERY_MODE
+  // timer wake ups take the fast path and go back to sleep without returning
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER && rtcState.valid())
+  {
+    batteryWake();
+  }
+#endif
+
+  displayMutex = xSemaphoreCreateMutex();
+  historyMutex = xSemaphoreCreateMutex();
+  displayQueue.begin();
+  publishQueue.begin();
+  ackQueue = xQueueCreate(2 * InFlightWindow::maxSize, sizeof(uint16_t));
+
   pinMode(resetButton, INPUT);
   pinMode(portalButton, INPUT);
 
@@ -94,10 +373,23 @@ void setup()
   display.init();
   display.setRotation(1);
 
+#ifdef SPRITE_RENDERING
+  if (compositor.begin())
+  {
+    particleChart.setCanvas(compositor.canvas(), compositor.frameSprite());
+  }
+  else
+  {
+    Serial.println("no memory for the frame buffer, drawing directly");
+  }
+#endif
+
   display.setTextColor(TFT_BLACK, TFT_WHITE);
   display.fillScreen(TFT_WHITE);
   delay(500);
 
+  restoreHistory();
+
 #ifndef OFFLINE_MODE
   loadWLANConfig();
   setupWLAN();
@@ -109,10 +401,29 @@ void setup()
   }
 
   setupOTA();
+  historyServer.begin(historyMutex);
+  dashboard.begin(historyServer.webServer());
 
   mqtt.setServer(mqtt_server, 1883);
+  mqtt.setClientId(topics.clientId());
+  mqtt.setKeepAlive(mqttKeepAlive);
+  // the broker keeps the session of the room, unacknowledged batches are sent again
+  mqtt.setCleanSession(false);
+  mqtt.onPublish([](uint16_t packetId) { xQueueSend(ackQueue, &packetId, 0); });
+  mqttLink.begin();
+  influxHttp.begin(influx_url);
+
+  // lines are stamped at acquisition so batched samples keep their time
+  sntp_set_time_sync_notification_cb(onTimeSync);
+  sntp_set_sync_interval(timeSyncInterval);
+  configTime(0, 0, "pool.ntp.org");
+#endif
+
+#if POWER_SAVING
+  setupPowerSaving();
 #endif
 
+  pmsSerial.begin(9600);
   if (!(pms.begin(&pmsSerial) == PMS5003::readSuccess))
   {
     displayMessage(5000, warningIcon, "PMS Sensor Error", "restarting");
@@ -135,45 +446,195 @@ void setup()
   }
 
   co2Serial.begin(9600);
-  co2.begin(co2Serial);
+  co2.begin(co2Stream);
   Serial.print("CO2 Sensor initialized");
   co2.autoCalibration(false);
   Serial.print("ABC Status: ");
   co2.getABC() ? Serial.println("ON") : Serial.println("OFF");
 
-  pms.setMode(PmsMode::passive);
-  pms.reset();
+  pms.setMode(PMS_OVERSAMPLING ? PmsMode::active : PmsMode::passive);
+
+#if BATTERY_MODE
+  startBatteryMode();
+#endif
+
+#if PMS_OVERSAMPLING
+  scheduler.addJob("pms", pmsPollPeriod, pmsPollPeriod, pollPms);
+#endif
+  scheduler.addJob("co2", samplePeriod, sensorLead, readCo2, firstSampleDelay - sensorLead);
+  scheduler.addJob("lux", samplePeriod, sensorLead, readBrightness, firstSampleDelay - sensorLead);
+  scheduler.addJob("sample", samplePeriod, 2000, completeSample, firstSampleDelay);
+#ifndef OFFLINE_MODE
+  scheduler.addJob("ota", otaPeriod, otaPeriod, []()
+                   {
+                     // nobody can reach the listener without a connection
+                     if (WiFi.isConnected())
+                     {
+                       ArduinoOTA.handle();
+                     }
+                   });
+#endif
+  scheduler.addJob("stats", statsPeriod, 100, printSchedulerStats, statsPeriod);
+
+  // OTA and the restart buttons flush the history from here, give it room for LittleFS
+  xTaskCreatePinnedToCore(schedulerTask, "scheduler", 8192, NULL, 3, &schedulerTaskHandle, sensorCore);
+  attachInterrupt(resetButton, onButtonEdge, CHANGE);
+  attachInterrupt(portalButton, onButtonEdge, CHANGE);
+  xTaskCreatePinnedToCore(displayTask, "display", 8192, NULL, 1, NULL, sensorCore);
+#ifndef OFFLINE_MODE
+  xTaskCreatePinnedToCore(networkTask, "network", 8192, NULL, 2, NULL, networkCore);
+#endif
 }
 
 void loop()
 {
-  uint16_t loopStart = millis();
+  // everything runs in the scheduler and the tasks, the Arduino loop task isn't needed
+  vTaskDelete(NULL);
+}
 
-#ifndef OFFLINE_MODE
-  if (WiFi.status() != WL_CONNECTED)
+void schedulerTask(void *parameter)
+{
+  for (;;)
   {
-    displayMessage(5000, connectedIcon, "disconnected", "resetting");
-    ESP.restart();
+    holdAwake(true);
+    uint32_t wait = scheduler.runDue();
+    uint32_t buttonWait = serviceButtons();
+    holdAwake(false);
+
+    // blocks until the next job is due or a button changes, the idle task gets the CPU in between
+    schedulerPlanner.plan(millis());
+    schedulerPlanner.wakeIn(wait);
+    schedulerPlanner.wakeIn(buttonWait);
+    ulTaskNotifyTake(pdTRUE, sleepTicks(schedulerPlanner.window()));
+    schedulerPlanner.woke(millis());
+  }
+}
+
+void displayTask(void *parameter)
+{
+  Sample sample;
+  for (;;)
+  {
+    if (!displayQueue.pop(sample, portMAX_DELAY))
+    {
+      continue;
+    }
+
+    addToHistory(sample);
+
+    xSemaphoreTake(displayMutex, portMAX_DELAY);
+    displayedSample = sample;
+    displayCurrentPage();
+    xSemaphoreGive(displayMutex);
   }
+}
 
-  if (!mqtt.connected())
+void networkTask(void *parameter)
+{
+  Sample sample;
+  for (;;)
   {
-    String clientId = String("AtmoNode-") + room;
-    if (!mqtt.connect(clientId.c_str()))
+    // a new sample wakes the task, otherwise it only looks after the connection and the backlog
+    networkPlanner.plan(millis());
+    networkPlanner.wakeIn(networkServiceInterval);
+    if (outbox.size() > samplesPerPublish || inFlight.size() > 0)
     {
-      displayMessage(5000, connectedIcon, "MQTT failed", "retrying");
-      return;
+      networkPlanner.wakeIn(drainInterval);
     }
+    bool received = publishQueue.pop(sample, sleepTicks(networkPlanner.window()));
+    networkPlanner.woke(millis());
+
+    // samples are collected no matter if we are online or not
+    if (received)
+    {
+      // the browsers only need WiFi, they are fed before anything can wait on the broker
+      dashboard.publish(sample);
+      if (ensureConnected())
+      {
+        publishLiveValues(sample);
+      }
+      outbox.push(sample);
+    }
+
+    if (influxHttp.enabled())
+    {
+      // MQTT only carries the live values, the database is written directly
+      ensureConnected();
+      if (WiFi.status() == WL_CONNECTED)
+      {
+        drainOutboxHttp();
+      }
+      continue;
+    }
+    if (!ensureConnected())
+    {
+      continue;
+    }
+    drainOutbox();
+  }
+}
+
+// kicks off reconnects without ever giving up on the samples
+bool ensureConnected()
+{
+  static uint32_t nextWifiAttempt = 0;
+
+  if (WiFi.status() != WL_CONNECTED)
+  {
+    if ((int32_t)(millis() - nextWifiAttempt) >= 0)
+    {
+      Serial.println("WiFi disconnected, reconnecting");
+      WiFi.reconnect();
+      nextWifiAttempt = millis() + wifiBackoff.next(esp_random());
+    }
+    return false;
   }
+  wifiBackoff.reset();
+
+  return mqttLink.service(millis());
+}
+
+#if PMS_OVERSAMPLING
+void pollPms()
+{
+  pms.poll();
+}
 #endif
 
+void readCo2()
+{
+  pendingSample.co2 = co2.getCO2();
+  pendingSample.co2Temp = co2.getTemperature();
+  Serial.println(F("---------------------------------------"));
+  Serial.println(F("CO2 (PPM):"));
+  Serial.println(F("---------------------------------------"));
+  Serial.println(pendingSample.co2);
+  Serial.print(F("Sensor Temperature:"));
+  Serial.println(pendingSample.co2Temp);
+  Serial.println(F("---------------------------------------"));
+}
+
+void readBrightness()
+{
+  pendingSample.lux = brightness.get_lux();
+  Serial.print("Light (lux): ");
+  Serial.println(pendingSample.lux);
+}
+
+// the PMS reading closes the sample, the other sensors were read just before
+void completeSample()
+{
   Serial.print("Sensing for room ");
   Serial.println(room);
 
-  PMSResult pmsData;
+  PMSResult &pmsData = pendingSample.pms;
+#if PMS_OVERSAMPLING
+  uint16_t frames = pms.takeAverage(pmsData);
+  Serial.printf("averaged %u PMS frames, %u checksum errors so far\n", frames, pms.stats().checksumErrors);
+#else
   uint8_t err = pms.getReading(&pmsData);
-
   Serial.println("AQI Reding result = " + String(err));
+#endif
   Serial.println();
   Serial.println(F("---------------------------------------"));
   Serial.println(F("Concentration Units (standard)"));
@@ -207,91 +668,770 @@ void loop()
   Serial.println(pmsData.particles_100um);
   Serial.println(F("---------------------------------------"));
 
-  int currentCo2 = co2.getCO2();
-  int co2Temp = co2.getTemperature();
-  Serial.println(F("---------------------------------------"));
-  Serial.println(F("CO2 (PPM):"));
-  Serial.println(F("---------------------------------------"));
-  Serial.println(currentCo2);
-  Serial.print(F("Sensor Temperature:"));
-  Serial.println(co2Temp);
-  Serial.println(F("---------------------------------------"));
+  stampSample(pendingSample);
 
-  float currentLux = brightness.get_lux();
-  Serial.print("Light (lux): ");
-  Serial.println(currentLux);
+  Serial.printf("serial CPU time: PMS %u us for %u bytes, CO2 %u us for %u bytes\n",
+                pmsSerial.stats().busyMicros, pmsSerial.stats().bytesRead,
+                co2Serial.stats().busyMicros, co2Serial.stats().bytesRead);
+
+  displayQueue.push(pendingSample);
+#ifndef OFFLINE_MODE
+  publishQueue.push(pendingSample);
+#endif
+}
+
+void printSchedulerStats()
+{
+  for (uint8_t job = 0; job < scheduler.jobCount(); job++)
+  {
+    const Scheduler::JobStats &stats = scheduler.jobStats(job);
+    Serial.printf("job %s: %u runs, %u overruns, %u skipped, max latency %u ms, max runtime %u ms\n",
+                  scheduler.jobName(job), stats.runs, stats.overruns, stats.skipped,
+                  stats.maxLatency, stats.maxRuntime);
+  }
+
+  const SleepPlanner *planners[] = {&schedulerPlanner, &networkPlanner};
+  const char *names[] = {"scheduler", "network"};
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    const SleepPlanner::Stats &stats = planners[i]->stats();
+    Serial.printf("%s task: awake %llu ms, blocked %llu ms (%u per mille) in %u windows, %u woken early\n",
+                  names[i], stats.awakeMillis, stats.idleMillis, planners[i]->idleShare(),
+                  stats.windows, stats.earlyWakeups);
+  }
+  Serial.printf("sample queues: %u dropped for the display, %u for the network\n",
+                displayQueue.dropped(), publishQueue.dropped());
+  printHeapStats();
+
+  const MqttLink::Stats &link = mqttLink.stats();
+  Serial.printf("mqtt: %u connects, %u disconnects, %u failed attempts, last backoff %u ms\n",
+                link.connects, link.disconnects, link.failedAttempts, link.lastBackoff);
+
+  if (influxHttp.enabled())
+  {
+    const InfluxHttpWriter::Stats &http = influxHttp.stats();
+    Serial.printf("influx http: %u posts, %u failed, %u rejected, %llu bytes sent for %llu bytes of lines, last status %d\n",
+                  http.posts, http.failures, http.rejected, http.sentBytes, http.rawBytes, http.lastStatus);
+  }
+
+  const Dashboard::Stats &web = dashboard.stats();
+  LiveFeed::Stats feed = dashboard.feedStats();
+  Serial.printf("dashboard: %u clients, %u events for %u samples, %u skipped, %u refused, %u files sent, %u not modified\n",
+                dashboard.clients(), feed.events, feed.samples, feed.skipped, web.refusedClients, web.files, web.notModified);
+
+  const HistoryServer::Stats &history = historyServer.stats();
+  Serial.printf("history api: %u requests, %u rejected, %u rows in %llu bytes\n",
+                history.requests, history.rejected, history.rows, history.bytes);
+
+  for (uint8_t topic = 0; topic < TopicTable::topicCount; topic++)
+  {
+    const Deadband::Stats &live = liveDeadbands[topic].stats();
+    Serial.printf("%s: %u sent, %u suppressed by the deadband\n",
+                  topics.topic((TopicTable::Topic)topic), live.sent, live.suppressed);
+  }
+
+  portENTER_CRITICAL(&timeSyncMux);
+  TimeSync::Stats time = timeSync.stats();
+  portEXIT_CRITICAL(&timeSyncMux);
+  Serial.printf("time: %u SNTP updates, %u steps, last error %lld us, drift %d ppb, %u unstamped samples dropped\n",
+                time.syncs, time.steps, time.lastErrorMicros, time.driftPpb, unstampableSamples);
+
+#if CONFIG_PM_PROFILING
+  // time actually spent in light sleep and at each CPU frequency
+  esp_pm_dump_locks(stdout);
+#endif
+}
+
+// a largest free block far below the free heap means the heap is fragmented
+void printHeapStats()
+{
+  size_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  size_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  uint32_t fragmentation = freeHeap > 0 ? 1000 - (uint64_t)largestBlock * 1000 / freeHeap : 0;
+  Serial.printf("heap: %u bytes free, largest block %u bytes, fragmentation %u per mille, lowest free %u bytes\n",
+                freeHeap, largestBlock, fragmentation, heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+}
+
+void setupPowerSaving()
+{
+#ifndef OFFLINE_MODE
+  // the radio only wakes up for beacons, the association and the MQTT connection stay up
+  WiFi.setSleep(true);
+  esp_wifi_set_ps(WIFI_PS_MAX_MODEM);
+#endif
+#if CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t config = {};
+  config.max_freq_mhz = 240;
+  config.min_freq_mhz = 80;
+  config.light_sleep_enable = true;
+  if (esp_pm_configure(&config) != ESP_OK)
+  {
+    Serial.println("automatic light sleep not available");
+  }
+  esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "jobs", &jobsAwakeLock);
+#else
+  Serial.println("built without CONFIG_PM_ENABLE, only the modem sleeps");
+#endif
+}
+
+void holdAwake(bool hold)
+{
+#if CONFIG_PM_ENABLE
+  if (!jobsAwakeLock)
+  {
+    return;
+  }
+  if (hold)
+  {
+    esp_pm_lock_acquire(jobsAwakeLock);
+  }
+  else
+  {
+    esp_pm_lock_release(jobsAwakeLock);
+  }
+#endif
+}
+
+TickType_t sleepTicks(uint32_t window)
+{
+  return window == SleepPlanner::never ? portMAX_DELAY : pdMS_TO_TICKS(window);
+}
+
+#if BATTERY_MODE
+// end of a full boot: keep what the fast path needs and go to sleep
+void startBatteryMode()
+{
+  // samples and history survive a reset as long as the layout didn't change
+  if (!rtcState.valid())
+  {
+    rtcState.reset();
+  }
+  strlcpy(rtcState.room, room, sizeof(rtcState.room));
+  strlcpy(rtcState.mqttServer, mqtt_server, sizeof(rtcState.mqttServer));
+  strlcpy(rtcState.ssid, WiFi.SSID().c_str(), sizeof(rtcState.ssid));
+  strlcpy(rtcState.passphrase, WiFi.psk().c_str(), sizeof(rtcState.passphrase));
+  rtcState.channel = 0;
+
+  // the minutes sampled on battery since the last full boot go into the persisted history
+  rtcState.replayHistory([](const HistoryRecord &record)
+                         {
+                           xSemaphoreTake(historyMutex, portMAX_DELAY);
+                           replayHistoryRecord(record);
+                           if (historyPersisted)
+                           {
+                             historyLog.append(record);
+                           }
+                           xSemaphoreGive(historyMutex);
+                         });
+  flushHistory();
+
+#ifndef OFFLINE_MODE
+  // SNTP was started by setup(), the wake ups go on with its mapping
+  if (!waitForTimeSync(0, timeSyncTimeout))
+  {
+    Serial.println("no SNTP update, the next wake up tries again");
+  }
+#endif
+
+  // the PMS is running already, the first sample only waits for it to settle
+  rtcState.phase = RtcState::Phase::sample;
+  displayMessage(2000, connectedIcon, "battery mode", "sampling every minute");
+  sleepFor(pmsWarmUp);
+}
+
+// timer wake up: no display, no file system and no portal, only sensors and broker
+void batteryWake()
+{
+  Serial.begin(115200);
+  rtcState.wakeups++;
+  // the clock continues where the last wake up left it
+  clockBase = rtcState.clockBase;
+  bootId = rtcState.bootId;
+  bootEpochMicros = rtcState.bootEpochMicros;
+  timeSync.restore(rtcState.timeSync);
+  pmsSerial.begin(9600);
+  // the sensor may still be asleep, don't wait for a frame
+  pms.begin(&pmsSerial, 0);
+
+  if (rtcState.phase == RtcState::Phase::warmUp)
+  {
+    pms.wake();
+    rtcState.phase = RtcState::Phase::sample;
+    sleepFor(pmsWarmUp);
+  }
+
+  Sample sample = {};
+  pms.setMode(PmsMode::passive);
+  if (pms.getReading(&sample.pms) != PMS5003::readSuccess)
+  {
+    Serial.println("no PMS reading");
+  }
+  pms.sleep();
 
-  yield();
+  co2Serial.begin(9600);
+  co2.begin(co2Stream);
+  sample.co2 = co2.getCO2();
+  sample.co2Temp = co2.getTemperature();
 
-  co2History.addMeasurement(currentCo2);
-  pm010History.addMeasurement(pmsData.pm10_standard);
-  pm025History.addMeasurement(pmsData.pm25_standard);
-  pm100History.addMeasurement(pmsData.pm100_standard);
-  brightnessHistory.addMeasurement(currentLux);
+  Wire.begin();
+  brightness.begin();
+  sample.lux = brightness.get_lux();
+  stampSample(sample);
+
+  rtcState.pushPending(sample);
+  rtcState.addMinute(toHistoryRecord(sample));
 
 #ifndef OFFLINE_MODE
+  strlcpy(room, rtcState.room, sizeof(room));
+  strlcpy(mqtt_server, rtcState.mqttServer, sizeof(mqtt_server));
+  renderTopics();
+  bool connected = connectFast();
+  // the samples are held while there is no mapping, later updates follow the rate of the sleep clock
+  if (connected && (!timeSync.synced() || rtcState.wakeups % timeSyncWakeups == 0))
+  {
+    uint32_t syncs = timeSync.stats().syncs;
+    sntp_set_time_sync_notification_cb(onTimeSync);
+    configTime(0, 0, "pool.ntp.org");
+    waitForTimeSync(syncs, timeSyncTimeout);
+  }
+  if (connected && publishPending())
+  {
+    // esp_timer starts at boot, so this is the time since the wake up
+    rtcState.recordWakeToPublish(micros());
+    Serial.printf("published %u us after waking up, max %u us over %u wake ups\n",
+                  rtcState.lastWakeToPublish, rtcState.maxWakeToPublish, rtcState.publishes);
+  }
+  else
+  {
+    Serial.printf("keeping %u samples for the next wake up\n", rtcState.pendingCount);
+  }
+  // a graceful disconnect goes out after the publishes, wait for it before the radio is cut
+  mqtt.disconnect();
+  uint32_t disconnectStart = millis();
+  while (mqtt.connected() && millis() - disconnectStart < 1000)
+  {
+    delay(10);
+  }
+  WiFi.disconnect(true);
+#endif
+
+  rtcState.phase = RtcState::Phase::warmUp;
+  uint32_t awake = millis();
+  uint32_t remaining = samplePeriod - pmsWarmUp;
+  sleepFor(awake < remaining ? remaining - awake : 0);
+}
+
+void sleepFor(uint32_t duration)
+{
+  portENTER_CRITICAL(&timeSyncMux);
+  rtcState.timeSync = timeSync.save();
+  rtcState.bootEpochMicros = bootEpochMicros;
+  portEXIT_CRITICAL(&timeSyncMux);
+  rtcState.bootId = bootId;
+  // the boot before esp_timer starts isn't counted, it repeats with every wake up,
+  // so the SNTP updates see it as a slightly slower clock
+  rtcState.clockBase = monotonicMicros() + (uint64_t)duration * 1000;
+  rtcState.seal();
+  esp_sleep_enable_timer_wakeup((uint64_t)duration * 1000);
+  esp_deep_sleep_start();
+}
+
+bool connectFast()
+{
+  WiFi.mode(WIFI_STA);
+  // with the channel and BSSID of the last connect there is no need to scan
+  if (rtcState.channel)
+  {
+    WiFi.begin(rtcState.ssid, rtcState.passphrase, rtcState.channel, rtcState.bssid);
+  }
+  else
+  {
+    WiFi.begin(rtcState.ssid, rtcState.passphrase);
+  }
+
+  uint32_t connectStart = millis();
+  while (WiFi.status() != WL_CONNECTED)
+  {
+    if (millis() - connectStart > fastConnectTimeout)
+    {
+      // the access point may have moved, scan next time
+      rtcState.channel = 0;
+      Serial.println("WiFi connect timed out");
+      return false;
+    }
+    delay(10);
+  }
+  rtcState.channel = WiFi.channel();
+  memcpy(rtcState.bssid, WiFi.BSSID(), sizeof(rtcState.bssid));
+
+  mqtt.setServer(mqtt_server, 1883);
+  mqtt.setClientId(topics.clientId());
+  mqtt.connect();
+  uint32_t mqttStart = millis();
+  while (!mqtt.connected())
+  {
+    if (millis() - mqttStart > fastConnectTimeout)
+    {
+      Serial.println("MQTT connect timed out");
+      return false;
+    }
+    delay(10);
+  }
+  return true;
+}
+
+bool publishPending()
+{
+  // the clock of an earlier full boot is gone, its samples without a timestamp can't be placed
+  while (rtcState.pendingCount > 0 && rtcState.pendingAt(0).timestamp == 0 && rtcState.pendingAt(0).bootId != bootId)
+  {
+    rtcState.popPending(1);
+    rtcState.droppedSamples++;
+  }
+
+  while (rtcState.pendingCount > 0)
+  {
+    influxBatch.clear();
+    uint8_t batched = 0;
+    while (batched < rtcState.pendingCount && batched < samplesPerPublish && influxBatch.capacityLeft() >= sampleLinesSize)
+    {
+      // samples are held until there is a time for them, the stamp is kept for a resend
+      Sample &sample = rtcState.pendingAt(batched);
+      if (!resolveTimestamp(sample))
+      {
+        break;
+      }
+      appendInfluxLines(influxBatch, sample);
+      batched++;
+    }
+    if (batched == 0 || !mqtt.publish(persistentTopic, 0, false, influxBatch.c_str()))
+    {
+      return false;
+    }
+    rtcState.popPending(batched);
+  }
+  return true;
+}
+
+// waits until SNTP updated the mapping more than syncs times, false if that took longer than timeout
+bool waitForTimeSync(uint32_t syncs, uint32_t timeout)
+{
+  uint32_t waitStart = millis();
+  for (;;)
+  {
+    portENTER_CRITICAL(&timeSyncMux);
+    bool updated = timeSync.stats().syncs > syncs;
+    portEXIT_CRITICAL(&timeSyncMux);
+    if (updated)
+    {
+      return true;
+    }
+    if (millis() - waitStart > timeout)
+    {
+      return false;
+    }
+    delay(10);
+  }
+}
+#endif
+
+void stampSample(Sample &sample)
+{
+  sample.acquiredAt = monotonicMicros();
+  sample.bootId = bootId;
+  sample.timestamp = unixMillisAt(sample.acquiredAt);
+}
+
+// esp_timer starts over with every boot, deep sleep included
+uint64_t monotonicMicros()
+{
+  return clockBase + esp_timer_get_time();
+}
+
+// samples taken before the first SNTP update get their time once it is known,
+// false as long as the sample can't be placed in time
+bool resolveTimestamp(Sample &sample)
+{
+  if (sample.timestamp == 0 && sample.bootId == bootId)
+  {
+    portENTER_CRITICAL(&timeSyncMux);
+    uint64_t epoch = bootEpochMicros;
+    portEXIT_CRITICAL(&timeSyncMux);
+    if (epoch > 0)
+    {
+      sample.timestamp = (sample.acquiredAt + epoch) / 1000;
+    }
+  }
+  return sample.timestamp > 0;
+}
+
+// influx only ignores a resent point if it has the same timestamp, a point without one is
+// stored at its arrival time again. Samples of an earlier boot that never got a timestamp
+// can't be placed anymore, so they are dropped from the front of the outbox instead.
+void discardUnstampable()
+{
+  Sample oldest;
+  while (outbox.peek(0, oldest) && oldest.timestamp == 0 && oldest.bootId != bootId)
+  {
+    outbox.pop(1);
+    unstampableSamples++;
+  }
+}
+
+// unix time in milliseconds or 0 as long as the clock wasn't set
+uint64_t unixMillisAt(uint64_t monotonicMicros)
+{
+  portENTER_CRITICAL(&timeSyncMux);
+  uint64_t unixMicros = timeSync.toUnixMicros(monotonicMicros);
+  portEXIT_CRITICAL(&timeSyncMux);
+  return unixMicros / 1000;
+}
+
+// called by SNTP right after it set the system time
+void onTimeSync(struct timeval *time)
+{
+  uint64_t monotonic = monotonicMicros();
+  portENTER_CRITICAL(&timeSyncMux);
+  uint64_t unixMicros = (uint64_t)time->tv_sec * 1000000 + time->tv_usec;
+  timeSync.update(monotonic, unixMicros);
+  if (bootEpochMicros == 0)
+  {
+    bootEpochMicros = unixMicros - monotonic;
+  }
+  portEXIT_CRITICAL(&timeSyncMux);
+}
+
+// the per room topics only carry the current values, there is no point in backfilling them
+void publishLiveValues(const Sample &sample)
+{
   // send data to the server
-  String baseTopic = String("atmonode/") + room + "/";
-  mqtt.publish(String(baseTopic + "co2").c_str(), String(currentCo2).c_str());
-  mqtt.publish(String(baseTopic + "pm10").c_str(), String(pmsData.pm10_standard).c_str());
-  mqtt.publish(String(baseTopic + "pm25").c_str(), String(pmsData.pm25_standard).c_str());
-  mqtt.publish(String(baseTopic + "pm100").c_str(), String(pmsData.pm100_standard).c_str());
-  yield();
-
-  // messages for storing the data in influxdb
-  const char *persistentTopic = "atmonode";
-  char messageBuffer[50] = {0};
-  createInfluxMessage(messageBuffer, 50, "co2", currentCo2);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm10_std", pmsData.pm10_standard);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm25_std", pmsData.pm25_standard);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm100_std", pmsData.pm100_standard);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm10_env", pmsData.pm10_env);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm25_env", pmsData.pm25_env);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createInfluxMessage(messageBuffer, 50, "pm100_env", pmsData.pm100_env);
-  mqtt.publish(persistentTopic, messageBuffer);
-
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_03um, 0.3);
-  Serial.println(messageBuffer);
-  mqtt.publish(persistentTopic, messageBuffer);
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_05um, 0.5);
-  mqtt.publish(persistentTopic, messageBuffer);
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_10um, 1.0);
-  mqtt.publish(persistentTopic, messageBuffer);
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_25um, 2.5);
-  mqtt.publish(persistentTopic, messageBuffer);
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_50um, 5.0);
-  mqtt.publish(persistentTopic, messageBuffer);
-  createParticleMessage(messageBuffer, 50, "particles", pmsData.particles_100um, 10.0);
-  mqtt.publish(persistentTopic, messageBuffer);
+  uint32_t now = millis();
+  publishLiveValue(TopicTable::co2, sample.co2, now);
+  publishLiveValue(TopicTable::pm10, sample.pms.pm10_standard, now);
+  publishLiveValue(TopicTable::pm25, sample.pms.pm25_standard, now);
+  publishLiveValue(TopicTable::pm100, sample.pms.pm100_standard, now);
+}
+
+// held back values, including those that failed to go out, are summarised with the next published one
+void publishLiveValue(TopicTable::Topic topic, int32_t value, uint32_t now)
+{
+  Deadband &deadband = liveDeadbands[topic];
+  if (!deadband.shouldPublish(value, now) || !publishValue(topic, value))
+  {
+    deadband.suppress(value);
+    return;
+  }
+
+  const Deadband::Window &held = deadband.window();
+  if (held.count > 0)
+  {
+    char payload[64];
+    snprintf(payload, sizeof(payload), "{\"count\":%u,\"min\":%d,\"max\":%d,\"mean\":%d}",
+             held.count, held.min, held.max, (int32_t)(held.sum / held.count));
+    mqtt.publish(topics.summaryTopic(topic), 0, false, payload);
+  }
+  deadband.published(value, now);
+}
+
+bool publishValue(TopicTable::Topic topic, int32_t value)
+{
+  char payload[12];
+  snprintf(payload, sizeof(payload), "%d", value);
+  return mqtt.publish(topics.topic(topic), 0, false, payload) != 0;
+}
+
+void renderTopics()
+{
+  if (!topics.render(persistentTopic, room))
+  {
+    Serial.println("room name too long, topics are truncated");
+  }
+}
+
+// messages for storing the data in influxdb, samples leave the outbox only once the broker took them
+void drainOutbox()
+{
+  // samples the outbox dropped to make room may have been in flight, their acks mean nothing now
+  static uint32_t droppedAtFront = 0;
+  if (outbox.droppedAtFront() != droppedAtFront)
+  {
+    inFlight.dropFront(outbox.droppedAtFront() - droppedAtFront);
+    droppedAtFront = outbox.droppedAtFront();
+  }
+
+  // acknowledged batches leave the outbox, in order even if the acks are not
+  uint16_t packetId;
+  while (xQueueReceive(ackQueue, &packetId, 0) == pdTRUE)
+  {
+    uint16_t delivered = inFlight.acknowledge(packetId);
+    if (delivered > 0)
+    {
+      outbox.pop(delivered);
+    }
+  }
+  // unstamped samples are never batched, so they reach the front once the window is empty
+  if (inFlight.size() == 0)
+  {
+    discardUnstampable();
+  }
+
+  if (mqttLink.takeReconnected())
+  {
+    inFlight.resendAll();
+  }
+  resendInFlight();
+
+  // the window is kept full, so a backlog isn't sent at one round trip per batch,
+  // new batches wait until everything in it went out again after a reconnect
+  bool backlog = outbox.size() > inFlight.samples() + samplesPerPublish;
+  while (inFlight.unsent() == 0 && !inFlight.full() && outbox.size() >= inFlight.samples() + samplesPerPublish)
+  {
+    uint8_t batched = buildBatch(inFlight.samples(), samplesPerPublish);
+    if (batched == 0)
+    {
+      break;
+    }
+    uint16_t packetId = publishBatch(false, 0);
+    if (packetId == 0)
+    {
+      // the TCP send buffer is full, the batch goes out with the next drain
+      break;
+    }
+    inFlight.add(packetId, batched);
+  }
+
+  if (backlog)
+  {
+    Serial.printf("outbox backlog: %u samples, %u batches in flight\n", outbox.size(), inFlight.size());
+  }
+}
+
+// one post at a time, the next batch only goes out once the previous one was written
+void drainOutboxHttp()
+{
+  uint32_t now = millis();
+  discardUnstampable();
+  if (outbox.size() == 0 || !influxHttp.ready(now))
+  {
+    return;
+  }
+
+  // samples of an earlier boot have no comparable age, they are sent right away
+  Sample oldest;
+  if (outbox.size() < samplesPerPublish && outbox.peek(0, oldest) && oldest.bootId == bootId &&
+      monotonicMicros() - oldest.acquiredAt < (uint64_t)influxMaxAge * 1000)
+  {
+    return;
+  }
+
+  uint8_t batched = buildInfluxBatch(0, samplesPerPublish);
+  if (batched == 0)
+  {
+    return;
+  }
+  switch (influxHttp.write(influxBatch.c_str(), influxBatch.length(), now))
+  {
+  case InfluxHttpWriter::Result::written:
+    outbox.pop(batched);
+    break;
+  case InfluxHttpWriter::Result::rejected:
+    Serial.printf("influx rejected a batch of %u samples, dropping it\n", batched);
+    outbox.pop(batched);
+    break;
+  case InfluxHttpWriter::Result::retryLater:
+    Serial.printf("influx write retried in %u ms, %u samples waiting\n", influxHttp.stats().lastBackoff, outbox.size());
+    break;
+  }
+}
+
+void applyPayloadFormat()
+{
+  payloadFormat = strcmp(payload_format, "cbor") == 0 ? PayloadFormat::cbor : PayloadFormat::influx;
+}
+
+// up to count samples starting at first in the outbox, in the payload format of the node
+uint8_t buildBatch(uint16_t first, uint16_t count)
+{
+  return payloadFormat == PayloadFormat::cbor ? buildCborBatch(first, count) : buildInfluxBatch(first, count);
+}
+
+// influx lines for up to count samples starting at first in the outbox
+uint8_t buildInfluxBatch(uint16_t first, uint16_t count)
+{
+  influxBatch.clear();
+  uint8_t batched = 0;
+  Sample sample;
+  while (batched < count && influxBatch.capacityLeft() >= sampleLinesSize && outbox.peek(first + batched, sample))
+  {
+    // a batch ends before a sample without a timestamp, it waits for SNTP
+    if (!resolveTimestamp(sample))
+    {
+      break;
+    }
+    appendInfluxLines(influxBatch, sample);
+    batched++;
+  }
+
+  if (influxBatch.overflowed())
+  {
+    Serial.println("influx batch overflowed, some lines were dropped");
+  }
+  return batched;
+}
+
+uint8_t buildCborBatch(uint16_t first, uint16_t count)
+{
+  cborBatch.begin(room);
+  uint8_t batched = 0;
+  Sample sample;
+  while (batched < count && outbox.peek(first + batched, sample))
+  {
+    if (!resolveTimestamp(sample) || !cborBatch.add(sample))
+    {
+      break;
+    }
+    batched++;
+  }
+  cborBatch.finish();
+  return batched;
+}
+
+// the batch built last, a packet id of 0 lets the client pick one
+uint16_t publishBatch(bool dup, uint16_t packetId)
+{
+  if (payloadFormat == PayloadFormat::cbor)
+  {
+#if DEBUG
+    Serial.printf("cbor batch of %u samples, %u bytes\n", cborBatch.recordCount(), cborBatch.length());
+#endif
+    return mqtt.publish(binaryTopic, 1, false, (const char *)cborBatch.data(), cborBatch.length(), dup, packetId);
+  }
+#if DEBUG
+  // a full batch is a few kB, printing it takes longer than sending it
+  Serial.println(influxBatch.c_str());
 #endif
+  return mqtt.publish(persistentTopic, 1, false, influxBatch.c_str(), 0, dup, packetId);
+}
+
+// the batches are built again from the outbox, they come out exactly as before
+void resendInFlight()
+{
+  if (inFlight.unsent() == 0)
+  {
+    return;
+  }
+  uint8_t resent = 0;
+  uint16_t first = 0;
+  for (uint8_t i = 0; i < inFlight.size(); i++)
+  {
+    if (i >= inFlight.size() - inFlight.unsent())
+    {
+      buildBatch(first, inFlight.samplesAt(i));
+      if (publishBatch(true, inFlight.packetIdAt(i)) == 0)
+      {
+        // the TCP send buffer is full, the next drain goes on from here
+        break;
+      }
+      inFlight.resent();
+      resent++;
+    }
+    first += inFlight.samplesAt(i);
+  }
+  if (resent > 0)
+  {
+    Serial.printf("resent %u unacknowledged batches, %u left\n", resent, inFlight.unsent());
+  }
+}
+
+void appendInfluxLines(LineProtocolWriter &line, const Sample &sample)
+{
+  createInfluxMessage(line, "co2", sample.co2, sample.timestamp);
+  createInfluxMessage(line, "pm10_std", sample.pms.pm10_standard, sample.timestamp);
+  createInfluxMessage(line, "pm25_std", sample.pms.pm25_standard, sample.timestamp);
+  createInfluxMessage(line, "pm100_std", sample.pms.pm100_standard, sample.timestamp);
+  createInfluxMessage(line, "pm10_env", sample.pms.pm10_env, sample.timestamp);
+  createInfluxMessage(line, "pm25_env", sample.pms.pm25_env, sample.timestamp);
+  createInfluxMessage(line, "pm100_env", sample.pms.pm100_env, sample.timestamp);
+
+  createParticleMessage(line, "particles", sample.pms.particles_03um, "0.3", sample.timestamp);
+  createParticleMessage(line, "particles", sample.pms.particles_05um, "0.5", sample.timestamp);
+  createParticleMessage(line, "particles", sample.pms.particles_10um, "1.0", sample.timestamp);
+  createParticleMessage(line, "particles", sample.pms.particles_25um, "2.5", sample.timestamp);
+  createParticleMessage(line, "particles", sample.pms.particles_50um, "5.0", sample.timestamp);
+  createParticleMessage(line, "particles", sample.pms.particles_100um, "10.0", sample.timestamp);
+}
+
+void restoreHistory()
+{
+  if (!LITTLEFS.begin(true))
+  {
+    Serial.println("failed to mount FS, history won't be persisted");
+    return;
+  }
+  historyPersisted = true;
+  outbox.begin(&LITTLEFS);
+
+  uint32_t restoreStart = micros();
+  bool restored = historyLog.restore(replayHistoryRecord);
+  uint32_t restoreDuration = micros() - restoreStart;
+  if (restored)
+  {
+    Serial.printf("restored history in %u us, replayed %u records\n", restoreDuration, historyLog.restoredRecords());
+  }
+}
 
-  yield();
+void replayHistoryRecord(const HistoryRecord &record)
+{
+  co2History.addMeasurement(record.co2);
+  pm010History.addMeasurement(record.pm010);
+  pm025History.addMeasurement(record.pm025);
+  pm100History.addMeasurement(record.pm100);
+  brightnessHistory.addMeasurement(record.lux);
+}
+
+void addToHistory(const Sample &sample)
+{
+  HistoryRecord record = toHistoryRecord(sample);
 
-  displayParticleCount();
-  uint16_t loopDuration = millis() - loopStart;
-  if (loopDuration < 60 * 1000)
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  replayHistoryRecord(record);
+  if (historyPersisted)
   {
-    //make sure to run the loop every 60s
-    delayWhileCheckingButtons(60 * 1000 - loopDuration);
+    historyLog.append(record);
   }
+  xSemaphoreGive(historyMutex);
+}
+
+// write out the batched records so a restart doesn't lose them
+HistoryRecord toHistoryRecord(const Sample &sample)
+{
+  HistoryRecord record;
+  record.co2 = sample.co2;
+  record.pm010 = sample.pms.pm10_standard;
+  record.pm025 = sample.pms.pm25_standard;
+  record.pm100 = sample.pms.pm100_standard;
+  record.lux = sample.lux;
+  return record;
+}
+
+void flushHistory()
+{
+  if (!historyPersisted)
+  {
+    return;
+  }
+  xSemaphoreTake(historyMutex, portMAX_DELAY);
+  historyLog.flush();
+  xSemaphoreGive(historyMutex);
 }
 
 void setupOTA()
 {
   ArduinoOTA.onStart([]()
-                     { displayMessage(1, warningIcon, "update in", "progress"); });
+                     {
+                       flushHistory();
+                       displayMessage(1, warningIcon, "update in", "progress");
+                     });
   ArduinoOTA.onEnd([]()
                    { displayMessage(1000, warningIcon, "done", "restarting"); });
   ArduinoOTA.onProgress([](unsigned int progress, unsigned int total)
@@ -317,33 +1457,58 @@ void setupOTA()
   ArduinoOTA.begin();
 }
 
-void delayWhileCheckingButtons(uint32_t time)
+void IRAM_ATTR onButtonEdge()
 {
-  uint32_t start = millis();
-  while (millis() - start < time)
+  // the level is read again by the scheduler, the interrupt only wakes it up
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(schedulerTaskHandle, &woken);
+  if (woken)
   {
-    // Handle OTA update server
-    ArduinoOTA.handle();
-
-    checkButtons();
-    delay(5);
+    portYIELD_FROM_ISR();
   }
 }
 
-void checkButtons()
+// runs after every wake up of the scheduler, returns how long the buttons can wait
+uint32_t serviceButtons()
 {
-  if (!digitalRead(resetButton))
+  uint32_t now = millis();
+  handleGesture(resetButton, resetButtonState.update(!digitalRead(resetButton), now));
+  handleGesture(portalButton, portalButtonState.update(!digitalRead(portalButton), now));
+
+  uint32_t resetWait = resetButtonState.nextCheck(now);
+  uint32_t portalWait = portalButtonState.nextCheck(now);
+  return resetWait < portalWait ? resetWait : portalWait;
+}
+
+void handleGesture(uint8_t button, ButtonGesture gesture)
+{
+  if (gesture == ButtonGesture::shortPress)
   {
+    cyclePage();
+  }
+  else if (gesture == ButtonGesture::longPress && button == resetButton)
+  {
+    flushHistory();
     ESP.restart();
   }
-
-  if (!digitalRead(portalButton))
+  else if (gesture == ButtonGesture::longPress && button == portalButton)
   {
+    flushHistory();
     wifiManager.resetSettings();
     ESP.restart();
   }
 }
 
+void cyclePage()
+{
+  xSemaphoreTake(displayMutex, portMAX_DELAY);
+  displayPage = displayPage == DisplayPage::particles ? DisplayPage::climate : DisplayPage::particles;
+  // the chart has to come back in full after the other page drew over it
+  particleChart.invalidate();
+  displayCurrentPage();
+  xSemaphoreGive(displayMutex);
+}
+
 //callback notifying us of the need to save config
 void saveConfigCallback()
 {
@@ -385,6 +1550,16 @@ void loadWLANConfig()
             strcpy(mqtt_server, doc["mqtt_server"]);
           }
           strcpy(room, doc["room"]);
+          if (doc.containsKey("payload_format"))
+          {
+            strlcpy(payload_format, doc["payload_format"], sizeof(payload_format));
+          }
+          if (doc.containsKey("influx_url"))
+          {
+            strlcpy(influx_url, doc["influx_url"], sizeof(influx_url));
+          }
+          applyPayloadFormat();
+          renderTopics();
         }
         configFile.close();
       }
@@ -407,6 +1582,8 @@ void saveWLANConfig()
   DynamicJsonDocument doc(512);
   doc["mqtt_server"] = mqtt_server;
   doc["room"] = room;
+  doc["payload_format"] = payload_format;
+  doc["influx_url"] = influx_url;
 
   File configFile = LITTLEFS.open("/config.json", "w");
   if (!configFile)
@@ -424,12 +1601,16 @@ void setupWLAN()
   // auto-manage wifi configuration
   ESP_WMParameter mqtt_server_param("MQTT Server", "IP or hostname", mqtt_server, 32);
   ESP_WMParameter room_param("Room", "room", room, 32);
+  ESP_WMParameter payload_format_param("Payload", "influx or cbor", payload_format, 7);
+  ESP_WMParameter influx_url_param("Influx URL", "http://host:8086/write?db=atmonode", influx_url, 95);
 
   //set config save notify callback
   wifiManager.setSaveConfigCallback(saveConfigCallback);
 
   wifiManager.addParameter(&mqtt_server_param);
   wifiManager.addParameter(&room_param);
+  wifiManager.addParameter(&payload_format_param);
+  wifiManager.addParameter(&influx_url_param);
 
   // create a unique SSID
   String apSSID = String("AtmoNode") + String(random(10, 100), DEC);
@@ -465,6 +1646,10 @@ void setupWLAN()
   //read updated parameters
   strcpy(mqtt_server, mqtt_server_param.getValue());
   strcpy(room, room_param.getValue());
+  strlcpy(payload_format, payload_format_param.getValue(), sizeof(payload_format));
+  strlcpy(influx_url, influx_url_param.getValue(), sizeof(influx_url));
+  applyPayloadFormat();
+  renderTopics();
 
   Serial.println("connected...");
   Serial.println("local ip");
@@ -476,184 +1661,107 @@ void setupWLAN()
   display.fillScreen(TFT_WHITE);
 }
 
-void createInfluxMessage(char *dst, uint8_t len, const char *topic, float value)
+void createInfluxMessage(LineProtocolWriter &line, const char *topic, int32_t value, uint64_t timestamp)
 {
-  uint8_t pos = 0;
-  strncpy(dst + pos, topic, len - pos);
-  pos += strlen(topic);
-  strncpy(dst + pos, ",site=", len - pos);
-  pos += 6;
-  strncpy(dst + pos, room, len - pos);
-  pos += strlen(room);
-  strncpy(dst + pos, " value=", len - pos);
-  pos += 7;
-  String val_str = String(value);
-  strncpy(dst + pos, val_str.c_str(), len - pos);
+  line.beginLine(topic).tag("site", room).field("value", value);
+  if (timestamp > 0)
+  {
+    line.timestamp(timestamp);
+  }
+  line.end();
 }
 
-void createParticleMessage(char *dst, uint8_t len, const char *topic, uint16_t value, float size)
+void createParticleMessage(LineProtocolWriter &line, const char *topic, uint16_t value, const char *size, uint64_t timestamp)
 {
-  uint8_t pos = 0;
-
-  strncpy(dst + pos, topic, len - pos);
-  pos += strlen(topic);
-
-  strncpy(dst + pos, ",site=", len - pos);
-  pos += 6;
-
-  strncpy(dst + pos, room, len - pos);
-  pos += strlen(room);
-
-  strncpy(dst + pos, ",size=", len - pos);
-  pos += 6;
-
-  String sizeStr = String(size, 1);
-  strncpy(dst + pos, sizeStr.c_str(), len - pos);
-  pos += sizeStr.length();
-
-  strncpy(dst + pos, " value=", len - pos);
-  pos += 7;
-
-  String val_str = String(value);
-  strncpy(dst + pos, val_str.c_str(), len - pos);
+  line.beginLine(topic).tag("site", room).tag("size", size).field("value", (int32_t)value);
+  if (timestamp > 0)
+  {
+    line.timestamp(timestamp);
+  }
+  line.end();
 }
 
-void displayMessage(uint16_t duration, const uint16_t *icon, const char *message1, const char *message2)
+void displayMessage(uint16_t duration, const CompressedIcon &icon, const char *message1, const char *message2)
 {
+  // the message stays on screen for its duration, hold the display until then
+  xSemaphoreTake(displayMutex, portMAX_DELAY);
+  if (compositor.enabled())
+  {
+    compositor.invalidatePanel();
+  }
+  else
+  {
+    particleChart.invalidate();
+  }
   display.setTextFont(2);
   display.fillScreen(TFT_WHITE);
-  display.pushImage(
-      (display.width() - iconWidth) / 2, 0,
-      iconWidth, iconHeight, icon);
+  uint32_t decodeMicros = drawIcon(display, (display.width() - icon.width) / 2, 0, icon);
+  Serial.printf("icon decoded in %u us\n", decodeMicros);
   displayPrintCenterln(message1, iconHeight + 5);
   displayPrintCenterln(message2, display.getCursorY());
   delay(duration);
+  xSemaphoreGive(displayMutex);
 }
 
-void displayParticleCount()
+void displayCurrentPage()
 {
-  const uint8_t paddingL = 25;
-  const uint8_t paddingR = 10;
-  const uint8_t paddingT = 35;
-  const uint8_t paddingB = 20;
-
-  display.fillScreen(0x10A3);
-  display.setTextFont(2);
-
-  const uint8_t hourBarWidth = (display.width() - 60 - (paddingL + paddingR)) / (ValueHistory<uint16_t>::hourlyBufferLength);
-  const uint32_t maxParticleVal = pm010History.getMaxValue() + pm025History.getMaxValue() + pm100History.getMaxValue();
-  const uint32_t minParticleVal = pm010History.getMinValue() + pm025History.getMinValue() + pm100History.getMinValue();
-  const uint32_t graphLowerBound = (minParticleVal / 10) * 10;
-  const uint32_t graphUpperBound = ((maxParticleVal / 10) + 1) * 10;
-  auto particleCountToBarHeight = [graphLowerBound, graphUpperBound](uint16_t value)
-  {
-    auto unit = ((display.height() - (paddingT + paddingB)) / ((float)graphUpperBound - graphLowerBound));
-    return (uint16_t)(paddingB + (value - graphLowerBound) * unit);
-  };
-
-  auto textColorValue = [](uint16_t value)
+  if (displayPage == DisplayPage::climate)
   {
-    if (value >= pmDangerThreshold)
-    {
-      return TFT_RED;
-    }
-    else if (value >= pmWarnThreshold)
-    {
-      return TFT_YELLOW;
-    }
-    else
-    {
-      return TFT_GREEN;
-    }
-  };
-
-  uint16_t xPos = paddingL;
-  auto yMax = display.height();
-
-  // draw a grid line dividing 6 hour steps
-  display.setTextColor(TFT_DARKGREY, 0x10A3);
-  display.setTextDatum(TC_DATUM);
-  for (uint8_t lx = 0; lx <= ValueHistory<uint16_t>::hourlyBufferLength / 6; lx++)
-  {
-    auto legendX = xPos + ((lx)*hourBarWidth * 6);
-    display.drawLine(legendX, paddingT, legendX, display.height() - paddingB, TFT_DARKGREY);
-    auto timeOffset = ValueHistory<uint16_t>::hourlyBufferLength - (6 * lx) + 1;
-    String label = String("-") + String(timeOffset) + "h";
-    display.drawString(label, legendX, (display.height() - paddingB) + 2);
+    displayClimate();
   }
-
-  //draw horizontal grid lines to divide the chart in 5 spaces
-  auto chartHeight = display.height() - (paddingT + paddingB);
-  display.setTextDatum(MR_DATUM);
-  for (uint8_t ly = 0; ly < 5; ly++)
+  else
   {
-    auto lineY = paddingT + (chartHeight / 5) * ly;
-    display.drawLine(paddingL, lineY, display.width() - paddingR, lineY, TFT_DARKGREY);
-    uint16_t value = (((graphUpperBound - graphLowerBound) / 5) * (5 - ly)) + graphLowerBound;
-    display.drawString(String(value), paddingL - 2, lineY + 5);
+    displayParticleCount();
   }
+}
 
-  for (int8_t hourIdx = ValueHistory<uint16_t>::hourlyBufferLength - 2; hourIdx >= 0; hourIdx--)
-  {
-    auto pm10Height = particleCountToBarHeight(pm010History.hourlyData[hourIdx]);
-    auto pm25Height = particleCountToBarHeight(pm025History.hourlyData[hourIdx]);
-    auto pm100Height = particleCountToBarHeight(pm100History.hourlyData[hourIdx]);
+void displayParticleCount()
+{
+  particleChart.render();
 
-    display.fillCircle(xPos, yMax - pm10Height, 1, 0x854E);
-    display.fillCircle(xPos, yMax - pm25Height, 1, 0xDDAA);
-    display.fillCircle(xPos, yMax - pm100Height, 1, 0x865A);
-    xPos += hourBarWidth;
-  }
+  int16_t top, bottom;
+  particleChart.dirtyRows(top, bottom);
+  compositor.push(top, bottom);
 
-  for (int8_t minIdx = ValueHistory<uint16_t>::lastHourBufferLength - 1; minIdx >= 0; minIdx--)
+  const ParticleChart::Stats &stats = particleChart.stats();
+  Serial.printf("render took %u us (max %u us): %u columns, %u scrolled, %u headers%s%s\n",
+                stats.lastMicros, stats.maxMicros, stats.dirtyColumns, stats.scrolledColumns, stats.dirtyHeaders,
+                stats.plotRedrawn ? ", plot" : "", stats.fullRedraw ? ", full screen" : "");
+  if (compositor.enabled())
   {
-    auto pm10Height = particleCountToBarHeight(pm010History.lastHourData[minIdx]);
-    auto pm25Height = particleCountToBarHeight(pm025History.lastHourData[minIdx]);
-    auto pm100Height = particleCountToBarHeight(pm100History.lastHourData[minIdx]);
-    display.fillCircle(xPos, yMax - pm10Height, 1, 0x854E);
-    display.fillCircle(xPos, yMax - pm25Height, 1, 0xDDAA);
-    display.fillCircle(xPos, yMax - pm100Height, 1, 0x865A);
-    xPos += 1;
+    const FrameCompositor::Stats &pushStats = compositor.stats();
+    Serial.printf("pushed rows %d-%d in %u us, %u us of it blocked on the DMA transfer\n",
+                  top, bottom, pushStats.lastPushMicros, pushStats.lastWaitMicros);
   }
+}
 
-  display.setTextDatum(TC_DATUM);
-  display.setTextColor(0x854E, 0x10A3);
-  display.drawString("PM", 13, 0);
-  display.drawString("1.0", 13, display.fontHeight());
-
-  display.setTextDatum(TL_DATUM);
-  display.setTextColor(textColorValue(pm010History.lastData), 0x10A3);
-  display.setFreeFont(VALUE_FONT);
-  display.drawString(String(pm010History.lastData), 30, 1);
-
-  auto pm025Value = String(pm025History.lastData);
-  auto pm025Width = display.textWidth(pm025Value);
-
-  display.setTextFont(2);
-  display.setTextDatum(TC_DATUM);
-  auto pm025labelX = (display.width() - (pm025Width + 30)) / 2;
-
-  display.setTextColor(0xDDAA, 0x10A3);
-  display.drawString("PM", pm025labelX, 0);
-  display.drawString("2.5", pm025labelX, display.fontHeight());
-
-  display.setFreeFont(VALUE_FONT);
-  display.setTextColor(textColorValue(pm025History.lastData), 0x10A3);
-  display.drawString(pm025Value, pm025labelX + 30, 1);
-
-  auto pm100Value = String(pm100History.lastData);
-  auto pm100Width = display.textWidth(pm100Value);
-
-  display.setTextFont(2);
-  display.setTextDatum(TC_DATUM);
-  display.setTextColor(0x865A, 0x10A3);
-  auto pm100labelX = (display.width() - (pm100Width + 30));
-  display.drawString("PM", pm100labelX, 0);
-  display.drawString("10", pm100labelX, display.fontHeight());
+// latest CO2, temperature and brightness, the page is small enough to always draw in full
+void displayClimate()
+{
+  TFT_eSPI &canvas = compositor.canvas();
+
+  char values[3][16];
+  snprintf(values[0], sizeof(values[0]), "%d ppm", displayedSample.co2);
+  snprintf(values[1], sizeof(values[1]), "%d C", displayedSample.co2Temp);
+  snprintf(values[2], sizeof(values[2]), "%.0f lux", displayedSample.lux);
+  const char *labels[] = {"CO2", "Temperature", "Light"};
+
+  canvas.fillScreen(TFT_BLACK);
+  canvas.setTextColor(TFT_WHITE, TFT_BLACK);
+  int16_t rowHeight = canvas.height() / 3;
+  for (uint8_t row = 0; row < 3; row++)
+  {
+    int16_t y = row * rowHeight + rowHeight / 2;
+    canvas.setTextFont(2);
+    canvas.setTextDatum(ML_DATUM);
+    canvas.drawString(labels[row], 10, y);
+    canvas.setTextFont(4);
+    canvas.setTextDatum(MR_DATUM);
+    canvas.drawString(values[row], canvas.width() - 10, y);
+  }
+  canvas.setTextDatum(TL_DATUM);
 
-  display.setFreeFont(VALUE_FONT);
-  display.setTextColor(textColorValue(pm100History.lastData), 0x10A3);
-  display.drawString(pm100Value, pm100labelX + 30, 1);
+  compositor.push(0, canvas.height() - 1);
 }
 
 void displayPrintCenterln(const char *text, uint8_t y)
@@ -673,7 +1781,7 @@ void displayConnectInfo(String ssid, String passphrase, uint16_t duration)
   display.setTextDatum(TC_DATUM);
   display.drawString("Connect to WLAN", display.width() / 2, posY);
   posY += display.fontHeight();
-  display.pushImage((display.width() / 2) - (iconWidth / 2), posY, iconWidth, iconHeight, wlanIcon);
+  drawIcon(display, (display.width() / 2) - (iconWidth / 2), posY, wlanIcon);
   posY += iconHeight;
 
   display.setTextFont(2);
@@ -0,0 +1,71 @@
+#pragma once
+
+// The little of the Arduino core the code under test needs, for the host tests.
+
+#include <algorithm>
+#include <chrono>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+inline uint32_t micros()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// time only passes while the code under test waits, so timeouts run out right away
+inline uint32_t &fakeMillis()
+{
+  static uint32_t now = 0;
+  return now;
+}
+
+inline uint32_t millis()
+{
+  return fakeMillis();
+}
+
+inline void delay(uint32_t ms)
+{
+  fakeMillis() += ms;
+}
+
+using std::max;
+using std::min;
+
+inline char *utoa(unsigned value, char *buffer, int base)
+{
+  snprintf(buffer, 12, base == 16 ? "%x" : "%u", value);
+  return buffer;
+}
+
+class String
+{
+public:
+  String(const char *text = "") : text(text) {}
+  String(int value) : text(std::to_string(value)) {}
+  String(unsigned value) : text(std::to_string(value)) {}
+
+  String operator+(const String &other) const { return String((text + other.text).c_str()); }
+  const char *c_str() const { return text.c_str(); }
+  size_t length() const { return text.size(); }
+
+private:
+  std::string text;
+};
+
+// the log output of the code under test is dropped
+class FakeSerial
+{
+public:
+  void begin(uint32_t) {}
+  size_t print(const char *) { return 0; }
+  size_t println(const char * = "") { return 0; }
+  size_t printf(const char *, ...) { return 0; }
+};
+
+inline FakeSerial Serial;
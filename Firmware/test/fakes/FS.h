@@ -0,0 +1,267 @@
+#pragma once
+
+// The file system API of the Arduino core on top of a directory of the host,
+// standing in for LittleFS in the host tests. Power can be cut after a number
+// of changes: that one is torn halfway if it is a write and every later change
+// fails, so a test can check what an interrupted update leaves behind.
+// Reads and opens are counted, they are what a restore costs on flash.
+
+#include <Arduino.h>
+#include <algorithm>
+#include <dirent.h>
+#include <memory>
+#include <stdio.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace fs
+{
+
+enum SeekMode
+{
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+class FS;
+
+class File
+{
+public:
+  File() {}
+
+  operator bool() const { return handle || isDirectory(); }
+  bool isDirectory() const { return directory.get() != nullptr; }
+  const char *name() const { return path.c_str(); }
+
+  size_t write(const uint8_t *buffer, size_t size);
+  size_t write(uint8_t byte) { return write(&byte, 1); }
+  size_t read(uint8_t *buffer, size_t size);
+  int read()
+  {
+    uint8_t byte;
+    return read(&byte, 1) == 1 ? byte : -1;
+  }
+  int available() { return handle ? (int)(size() - position()) : 0; }
+
+  bool seek(uint32_t position, SeekMode mode = SeekSet)
+  {
+    return handle && fseek(handle.get(), position, mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END) == 0;
+  }
+  size_t position() const { return handle ? ftell(handle.get()) : 0; }
+  size_t size() const
+  {
+    struct stat status;
+    return handle && fstat(fileno(handle.get()), &status) == 0 ? status.st_size : 0;
+  }
+  void flush()
+  {
+    if (handle)
+    {
+      fflush(handle.get());
+    }
+  }
+  void close()
+  {
+    handle.reset();
+    directory.reset();
+  }
+
+  File openNextFile();
+
+private:
+  friend class FS;
+
+  FS *fs = nullptr;
+  std::string path;
+  std::shared_ptr<FILE> handle;
+  // the names in a directory and how many were handed out
+  std::shared_ptr<std::vector<std::string>> directory;
+  size_t nextEntry = 0;
+};
+
+class FS
+{
+public:
+  explicit FS(const std::string &root) : root(root) {}
+
+  File open(const char *path, const char *mode = "r")
+  {
+    File file;
+    std::string host = hostPath(path);
+    struct stat status;
+    bool exists = stat(host.c_str(), &status) == 0;
+    if (exists && S_ISDIR(status.st_mode))
+    {
+      DIR *dir = opendir(host.c_str());
+      if (!dir)
+      {
+        return file;
+      }
+      file.directory = std::make_shared<std::vector<std::string>>();
+      while (dirent *entry = readdir(dir))
+      {
+        if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+        {
+          file.directory->push_back(entry->d_name);
+        }
+      }
+      closedir(dir);
+      std::sort(file.directory->begin(), file.directory->end());
+    }
+    else
+    {
+      bool reading = strcmp(mode, "r") == 0;
+      if ((reading && !exists) || (!reading && !change()))
+      {
+        return file;
+      }
+      FILE *handle = fopen(host.c_str(), reading ? "rb" : mode[0] == 'a' ? "ab" : "wb");
+      if (!handle)
+      {
+        return file;
+      }
+      file.handle.reset(handle, fclose);
+      opened++;
+    }
+    file.fs = this;
+    file.path = path;
+    return file;
+  }
+
+  bool exists(const char *path) const
+  {
+    struct stat status;
+    return stat(hostPath(path).c_str(), &status) == 0;
+  }
+  bool remove(const char *path) { return change() && unlink(hostPath(path).c_str()) == 0; }
+  bool rename(const char *from, const char *to) { return change() && ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0; }
+  bool mkdir(const char *path) { return change() && ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+  bool rmdir(const char *path) { return change() && ::rmdir(hostPath(path).c_str()) == 0; }
+
+  std::string hostPath(const char *path) const { return root + path; }
+
+  // removes every file, the test starts on a freshly formatted partition
+  void format() { clear(root); }
+
+  void cutPowerAfter(uint32_t changes)
+  {
+    budget = changes;
+    limited = true;
+    cut = false;
+  }
+  void restorePower()
+  {
+    limited = false;
+    cut = false;
+  }
+  // whether a change was refused since the power was cut
+  bool powerWasCut() const { return cut; }
+
+  uint32_t filesOpened() const { return opened; }
+  uint64_t bytesRead() const { return readBytes; }
+  void resetCounters()
+  {
+    opened = 0;
+    readBytes = 0;
+  }
+
+private:
+  friend class File;
+
+  bool change()
+  {
+    if (!limited)
+    {
+      return true;
+    }
+    if (budget == 0)
+    {
+      cut = true;
+      return false;
+    }
+    budget--;
+    return true;
+  }
+  // the last change before the cut only gets half of its bytes to flash
+  bool tornWrite() const { return limited && budget == 0; }
+
+  void clear(const std::string &dir)
+  {
+    DIR *handle = opendir(dir.c_str());
+    if (!handle)
+    {
+      return;
+    }
+    while (dirent *entry = readdir(handle))
+    {
+      if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+      {
+        continue;
+      }
+      std::string path = dir + "/" + entry->d_name;
+      struct stat status;
+      if (stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode))
+      {
+        clear(path);
+        ::rmdir(path.c_str());
+      }
+      else
+      {
+        unlink(path.c_str());
+      }
+    }
+    closedir(handle);
+  }
+
+  std::string root;
+  bool limited = false;
+  bool cut = false;
+  uint32_t budget = 0;
+  uint32_t opened = 0;
+  uint64_t readBytes = 0;
+};
+
+inline size_t File::write(const uint8_t *buffer, size_t size)
+{
+  if (!handle || !fs->change())
+  {
+    return 0;
+  }
+  size_t written = fwrite(buffer, 1, fs->tornWrite() ? size / 2 : size, handle.get());
+  fflush(handle.get());
+  return written;
+}
+
+inline size_t File::read(uint8_t *buffer, size_t size)
+{
+  if (!handle)
+  {
+    return 0;
+  }
+  size_t count = fread(buffer, 1, size, handle.get());
+  fs->readBytes += count;
+  return count;
+}
+
+inline File File::openNextFile()
+{
+  if (!directory || nextEntry >= directory->size())
+  {
+    return File();
+  }
+  std::string entry = path + (path.back() == '/' ? "" : "/") + (*directory)[nextEntry++];
+  return fs->open(entry.c_str(), "r");
+}
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
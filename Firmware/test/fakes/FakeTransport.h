@@ -0,0 +1,72 @@
+#pragma once
+
+// Replays a recorded byte stream in place of the UART and keeps what the driver
+// sent. Bytes are handed out in chunks of chunkSize, so frames get split across
+// reads like they do when a poll comes in the middle of a transfer.
+
+#include "SerialTransport.h"
+
+class FakeTransport : public SerialTransport
+{
+public:
+  const static size_t txCapacity = 64;
+
+  FakeTransport(const uint8_t *rx, size_t rxLength, size_t chunkSize = 32)
+      : rx(rx), rxLength(rxLength), chunkSize(chunkSize) {}
+
+  void begin(uint32_t baud) override { this->baud = baud; }
+
+  size_t available() override
+  {
+    if (received == rxPosition)
+    {
+      release();
+    }
+    return received - rxPosition;
+  }
+
+  size_t read(uint8_t *buffer, size_t length) override
+  {
+    if (received == rxPosition)
+    {
+      release();
+    }
+    size_t count = received - rxPosition < length ? received - rxPosition : length;
+    for (size_t i = 0; i < count; i++)
+    {
+      buffer[i] = rx[rxPosition++];
+    }
+    counters.bytesRead += count;
+    return count;
+  }
+
+  size_t write(const uint8_t *buffer, size_t length) override
+  {
+    for (size_t i = 0; i < length && txLength < txCapacity; i++)
+    {
+      tx[txLength++] = buffer[i];
+    }
+    counters.bytesWritten += length;
+    return length;
+  }
+
+  uint32_t baudRate() const { return baud; }
+  const uint8_t *sent() const { return tx; }
+  size_t sentLength() const { return txLength; }
+
+private:
+  void release()
+  {
+    size_t left = rxLength - received;
+    received += left < chunkSize ? left : chunkSize;
+  }
+
+  const uint8_t *rx;
+  size_t rxLength;
+  size_t rxPosition = 0;
+  size_t received = 0;
+  size_t chunkSize;
+  uint8_t tx[txCapacity];
+  size_t txLength = 0;
+  uint32_t baud = 0;
+};
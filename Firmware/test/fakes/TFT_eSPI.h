@@ -0,0 +1,314 @@
+#pragma once
+
+// Draws into a pixel array instead of a panel, so the host tests can compare
+// what ended up on screen. Shapes follow the library closely enough for the
+// ±1 pixel geometry of the chart; text is a pattern of the characters inside
+// the same box the library would use. Bus transactions and DMA transfers are
+// recorded, a DMA transfer completes on dmaWait().
+
+#include <Arduino.h>
+#include <vector>
+
+#include "User_Setups/Setup25_TTGO_T_Display.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+#define TFT_RED 0xF800
+#define TFT_GREEN 0x07E0
+#define TFT_YELLOW 0xFFE0
+#define TFT_DARKGREY 0x7BEF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define MC_DATUM 4
+#define MR_DATUM 5
+
+struct GFXfont
+{
+  uint8_t height;
+};
+static const GFXfont Orbitron_Light_24 = {24};
+
+class TFT_eSPI
+{
+public:
+  struct Bus
+  {
+    uint32_t transactions;
+    uint32_t transfers;
+    uint32_t rows;
+    // startWrite() nests like in the library, the bus is released at depth 0
+    int16_t depth;
+    bool dmaPending;
+  };
+
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT) : w(w), h(h) { resize(w, h); }
+  virtual ~TFT_eSPI() {}
+
+  void init() {}
+  void setRotation(uint8_t rotation)
+  {
+    if ((rotation & 1) != (w > h))
+    {
+      resize(h, w);
+    }
+  }
+  int16_t width() const { return w; }
+  int16_t height() const { return h; }
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color)
+  {
+    if (!viewportDatum)
+    {
+      x -= vx;
+      y -= vy;
+    }
+    if (x < 0 || y < 0 || x >= vw || y >= vh)
+    {
+      return;
+    }
+    x += vx;
+    y += vy;
+    if (x < 0 || y < 0 || x >= w || y >= h)
+    {
+      return;
+    }
+    pixels[y * w + x] = color;
+    pixelWrites++;
+  }
+  void fillRect(int32_t x, int32_t y, int32_t rw, int32_t rh, uint32_t color)
+  {
+    for (int32_t row = y; row < y + rh; row++)
+    {
+      for (int32_t column = x; column < x + rw; column++)
+      {
+        drawPixel(column, row, color);
+      }
+    }
+  }
+  void fillScreen(uint32_t color) { fillRect(0, 0, w, h, color); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t length, uint32_t color) { fillRect(x, y, length, 1, color); }
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color)
+  {
+    int32_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+    int32_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+    int32_t error = dx + dy;
+    while (true)
+    {
+      drawPixel(x0, y0, color);
+      if (x0 == x1 && y0 == y1)
+      {
+        return;
+      }
+      if (2 * error >= dy)
+      {
+        error += dy;
+        x0 += sx;
+      }
+      if (2 * error <= dx)
+      {
+        error += dx;
+        y0 += sy;
+      }
+    }
+  }
+  // the algorithm of the library, a radius of 1 gives a plus
+  void fillCircle(int32_t x0, int32_t y0, int32_t r, uint32_t color)
+  {
+    int32_t x = 0, dx = 1, dy = r + r, p = -(r >> 1);
+    drawFastHLine(x0 - r, y0, dy + 1, color);
+    while (x < r)
+    {
+      if (p >= 0)
+      {
+        drawFastHLine(x0 - x, y0 + r, dx, color);
+        drawFastHLine(x0 - x, y0 - r, dx, color);
+        dy -= 2;
+        p -= dy;
+        r--;
+      }
+      dx += 2;
+      p += dx;
+      x++;
+      drawFastHLine(x0 - r, y0 + x, dy + 1, color);
+      drawFastHLine(x0 - r, y0 - x, dy + 1, color);
+    }
+  }
+
+  void setViewport(int32_t x, int32_t y, int32_t vw, int32_t vh, bool datum = true)
+  {
+    vx = x;
+    vy = y;
+    this->vw = vw;
+    this->vh = vh;
+    viewportDatum = datum;
+  }
+  void resetViewport() { setViewport(0, 0, w, h, true); }
+
+  void setTextFont(uint8_t) { font = nullptr; }
+  void setFreeFont(const GFXfont *font) { this->font = font; }
+  void setTextColor(uint16_t foreground, uint16_t background)
+  {
+    textForeground = foreground;
+    textBackground = background;
+  }
+  void setTextDatum(uint8_t datum) { textDatum = datum; }
+  int16_t fontHeight() const { return font ? font->height : 16; }
+  int16_t textWidth(const char *text) const { return strlen(text) * (font ? 14 : 8); }
+  int16_t textWidth(const String &text) const { return textWidth(text.c_str()); }
+  // like the library only the built-in fonts fill their background
+  int16_t drawString(const char *text, int32_t x, int32_t y)
+  {
+    int16_t tw = textWidth(text), th = fontHeight();
+    x -= textDatum % 3 == 1 ? tw / 2 : textDatum % 3 == 2 ? tw : 0;
+    y -= textDatum / 3 == 1 ? th / 2 : 0;
+    if (!font)
+    {
+      fillRect(x, y, tw, th, textBackground);
+    }
+    int16_t charWidth = font ? 14 : 8;
+    for (int16_t i = 0; text[i]; i++)
+    {
+      for (int16_t row = 3; row < th - 3; row++)
+      {
+        for (int16_t column = 1; column < charWidth - 1; column++)
+        {
+          if ((text[i] * 7 + column * 3 + row) % 5 == 0)
+          {
+            drawPixel(x + i * charWidth + column, y + row, textForeground);
+          }
+        }
+      }
+    }
+    return tw;
+  }
+  int16_t drawString(const String &text, int32_t x, int32_t y) { return drawString(text.c_str(), x, y); }
+
+  bool initDMA() { return dmaAvailable; }
+  void startWrite()
+  {
+    if (bus.depth++ == 0)
+    {
+      bus.transactions++;
+    }
+  }
+  void endWrite()
+  {
+    if (bus.depth > 0)
+    {
+      bus.depth--;
+    }
+  }
+  void pushImageDMA(int32_t x, int32_t y, int32_t iw, int32_t ih, uint16_t *image)
+  {
+    dmaWait();
+    pending = {x, y, iw, ih, image};
+    bus.dmaPending = true;
+    bus.transfers++;
+    bus.rows += ih;
+  }
+  // the transfer lands on the panel here, a frame changed before that shows up on it
+  void dmaWait()
+  {
+    if (!bus.dmaPending)
+    {
+      return;
+    }
+    for (int32_t row = 0; row < pending.h; row++)
+    {
+      for (int32_t column = 0; column < pending.w; column++)
+      {
+        pixels[(pending.y + row) * w + pending.x + column] = pending.image[row * pending.w + column];
+      }
+    }
+    bus.dmaPending = false;
+  }
+
+  uint16_t pixel(int32_t x, int32_t y) const { return pixels[y * w + x]; }
+  const std::vector<uint16_t> &screen() const { return pixels; }
+  const Bus &busState() const { return bus; }
+
+  bool dmaAvailable = true;
+  uint32_t pixelWrites = 0;
+
+protected:
+  void resize(int16_t width, int16_t height)
+  {
+    w = width;
+    h = height;
+    pixels.assign(w * h, 0);
+    resetViewport();
+  }
+
+  int16_t w;
+  int16_t h;
+  std::vector<uint16_t> pixels;
+
+private:
+  struct Transfer
+  {
+    int32_t x, y, w, h;
+    const uint16_t *image;
+  };
+
+  int32_t vx = 0, vy = 0, vw = 0, vh = 0;
+  bool viewportDatum = true;
+  const GFXfont *font = nullptr;
+  uint16_t textForeground = TFT_WHITE;
+  uint16_t textBackground = TFT_BLACK;
+  uint8_t textDatum = TL_DATUM;
+  Bus bus = {};
+  Transfer pending = {};
+};
+
+class TFT_eSprite : public TFT_eSPI
+{
+public:
+  TFT_eSprite(TFT_eSPI *) : TFT_eSPI(0, 0) {}
+
+  void setColorDepth(int8_t) {}
+  void *createSprite(int16_t width, int16_t height)
+  {
+    resize(width, height);
+    return pixels.data();
+  }
+  void deleteSprite() { resize(0, 0); }
+
+  void setScrollRect(int32_t x, int32_t y, int32_t width, int32_t height, uint16_t color)
+  {
+    sx = x;
+    sy = y;
+    sw = width;
+    sh = height;
+    scrollColor = color;
+  }
+  // moves the pixels of the scroll rect, what is uncovered gets the scroll color
+  void scroll(int16_t dx, int16_t dy = 0)
+  {
+    std::vector<uint16_t> moved(sw * sh, scrollColor);
+    for (int32_t row = 0; row < sh; row++)
+    {
+      for (int32_t column = 0; column < sw; column++)
+      {
+        int32_t fromColumn = column - dx, fromRow = row - dy;
+        if (fromColumn >= 0 && fromColumn < sw && fromRow >= 0 && fromRow < sh)
+        {
+          moved[row * sw + column] = pixels[(sy + fromRow) * w + sx + fromColumn];
+        }
+      }
+    }
+    for (int32_t row = 0; row < sh; row++)
+    {
+      for (int32_t column = 0; column < sw; column++)
+      {
+        pixels[(sy + row) * w + sx + column] = moved[row * sw + column];
+      }
+    }
+  }
+
+private:
+  int32_t sx = 0, sy = 0, sw = 0, sh = 0;
+  uint16_t scrollColor = TFT_BLACK;
+};
@@ -0,0 +1,5 @@
+#pragma once
+
+// the panel of the TTGO T-Display in portrait orientation
+#define TFT_WIDTH 135
+#define TFT_HEIGHT 240
@@ -0,0 +1,18 @@
+#pragma once
+
+// A thin FreeRTOS shim for the host tests: tasks are threads, queues are
+// guarded deques, a tick is a millisecond of real time. Priorities and cores
+// are ignored, so the tests see at least as much interleaving as the chip.
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS pdTRUE
+#define portMAX_DELAY 0xFFFFFFFF
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
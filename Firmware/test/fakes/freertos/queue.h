@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string.h>
+#include <vector>
+
+#include "FreeRTOS.h"
+
+struct FakeQueue
+{
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<std::vector<uint8_t>> items;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+};
+
+typedef FakeQueue *QueueHandle_t;
+
+// waits until ready() holds or the ticks ran out, the queue is locked on return
+template <typename Ready>
+inline bool fakeQueueWait(FakeQueue *queue, std::unique_lock<std::mutex> &lock, TickType_t ticks, Ready ready)
+{
+  if (ticks == portMAX_DELAY)
+  {
+    queue->changed.wait(lock, ready);
+    return true;
+  }
+  return queue->changed.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+  FakeQueue *queue = new FakeQueue();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue)
+{
+  delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks)
+{
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!fakeQueueWait(queue, lock, ticks, [queue] { return queue->items.size() < queue->length; }))
+  {
+    return pdFALSE;
+  }
+  const uint8_t *bytes = (const uint8_t *)item;
+  queue->items.emplace_back(bytes, bytes + queue->itemSize);
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks)
+{
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!fakeQueueWait(queue, lock, ticks, [queue] { return !queue->items.empty(); }))
+  {
+    return pdFALSE;
+  }
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  queue->items.pop_front();
+  queue->changed.notify_all();
+  return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->items.size();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <list>
+#include <thread>
+
+#include "FreeRTOS.h"
+
+typedef std::thread *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+inline std::list<std::thread> &fakeTasks()
+{
+  static std::list<std::thread> tasks;
+  return tasks;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *, uint32_t, void *parameter,
+                                          UBaseType_t, TaskHandle_t *handle, BaseType_t)
+{
+  fakeTasks().emplace_back(function, parameter);
+  if (handle)
+  {
+    *handle = &fakeTasks().back();
+  }
+  return pdPASS;
+}
+
+// unlike on the chip a task may return, the test waits for all of them here
+inline void fakeJoinTasks()
+{
+  for (std::thread &task : fakeTasks())
+  {
+    task.join();
+  }
+  fakeTasks().clear();
+}
+
+inline void vTaskDelay(TickType_t ticks)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+inline TickType_t xTaskGetTickCount()
+{
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
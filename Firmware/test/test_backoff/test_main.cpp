@@ -0,0 +1,67 @@
+#include <unity.h>
+
+#include "Backoff.h"
+
+void test_ceiling_doubles_up_to_the_cap()
+{
+  Backoff backoff(5000, 120000);
+  // the largest random number gives the ceiling itself
+  const uint32_t ceilings[] = {5000, 10000, 20000, 40000, 80000, 120000, 120000};
+  for (uint32_t ceiling : ceilings)
+  {
+    TEST_ASSERT_EQUAL_UINT32(ceiling, backoff.next(ceiling / 2));
+  }
+  TEST_ASSERT_EQUAL_UINT8(7, backoff.attempts());
+}
+
+void test_delay_stays_between_half_and_the_ceiling()
+{
+  Backoff backoff(1000, 60000);
+  uint32_t random = 12345;
+  for (uint8_t attempt = 0; attempt < 20; attempt++)
+  {
+    uint32_t ceiling = attempt < 6 ? 1000u << attempt : 60000;
+    for (uint8_t i = 0; i < 50; i++)
+    {
+      Backoff probe = backoff;
+      random = random * 1103515245u + 12345u;
+      uint32_t delay = probe.next(random);
+      TEST_ASSERT_GREATER_OR_EQUAL_UINT32(ceiling / 2, delay);
+      TEST_ASSERT_LESS_OR_EQUAL_UINT32(ceiling, delay);
+    }
+    backoff.next(0);
+  }
+}
+
+void test_reset_starts_over()
+{
+  Backoff backoff(5000, 120000);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    backoff.next(0);
+  }
+  backoff.reset();
+  TEST_ASSERT_EQUAL_UINT8(0, backoff.attempts());
+  TEST_ASSERT_EQUAL_UINT32(2500, backoff.next(0));
+}
+
+void test_attempts_saturate()
+{
+  Backoff backoff(5000, 120000);
+  for (uint16_t i = 0; i < 300; i++)
+  {
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(120000, backoff.next(UINT32_MAX));
+  }
+  TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, backoff.attempts());
+  TEST_ASSERT_EQUAL_UINT32(60000, backoff.next(0));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_ceiling_doubles_up_to_the_cap);
+  RUN_TEST(test_delay_stays_between_half_and_the_ceiling);
+  RUN_TEST(test_reset_starts_over);
+  RUN_TEST(test_attempts_saturate);
+  return UNITY_END();
+}
@@ -0,0 +1,144 @@
+#include <unity.h>
+
+#include "Button.h"
+
+// a change of the pin level at a time, as the edge interrupt sees it
+struct Edge
+{
+  uint32_t time;
+  bool pressed;
+};
+
+struct Gesture
+{
+  uint32_t time;
+  ButtonGesture gesture;
+};
+
+static Gesture gestures[8];
+static uint8_t gestureCount;
+
+static void record(ButtonGesture gesture, uint32_t now)
+{
+  if (gesture != ButtonGesture::none && gestureCount < 8)
+  {
+    gestures[gestureCount++] = {now, gesture};
+  }
+}
+
+// feeds every edge and every check nextCheck() asks for, like the scheduler task does
+static void play(DebouncedButton &button, const Edge *edges, uint8_t edgeCount, uint32_t until)
+{
+  gestureCount = 0;
+  uint32_t now = edges[0].time;
+  bool pressed = false;
+  for (uint8_t i = 0; i <= edgeCount; i++)
+  {
+    uint32_t next = i < edgeCount ? edges[i].time : until;
+    for (uint32_t wait = button.nextCheck(now); wait != UINT32_MAX && wait <= next - now; wait = button.nextCheck(now))
+    {
+      now += wait;
+      record(button.update(pressed, now), now);
+    }
+    now = next;
+    if (i < edgeCount)
+    {
+      pressed = edges[i].pressed;
+      record(button.update(pressed, now), now);
+    }
+  }
+}
+
+void test_short_press()
+{
+  DebouncedButton button;
+  const Edge edges[] = {{100, true}, {300, false}};
+  play(button, edges, 2, 5000);
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::shortPress);
+  // reported once the release settled
+  TEST_ASSERT_EQUAL_UINT32(300 + DebouncedButton::debounceTime, gestures[0].time);
+}
+
+void test_bounce_while_settling()
+{
+  DebouncedButton button;
+  // the contact chatters on the way down and on the way up
+  const Edge edges[] = {{100, true}, {104, false}, {109, true}, {112, false}, {115, true},
+                        {400, false}, {403, true}, {407, false}};
+  play(button, edges, 8, 5000);
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::shortPress);
+  TEST_ASSERT_EQUAL_UINT32(407 + DebouncedButton::debounceTime, gestures[0].time);
+}
+
+void test_glitch_is_no_press()
+{
+  DebouncedButton button;
+  const Edge edges[] = {{100, true}, {110, false}, {120, true}, {125, false}};
+  play(button, edges, 4, 5000);
+  TEST_ASSERT_EQUAL_UINT8(0, gestureCount);
+}
+
+void test_long_press_while_held()
+{
+  DebouncedButton button;
+  const Edge edges[] = {{100, true}, {2500, false}};
+  play(button, edges, 1, 2400);
+  // reported while the button is still down
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::longPress);
+  TEST_ASSERT_EQUAL_UINT32(100 + DebouncedButton::longPressTime, gestures[0].time);
+}
+
+void test_release_after_long_press_is_no_short_press()
+{
+  DebouncedButton button;
+  const Edge edges[] = {{100, true}, {2500, false}, {2503, true}, {2506, false}};
+  play(button, edges, 4, 10000);
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::longPress);
+
+  // the next press is a new one
+  const Edge again[] = {{12000, true}, {12200, false}};
+  play(button, again, 2, 15000);
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::shortPress);
+}
+
+void test_next_check()
+{
+  DebouncedButton button;
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, button.nextCheck(0));
+  button.update(true, 100);
+  TEST_ASSERT_EQUAL_UINT32(DebouncedButton::debounceTime, button.nextCheck(100));
+  TEST_ASSERT_EQUAL_UINT32(0, button.nextCheck(200));
+  button.update(true, 130);
+  TEST_ASSERT_EQUAL_UINT32(DebouncedButton::longPressTime - 30, button.nextCheck(130));
+  button.update(true, 2100);
+  // held after the long press, nothing left to time
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, button.nextCheck(2100));
+}
+
+void test_millis_wraparound()
+{
+  DebouncedButton button;
+  const Edge edges[] = {{UINT32_MAX - 1000, true}, {1500, false}};
+  play(button, edges, 2, 3000);
+  TEST_ASSERT_EQUAL_UINT8(1, gestureCount);
+  TEST_ASSERT_TRUE(gestures[0].gesture == ButtonGesture::longPress);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 1000 + DebouncedButton::longPressTime, gestures[0].time);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_short_press);
+  RUN_TEST(test_bounce_while_settling);
+  RUN_TEST(test_glitch_is_no_press);
+  RUN_TEST(test_long_press_while_held);
+  RUN_TEST(test_release_after_long_press_is_no_short_press);
+  RUN_TEST(test_next_check);
+  RUN_TEST(test_millis_wraparound);
+  return UNITY_END();
+}
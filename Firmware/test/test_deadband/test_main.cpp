@@ -0,0 +1,86 @@
+#include <unity.h>
+
+#include "Deadband.h"
+
+void test_first_value_is_published()
+{
+  Deadband band({20, 50, 300000});
+  TEST_ASSERT_TRUE(band.shouldPublish(800, 0));
+}
+
+void test_absolute_band()
+{
+  Deadband band({20, 0, 300000});
+  band.published(800, 0);
+  TEST_ASSERT_FALSE(band.shouldPublish(820, 1000));
+  TEST_ASSERT_FALSE(band.shouldPublish(780, 1000));
+  TEST_ASSERT_TRUE(band.shouldPublish(821, 1000));
+  TEST_ASSERT_TRUE(band.shouldPublish(779, 1000));
+}
+
+void test_both_bands_must_be_left()
+{
+  // 5 % of 800 is 40, more than the absolute band
+  Deadband band({20, 50, 300000});
+  band.published(800, 0);
+  TEST_ASSERT_FALSE(band.shouldPublish(830, 1000));
+  TEST_ASSERT_FALSE(band.shouldPublish(840, 1000));
+  TEST_ASSERT_TRUE(band.shouldPublish(841, 1000));
+
+  // near zero the absolute band is the wider one
+  band.published(-10, 2000);
+  TEST_ASSERT_FALSE(band.shouldPublish(10, 3000));
+  TEST_ASSERT_TRUE(band.shouldPublish(11, 3000));
+}
+
+void test_bands_off_publish_every_change()
+{
+  Deadband band({0, 0, 300000});
+  band.published(5, 0);
+  TEST_ASSERT_FALSE(band.shouldPublish(5, 1000));
+  TEST_ASSERT_TRUE(band.shouldPublish(6, 1000));
+}
+
+void test_published_after_the_silence()
+{
+  Deadband band({20, 50, 300000});
+  band.published(800, 4294000000u);
+  TEST_ASSERT_FALSE(band.shouldPublish(800, 4294000000u + 299999));
+  // the millisecond counter wraps in between
+  TEST_ASSERT_TRUE(band.shouldPublish(800, 4294000000u + 300000));
+}
+
+void test_window_of_held_back_values()
+{
+  Deadband band({20, 0, 300000});
+  band.published(800, 0);
+  band.suppress(810);
+  band.suppress(795);
+  band.suppress(815);
+  TEST_ASSERT_EQUAL_UINT16(3, band.window().count);
+  TEST_ASSERT_EQUAL_INT32(795, band.window().min);
+  TEST_ASSERT_EQUAL_INT32(815, band.window().max);
+  TEST_ASSERT_EQUAL_INT64(2420, band.window().sum);
+
+  band.published(830, 4000);
+  TEST_ASSERT_EQUAL_UINT16(0, band.window().count);
+  // a window of negative values starts at its first value, not at 0
+  band.suppress(-3);
+  TEST_ASSERT_EQUAL_INT32(-3, band.window().min);
+  TEST_ASSERT_EQUAL_INT32(-3, band.window().max);
+
+  TEST_ASSERT_EQUAL_UINT32(2, band.stats().sent);
+  TEST_ASSERT_EQUAL_UINT32(4, band.stats().suppressed);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_value_is_published);
+  RUN_TEST(test_absolute_band);
+  RUN_TEST(test_both_bands_must_be_left);
+  RUN_TEST(test_bands_off_publish_every_change);
+  RUN_TEST(test_published_after_the_silence);
+  RUN_TEST(test_window_of_held_back_values);
+  return UNITY_END();
+}
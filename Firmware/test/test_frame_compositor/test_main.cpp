@@ -0,0 +1,164 @@
+#include <unity.h>
+
+#include "FrameCompositor.h"
+#include "ParticleChart.h"
+
+static bool sameRows(const TFT_eSPI &panel, TFT_eSPI &frame, int16_t top, int16_t bottom)
+{
+  for (int16_t y = top; y <= bottom; y++)
+  {
+    for (int16_t x = 0; x < panel.width(); x++)
+    {
+      if (panel.pixel(x, y) != frame.pixel(x, y))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void test_first_push_sends_the_whole_frame()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  TEST_ASSERT_TRUE(compositor.begin());
+  TEST_ASSERT_TRUE(compositor.enabled());
+  TFT_eSPI &canvas = compositor.canvas();
+  TEST_ASSERT_TRUE(&canvas == compositor.frameSprite());
+  TEST_ASSERT_EQUAL(display.width(), canvas.width());
+  TEST_ASSERT_EQUAL(display.height(), canvas.height());
+
+  canvas.fillRect(10, 10, 20, 20, TFT_RED);
+  compositor.push(12, 14);
+  TEST_ASSERT_EQUAL(1, display.busState().transfers);
+  TEST_ASSERT_EQUAL(display.height(), display.busState().rows);
+  TEST_ASSERT_TRUE(sameRows(display, canvas, 0, display.height() - 1));
+}
+
+void test_push_sends_only_the_dirty_rows()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  compositor.begin();
+  TFT_eSPI &canvas = compositor.canvas();
+  compositor.push(0, 0);
+
+  canvas.fillRect(0, 40, 50, 10, TFT_GREEN);
+  canvas.fillRect(0, 100, 50, 10, TFT_GREEN);
+  compositor.push(40, 49);
+  TEST_ASSERT_EQUAL(2, compositor.stats().frames);
+  TEST_ASSERT_EQUAL(display.height() + 10, compositor.stats().rowsPushed);
+  TEST_ASSERT_TRUE(sameRows(display, canvas, 40, 49));
+  TEST_ASSERT_FALSE(sameRows(display, canvas, 100, 109));
+}
+
+// the transaction never outlives the push, another task can use the bus right after it
+void test_push_releases_the_bus_before_returning()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  compositor.begin();
+  compositor.canvas().fillScreen(TFT_WHITE);
+  compositor.push(0, display.height() - 1);
+  TEST_ASSERT_EQUAL(0, display.busState().depth);
+  TEST_ASSERT_FALSE(display.busState().dmaPending);
+  TEST_ASSERT_TRUE(sameRows(display, compositor.canvas(), 0, display.height() - 1));
+
+  // drawing into the frame right away can't change what was sent
+  compositor.canvas().fillScreen(TFT_BLACK);
+  TEST_ASSERT_EQUAL(TFT_WHITE, display.pixel(5, 5));
+  TEST_ASSERT_EQUAL(1, display.busState().transactions);
+}
+
+void test_push_clamps_rows()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  compositor.begin();
+  compositor.push(0, 0);
+
+  compositor.push(-5, 3);
+  TEST_ASSERT_EQUAL(display.height() + 4, display.busState().rows);
+  compositor.push(display.height() - 2, display.height() + 7);
+  TEST_ASSERT_EQUAL(display.height() + 6, display.busState().rows);
+
+  // nothing changed, nothing is sent and the bus isn't touched
+  compositor.push(0, -1);
+  TEST_ASSERT_EQUAL(3, display.busState().transfers);
+  TEST_ASSERT_EQUAL(3, display.busState().transactions);
+}
+
+void test_invalidated_panel_gets_the_whole_frame()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  compositor.begin();
+  compositor.canvas().fillScreen(TFT_WHITE);
+  compositor.push(0, display.height() - 1);
+
+  display.fillRect(0, 60, display.width(), 10, TFT_RED);
+  compositor.invalidatePanel();
+  compositor.push(0, 5);
+  TEST_ASSERT_TRUE(sameRows(display, compositor.canvas(), 0, display.height() - 1));
+}
+
+void test_without_dma_draws_on_the_panel()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  display.dmaAvailable = false;
+  FrameCompositor compositor(display);
+  TEST_ASSERT_FALSE(compositor.begin());
+  TEST_ASSERT_FALSE(compositor.enabled());
+  TEST_ASSERT_TRUE(&compositor.canvas() == &display);
+  TEST_ASSERT_TRUE(compositor.frameSprite() == nullptr);
+  compositor.push(0, display.height() - 1);
+  TEST_ASSERT_EQUAL(0, display.busState().transfers);
+}
+
+// the chart page as the display task draws it: render into the frame, push the dirty rows
+void test_chart_frames_reach_the_panel()
+{
+  TFT_eSPI display;
+  display.setRotation(1);
+  FrameCompositor compositor(display);
+  compositor.begin();
+  ParticleHistory pm010, pm025, pm100;
+  ParticleChart chart(compositor.canvas(), pm010, pm025, pm100);
+  chart.setCanvas(compositor.canvas(), compositor.frameSprite());
+
+  uint32_t rowsBefore = 0;
+  for (uint32_t minute = 0; minute < 120; minute++)
+  {
+    pm010.addMeasurement(1 + minute % 4);
+    pm025.addMeasurement(2 + minute % 3);
+    pm100.addMeasurement(3 + minute % 5);
+    chart.render();
+    int16_t top, bottom;
+    chart.dirtyRows(top, bottom);
+    rowsBefore = compositor.stats().rowsPushed;
+    compositor.push(top, bottom);
+    TEST_ASSERT_TRUE(sameRows(display, compositor.canvas(), 0, display.height() - 1));
+  }
+  // a minute with unchanged bounds and header values only sends the plot rows
+  TEST_ASSERT_LESS_THAN(uint32_t(display.height()), compositor.stats().rowsPushed - rowsBefore);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_push_sends_the_whole_frame);
+  RUN_TEST(test_push_sends_only_the_dirty_rows);
+  RUN_TEST(test_push_releases_the_bus_before_returning);
+  RUN_TEST(test_push_clamps_rows);
+  RUN_TEST(test_invalidated_panel_gets_the_whole_frame);
+  RUN_TEST(test_without_dma_draws_on_the_panel);
+  RUN_TEST(test_chart_frames_reach_the_panel);
+  return UNITY_END();
+}
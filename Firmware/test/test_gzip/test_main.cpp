@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include <zlib.h>
+
+#include "Gzip.h"
+
+static GzipCompressor gzip;
+static uint8_t input[GzipCompressor::maxInput + 1];
+static uint8_t compressed[GzipCompressor::maxInput + GzipCompressor::maxInput / 4];
+static uint8_t restored[GzipCompressor::maxInput + 1];
+
+// gunzips with zlib, -1 if it doesn't take the member
+static long gunzip(const uint8_t *data, size_t length)
+{
+  z_stream stream = {};
+  // 16 + the largest window: gzip framing and every distance deflate allows
+  if (inflateInit2(&stream, 16 + 15) != Z_OK)
+  {
+    return -1;
+  }
+  stream.next_in = (Bytef *)data;
+  stream.avail_in = length;
+  stream.next_out = restored;
+  stream.avail_out = sizeof(restored);
+  int result = inflate(&stream, Z_FINISH);
+  long size = stream.total_out;
+  bool trailing = stream.avail_in > 0;
+  inflateEnd(&stream);
+  return result == Z_STREAM_END && !trailing ? size : -1;
+}
+
+// compresses length bytes of input and checks they come back unchanged, returns the compressed size
+static size_t roundTrip(size_t length)
+{
+  size_t size = gzip.compress(input, length, compressed, sizeof(compressed));
+  TEST_ASSERT_GREATER_THAN_UINT32(0, size);
+  TEST_ASSERT_EQUAL(length, gunzip(compressed, size));
+  TEST_ASSERT_EQUAL(0, memcmp(input, restored, length));
+  return size;
+}
+
+static void fillRandom(uint8_t *data, size_t length, unsigned seed)
+{
+  srand(seed);
+  for (size_t i = 0; i < length; i++)
+  {
+    data[i] = rand();
+  }
+}
+
+void test_empty_input()
+{
+  size_t size = roundTrip(0);
+  // header, an empty fixed block and the trailer
+  TEST_ASSERT_EQUAL_UINT32(20, size);
+}
+
+void test_line_protocol()
+{
+  size_t length = 0;
+  for (uint16_t i = 0; i < 200; i++)
+  {
+    length += snprintf((char *)input + length, sizeof(input) - length,
+                       "co2,room=kitchen value=%u %llu000000\npm25,room=kitchen value=%u %llu000000\n",
+                       600 + i % 37, 1700000000000ULL + i * 60000, 5 + i % 11, 1700000000000ULL + i * 60000);
+  }
+  size_t size = roundTrip(length);
+  TEST_ASSERT_LESS_THAN_UINT32(length / 3, size);
+}
+
+void test_runs_around_the_longest_match()
+{
+  // a run is a literal and matches at distance 1, 258 is the longest one deflate has
+  for (size_t run = 1; run <= 3 * 258 + 4; run++)
+  {
+    memset(input, 'a', run);
+    roundTrip(run);
+  }
+
+  // a match of exactly 258 bytes ends right where the input ends
+  fillRandom(input, 258, 1);
+  memcpy(input + 258, input, 258);
+  size_t size = roundTrip(2 * 258);
+  TEST_ASSERT_LESS_THAN_UINT32(258 + 258 / 2, size);
+}
+
+void test_farthest_distance()
+{
+  // the same block 32768 bytes apart, the farthest a match can reach back
+  const size_t block = 258;
+  memset(input, 'a', sizeof(input));
+  fillRandom(input, block, 2);
+  memcpy(input + 32768, input, block);
+  size_t reached = roundTrip(32768 + block);
+
+  // one byte further it has to go out as literals
+  memset(input, 'a', sizeof(input));
+  fillRandom(input, block, 2);
+  memcpy(input + 32769, input, block);
+  size_t literals = roundTrip(32769 + block);
+  TEST_ASSERT_GREATER_THAN_UINT32(reached + block / 2, literals);
+}
+
+void test_incompressible_data()
+{
+  const size_t lengths[] = {1, 2, 3, 4, 1000, 20000, GzipCompressor::maxInput};
+  for (size_t length : lengths)
+  {
+    fillRandom(input, length, length);
+    size_t size = roundTrip(length);
+    // literals above 143 take 9 bits
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(length * 9 / 8 + 20 + 2, size);
+  }
+}
+
+void test_limits()
+{
+  memset(input, 'x', 1000);
+  // the output doesn't fit
+  TEST_ASSERT_EQUAL_UINT32(0, gzip.compress(input, 1000, compressed, 15));
+  // the input is too long
+  TEST_ASSERT_EQUAL_UINT32(0, gzip.compress(input, GzipCompressor::maxInput + 1, compressed, sizeof(compressed)));
+  // and the compressor is fine afterwards
+  roundTrip(1000);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_input);
+  RUN_TEST(test_line_protocol);
+  RUN_TEST(test_runs_around_the_longest_match);
+  RUN_TEST(test_farthest_distance);
+  RUN_TEST(test_incompressible_data);
+  RUN_TEST(test_limits);
+  return UNITY_END();
+}
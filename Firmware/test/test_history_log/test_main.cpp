@@ -0,0 +1,263 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include "HistoryLog.h"
+
+// an entry is the record between its sequence number and its checksum
+const static uint16_t entrySize = 2 * sizeof(uint32_t) + sizeof(HistoryRecord);
+const static uint16_t perSegment = HistoryLog::segmentSize / entrySize;
+// one record more and the log is compacted
+const static uint16_t fullLog = HistoryLog::maxSegments * perSegment;
+
+// stands in for the histories: the records are numbered 1, 2, ... in their co2
+// field, so every gap, repeat or reordering shows up
+struct Totals
+{
+  uint32_t records;
+  uint32_t sum;
+  uint16_t last;
+  uint16_t outOfOrder;
+};
+
+static Totals totals;
+static HistoryRegion regions[] = {{&totals, sizeof(totals)}};
+static HistoryLog *history = nullptr;
+
+static FS &flash()
+{
+  static char root[] = "/tmp/test_history_log_XXXXXX";
+  static FS fs(mkdtemp(root));
+  return fs;
+}
+
+static void count(const HistoryRecord &record)
+{
+  if (record.co2 != totals.last + 1)
+  {
+    totals.outOfOrder++;
+  }
+  totals.last = record.co2;
+  totals.records++;
+  totals.sum += record.co2;
+}
+
+static void add(uint16_t records)
+{
+  for (uint16_t i = 0; i < records; i++)
+  {
+    HistoryRecord record = {uint16_t(totals.last + 1), 1, 2, 3, 0.5f};
+    count(record);
+    history->append(record);
+  }
+}
+
+// what a restart does: the RAM is gone, the log is read back
+static bool reboot()
+{
+  delete history;
+  history = new HistoryLog(flash(), regions, 1);
+  totals = {};
+  return history->restore(count);
+}
+
+static void startOver()
+{
+  flash().restorePower();
+  flash().format();
+  totals = {};
+}
+
+static void damage(const char *path, long offset)
+{
+  FILE *file = fopen(flash().hostPath(path).c_str(), "r+b");
+  fseek(file, offset, SEEK_SET);
+  int byte = fgetc(file);
+  fseek(file, offset, SEEK_SET);
+  fputc(byte ^ 0x40, file);
+  fclose(file);
+}
+
+void test_restores_in_order()
+{
+  startOver();
+  TEST_ASSERT_FALSE(reboot());
+
+  add(25);
+  history->flush();
+  TEST_ASSERT_TRUE(reboot());
+  TEST_ASSERT_EQUAL_UINT32(25, history->restoredRecords());
+  TEST_ASSERT_EQUAL_UINT32(25, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+}
+
+void test_torn_last_record()
+{
+  startOver();
+  reboot();
+  add(25);
+  history->flush();
+
+  // power went out in the middle of the last record
+  TEST_ASSERT_EQUAL(0, truncate(flash().hostPath("/history/0.log").c_str(), 25 * entrySize - 7));
+  TEST_ASSERT_TRUE(reboot());
+  TEST_ASSERT_EQUAL_UINT32(24, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+
+  // new records go behind the torn tail and are numbered on from the last good one
+  add(3);
+  history->flush();
+  reboot();
+  TEST_ASSERT_EQUAL_UINT32(27, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(27, totals.last);
+  TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+}
+
+void test_damaged_record_in_the_middle()
+{
+  startOver();
+  reboot();
+  add(perSegment + 10);
+  history->flush();
+
+  damage("/history/0.log", 100 * entrySize + 5);
+  TEST_ASSERT_TRUE(reboot());
+  // the rest of the damaged segment is skipped, the next one still counts
+  TEST_ASSERT_EQUAL_UINT32(100 + 10, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(perSegment + 10, totals.last);
+  TEST_ASSERT_EQUAL_UINT16(1, totals.outOfOrder);
+}
+
+void test_compacts_after_the_last_segment()
+{
+  startOver();
+  reboot();
+  add(fullLog);
+  TEST_ASSERT_TRUE(flash().exists("/history/7.log"));
+  TEST_ASSERT_FALSE(flash().exists("/history/snapshot.bin"));
+
+  add(10);
+  TEST_ASSERT_TRUE(flash().exists("/history/snapshot.bin"));
+  TEST_ASSERT_FALSE(flash().exists("/history/snapshot.tmp"));
+  for (uint8_t segment = 0; segment <= HistoryLog::maxSegments; segment++)
+  {
+    char path[32];
+    snprintf(path, sizeof(path), "/history/%u.log", segment);
+    TEST_ASSERT_FALSE(flash().exists(path));
+  }
+
+  TEST_ASSERT_TRUE(reboot());
+  TEST_ASSERT_EQUAL_UINT32(0, history->restoredRecords());
+  TEST_ASSERT_EQUAL_UINT32(fullLog + 10, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(fullLog + 10, totals.last);
+
+  add(5);
+  history->flush();
+  reboot();
+  TEST_ASSERT_EQUAL_UINT32(5, history->restoredRecords());
+  TEST_ASSERT_EQUAL_UINT32(fullLog + 15, totals.records);
+  TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+}
+
+void test_interrupted_compaction()
+{
+  // cuts the power after every step of the flush that compacts: the segment
+  // write, the snapshot written to its temporary file, the rename and the removals
+  uint32_t cuts = 0;
+  for (bool interrupted = true; interrupted; cuts++)
+  {
+    startOver();
+    reboot();
+    add(fullLog);
+
+    flash().cutPowerAfter(cuts);
+    add(10);
+    interrupted = flash().powerWasCut();
+    flash().restorePower();
+
+    TEST_ASSERT_TRUE(reboot());
+    // the records of the last flush may be lost, but nothing before them and never half of the state
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(fullLog, totals.records);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(fullLog + 10, totals.records);
+    TEST_ASSERT_EQUAL_UINT16(totals.records, totals.last);
+    TEST_ASSERT_EQUAL_UINT32(totals.records * (totals.records + 1) / 2, totals.sum);
+    TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+    if (!interrupted)
+    {
+      TEST_ASSERT_EQUAL_UINT32(fullLog + 10, totals.records);
+    }
+
+    // and the log goes on from there
+    uint32_t restored = totals.records;
+    add(10);
+    history->flush();
+    reboot();
+    TEST_ASSERT_EQUAL_UINT32(restored + 10, totals.records);
+    TEST_ASSERT_EQUAL_UINT16(0, totals.outOfOrder);
+  }
+  // open, write, snapshot open and writes, rename and nine removals
+  TEST_ASSERT_GREATER_THAN_UINT32(15, cuts);
+}
+
+void test_snapshot_of_another_layout()
+{
+  startOver();
+  reboot();
+  add(fullLog + 10);
+
+  // a firmware whose histories are larger
+  static uint8_t wider[sizeof(Totals) + 4];
+  HistoryRegion widerRegions[] = {{wider, sizeof(wider)}};
+  HistoryLog other(flash(), widerRegions, 1);
+  TEST_ASSERT_FALSE(other.restore(count));
+  for (uint8_t byte : wider)
+  {
+    TEST_ASSERT_EQUAL_UINT8(0, byte);
+  }
+
+  // a snapshot with a broken checksum leaves an empty history, not a wrong one
+  damage("/history/snapshot.bin", flash().open("/history/snapshot.bin").size() - 2);
+  TEST_ASSERT_FALSE(reboot());
+  TEST_ASSERT_EQUAL_UINT32(0, totals.records);
+  TEST_ASSERT_EQUAL_UINT32(0, totals.sum);
+}
+
+void test_restore_of_a_full_log()
+{
+  startOver();
+  reboot();
+  // a snapshot and every segment up to the next compaction
+  add(fullLog + 10);
+  add(fullLog - 10);
+  history->flush();
+  TEST_ASSERT_FALSE(flash().exists("/history/8.log"));
+  TEST_ASSERT_TRUE(flash().exists("/history/16.log"));
+
+  flash().resetCounters();
+  uint32_t start = micros();
+  TEST_ASSERT_TRUE(reboot());
+  uint32_t duration = micros() - start;
+
+  TEST_ASSERT_EQUAL_UINT32(2 * fullLog, totals.records);
+  TEST_ASSERT_EQUAL_UINT32(fullLog - 10, history->restoredRecords());
+  // the snapshot and each segment are read once
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(sizeof(Totals) + 64 + HistoryLog::maxSegments * HistoryLog::segmentSize,
+                                   (uint32_t)flash().bytesRead());
+  printf("restored %u records, %u bytes from %u opened files in %u us on the host\n", (unsigned)totals.records,
+         (unsigned)flash().bytesRead(), (unsigned)flash().filesOpened(), (unsigned)duration);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_restores_in_order);
+  RUN_TEST(test_torn_last_record);
+  RUN_TEST(test_damaged_record_in_the_middle);
+  RUN_TEST(test_compacts_after_the_last_segment);
+  RUN_TEST(test_interrupted_compaction);
+  RUN_TEST(test_snapshot_of_another_layout);
+  RUN_TEST(test_restore_of_a_full_log);
+  flash().format();
+  rmdir(flash().hostPath("").c_str());
+  return UNITY_END();
+}
@@ -0,0 +1,155 @@
+#include <string.h>
+#include <unity.h>
+
+#include "HistoryStream.h"
+
+typedef TieredHistory<uint16_t, 5, 3, 2, 2> SmallHistory;
+
+static char document[2048];
+
+// reads the whole stream in chunks of at most chunk bytes
+static const char *readAll(HistoryStream &stream, size_t chunk)
+{
+  size_t length = 0;
+  while (size_t filled = stream.read((uint8_t *)document + length, chunk))
+  {
+    length += filled;
+  }
+  document[length] = '\0';
+  return document;
+}
+
+static void addMinutes(SmallHistory &history, uint16_t count)
+{
+  // minute i holds 10 * (i + 1)
+  for (uint16_t i = 0; i < count; i++)
+  {
+    history.addMeasurement(10 * (i + 1));
+  }
+}
+
+void test_csv_rows_go_from_oldest_to_newest()
+{
+  SmallHistory history;
+  addMinutes(history, 3);
+  HistorySourceOf<SmallHistory> source(history);
+  HistoryStream stream(source, "co2", HistoryTier::minute, 0, 10, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n"
+                           "880,10,10,10.00,1\n"
+                           "940,20,20,20.00,1\n"
+                           "1000,30,30,30.00,1\n",
+                           readAll(stream, 256));
+  TEST_ASSERT_EQUAL_UINT16(3, stream.rowsWritten());
+  uint8_t byte;
+  TEST_ASSERT_EQUAL(0, stream.read(&byte, 1));
+}
+
+void test_json_document()
+{
+  SmallHistory history;
+  addMinutes(history, 2);
+  HistorySourceOf<SmallHistory> source(history);
+  HistoryStream stream(source, "co2", HistoryTier::minute, 0, 10, HistoryFormat::json, 0);
+  // without a clock every row has time 0
+  TEST_ASSERT_EQUAL_STRING("{\"metric\":\"co2\",\"tier\":\"minute\",\"columns\":[\"time\",\"min\",\"max\",\"mean\",\"count\"],"
+                           "\"rows\":[[0,10,10,10.00,1],[0,20,20,20.00,1]]}\n",
+                           readAll(stream, 256));
+}
+
+void test_empty_tier()
+{
+  SmallHistory history;
+  addMinutes(history, 4);
+  HistorySourceOf<SmallHistory> source(history);
+
+  HistoryStream csv(source, "co2", HistoryTier::hour, 0, 10, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n", readAll(csv, 256));
+  TEST_ASSERT_EQUAL_UINT16(0, csv.rowsWritten());
+
+  HistoryStream json(source, "co2", HistoryTier::week, 0, 10, HistoryFormat::json, 1000);
+  TEST_ASSERT_EQUAL_STRING("{\"metric\":\"co2\",\"tier\":\"week\",\"columns\":[\"time\",\"min\",\"max\",\"mean\",\"count\"],\"rows\":[]}\n",
+                           readAll(json, 256));
+}
+
+void test_ranges_without_rows()
+{
+  SmallHistory history;
+  addMinutes(history, 3);
+  HistorySourceOf<SmallHistory> source(history);
+
+  HistoryStream none(source, "co2", HistoryTier::minute, 0, 0, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n", readAll(none, 256));
+
+  HistoryStream atEnd(source, "co2", HistoryTier::minute, 3, 10, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n", readAll(atEnd, 256));
+
+  HistoryStream beyond(source, "co2", HistoryTier::minute, 60000, 65535, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n", readAll(beyond, 256));
+}
+
+void test_range_is_clipped_to_the_tier()
+{
+  SmallHistory history;
+  // 7 minutes in 5 slots, the first two are gone
+  addMinutes(history, 7);
+  HistorySourceOf<SmallHistory> source(history);
+
+  // first + count is beyond 16 bits
+  HistoryStream older(source, "co2", HistoryTier::minute, 1, 65535, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n"
+                           "760,30,30,30.00,1\n"
+                           "820,40,40,40.00,1\n"
+                           "880,50,50,50.00,1\n"
+                           "940,60,60,60.00,1\n",
+                           readAll(older, 256));
+
+  HistoryStream middle(source, "co2", HistoryTier::minute, 2, 2, HistoryFormat::csv, 1000);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n"
+                           "820,40,40,40.00,1\n"
+                           "880,50,50,50.00,1\n",
+                           readAll(middle, 256));
+}
+
+void test_hour_rows()
+{
+  SmallHistory history;
+  addMinutes(history, 120);
+  HistorySourceOf<SmallHistory> source(history);
+  HistoryStream stream(source, "co2", HistoryTier::hour, 0, 10, HistoryFormat::csv, 7200);
+  TEST_ASSERT_EQUAL_STRING("time,min,max,mean,count\n"
+                           "3600,10,600,305.00,60\n"
+                           "7200,610,1200,905.00,60\n",
+                           readAll(stream, 256));
+}
+
+void test_small_reads_give_the_same_document()
+{
+  SmallHistory history;
+  addMinutes(history, 5);
+  HistorySourceOf<SmallHistory> source(history);
+
+  static char whole[2048];
+  HistoryStream reference(source, "pm25", HistoryTier::minute, 0, 5, HistoryFormat::json, 1000);
+  strcpy(whole, readAll(reference, sizeof(document) - 1));
+
+  const size_t chunks[] = {1, 2, 7, 31, 127, 128, 129};
+  for (size_t chunk : chunks)
+  {
+    HistoryStream stream(source, "pm25", HistoryTier::minute, 0, 5, HistoryFormat::json, 1000);
+    TEST_ASSERT_EQUAL_STRING(whole, readAll(stream, chunk));
+    TEST_ASSERT_EQUAL_UINT16(5, stream.rowsWritten());
+  }
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_csv_rows_go_from_oldest_to_newest);
+  RUN_TEST(test_json_document);
+  RUN_TEST(test_empty_tier);
+  RUN_TEST(test_ranges_without_rows);
+  RUN_TEST(test_range_is_clipped_to_the_tier);
+  RUN_TEST(test_hour_rows);
+  RUN_TEST(test_small_reads_give_the_same_document);
+  return UNITY_END();
+}
@@ -0,0 +1,132 @@
+#include <unity.h>
+
+#include "InFlightWindow.h"
+
+static void fill(InFlightWindow &window, uint8_t publishes)
+{
+  // packet ids 1, 2, ... carrying 3 samples each
+  for (uint8_t i = 1; i <= publishes; i++)
+  {
+    window.add(i, 3);
+  }
+}
+
+void test_size_is_capped()
+{
+  InFlightWindow window(20);
+  fill(window, 20);
+  TEST_ASSERT_TRUE(window.full());
+  TEST_ASSERT_EQUAL_UINT8(InFlightWindow::maxSize, window.size());
+  TEST_ASSERT_EQUAL_UINT16(3 * InFlightWindow::maxSize, window.samples());
+}
+
+void test_delivers_the_acknowledged_prefix()
+{
+  InFlightWindow window(4);
+  fill(window, 4);
+  TEST_ASSERT_EQUAL_UINT16(0, window.acknowledge(2));
+  TEST_ASSERT_EQUAL_UINT16(0, window.acknowledge(4));
+  TEST_ASSERT_EQUAL_UINT16(6, window.acknowledge(1));
+  TEST_ASSERT_EQUAL_UINT8(2, window.size());
+  TEST_ASSERT_EQUAL_UINT16(3, window.packetIdAt(0));
+  // an id that isn't in flight changes nothing
+  TEST_ASSERT_EQUAL_UINT16(0, window.acknowledge(9));
+  TEST_ASSERT_EQUAL_UINT16(6, window.acknowledge(3));
+  TEST_ASSERT_EQUAL_UINT8(0, window.size());
+  TEST_ASSERT_EQUAL_UINT16(0, window.samples());
+}
+
+void test_drop_forgets_whole_publishes()
+{
+  InFlightWindow window(4);
+  fill(window, 4);
+  window.dropFront(6);
+  TEST_ASSERT_EQUAL_UINT8(2, window.size());
+  TEST_ASSERT_EQUAL_UINT16(6, window.samples());
+  TEST_ASSERT_EQUAL_UINT16(3, window.packetIdAt(0));
+
+  // the acks of the dropped publishes must not pop the samples behind them
+  TEST_ASSERT_EQUAL_UINT16(0, window.acknowledge(1));
+  TEST_ASSERT_EQUAL_UINT16(0, window.acknowledge(2));
+  TEST_ASSERT_EQUAL_UINT16(3, window.acknowledge(3));
+}
+
+void test_drop_shrinks_a_partial_publish()
+{
+  InFlightWindow window(4);
+  fill(window, 3);
+  window.dropFront(4);
+  TEST_ASSERT_EQUAL_UINT8(2, window.size());
+  TEST_ASSERT_EQUAL_UINT16(2, window.samplesAt(0));
+  TEST_ASSERT_EQUAL_UINT16(5, window.samples());
+  TEST_ASSERT_EQUAL_UINT16(2, window.acknowledge(2));
+
+  // more than the window holds leaves it empty
+  window.dropFront(100);
+  TEST_ASSERT_EQUAL_UINT8(0, window.size());
+  TEST_ASSERT_EQUAL_UINT16(0, window.samples());
+}
+
+void test_resend_goes_on_where_it_stopped()
+{
+  InFlightWindow window(4);
+  fill(window, 4);
+  TEST_ASSERT_EQUAL_UINT8(0, window.unsent());
+  window.resendAll();
+  TEST_ASSERT_EQUAL_UINT8(4, window.unsent());
+
+  // the send buffer takes two publishes per drain, like resendInFlight() sees it
+  uint16_t sent[8];
+  uint8_t sentCount = 0;
+  uint8_t drains = 0;
+  while (window.unsent() > 0)
+  {
+    uint8_t room = 2;
+    for (uint8_t i = window.size() - window.unsent(); i < window.size() && room > 0; i++, room--)
+    {
+      sent[sentCount++] = window.packetIdAt(i);
+      window.resent();
+    }
+    drains++;
+  }
+  TEST_ASSERT_EQUAL_UINT8(2, drains);
+  TEST_ASSERT_EQUAL_UINT8(4, sentCount);
+  for (uint8_t i = 0; i < sentCount; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(i + 1, sent[i]);
+  }
+}
+
+void test_unsent_follows_acks_and_drops()
+{
+  InFlightWindow window(4);
+  fill(window, 4);
+  window.resendAll();
+  window.resent();
+  TEST_ASSERT_EQUAL_UINT8(3, window.unsent());
+
+  // the broker may still ack what went out before the connection dropped
+  window.acknowledge(1);
+  window.acknowledge(2);
+  TEST_ASSERT_EQUAL_UINT8(2, window.unsent());
+  TEST_ASSERT_EQUAL_UINT16(3, window.packetIdAt(window.size() - window.unsent()));
+
+  window.dropFront(3);
+  TEST_ASSERT_EQUAL_UINT8(1, window.unsent());
+  TEST_ASSERT_EQUAL_UINT16(4, window.packetIdAt(window.size() - window.unsent()));
+
+  window.clear();
+  TEST_ASSERT_EQUAL_UINT8(0, window.unsent());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_size_is_capped);
+  RUN_TEST(test_delivers_the_acknowledged_prefix);
+  RUN_TEST(test_drop_forgets_whole_publishes);
+  RUN_TEST(test_drop_shrinks_a_partial_publish);
+  RUN_TEST(test_resend_goes_on_where_it_stopped);
+  RUN_TEST(test_unsent_follows_acks_and_drops);
+  return UNITY_END();
+}
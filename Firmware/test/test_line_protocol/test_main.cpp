@@ -0,0 +1,138 @@
+#include <math.h>
+#include <string.h>
+#include <unity.h>
+
+#include "LineProtocol.h"
+
+void test_single_line()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("co2").tag("site", "kitchen").field("value", int32_t(412)).timestamp(1700000000123ULL).end();
+  TEST_ASSERT_EQUAL_STRING("co2,site=kitchen value=412 1700000000123000000", line.c_str());
+  TEST_ASSERT_EQUAL(1, line.lineCount());
+  TEST_ASSERT_EQUAL(strlen(buffer), line.length());
+  TEST_ASSERT_FALSE(line.overflowed());
+}
+
+void test_escapes_tags_and_measurement()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("pm 2,5").tag("site", "living room,=x").field("a b", int32_t(1)).end();
+  TEST_ASSERT_EQUAL_STRING("pm\\ 2\\,5,site=living\\ room\\,\\=x a\\ b=1", line.c_str());
+}
+
+void test_fields()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("m").field("i", int32_t(-2147483647 - 1)).field("u", uint32_t(4294967295u)).field("f", -1.005f, 1).field("g", 0.5f, 0).end();
+  TEST_ASSERT_EQUAL_STRING("m i=-2147483648,u=4294967295,f=-1.0,g=1", line.c_str());
+}
+
+void test_skips_non_finite_floats()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("lux").field("value", NAN).end();
+  TEST_ASSERT_EQUAL(0, line.lineCount());
+  TEST_ASSERT_EQUAL_STRING("", line.c_str());
+  line.beginLine("lux").field("value", INFINITY).field("other", 1.5f).end();
+  TEST_ASSERT_EQUAL_STRING("lux other=1.50", line.c_str());
+}
+
+void test_batches_lines()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("a").field("v", int32_t(1)).end();
+  line.beginLine("b").field("v", int32_t(2));
+  line.beginLine("c").field("v", int32_t(3)).end();
+  TEST_ASSERT_EQUAL_STRING("a v=1\nb v=2\nc v=3", line.c_str());
+  TEST_ASSERT_EQUAL(3, line.lineCount());
+}
+
+void test_discards_line_without_fields()
+{
+  char buffer[80];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("a").field("v", int32_t(1)).end();
+  line.beginLine("b").tag("site", "x").end();
+  line.beginLine("c").field("v", int32_t(3)).end();
+  TEST_ASSERT_EQUAL_STRING("a v=1\nc v=3", line.c_str());
+  TEST_ASSERT_EQUAL(2, line.lineCount());
+}
+
+void test_overflow_keeps_complete_lines()
+{
+  char buffer[16];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("a").field("v", int32_t(1)).end();
+  line.beginLine("bbbbbbbb").field("v", int32_t(2)).end();
+  TEST_ASSERT_TRUE(line.overflowed());
+  TEST_ASSERT_EQUAL_STRING("a v=1", line.c_str());
+  TEST_ASSERT_EQUAL(1, line.lineCount());
+  TEST_ASSERT_EQUAL(5, line.length());
+
+  // nothing is added after an overflow until the writer is cleared
+  line.beginLine("c").field("v", int32_t(3)).end();
+  TEST_ASSERT_EQUAL_STRING("a v=1", line.c_str());
+  line.clear();
+  TEST_ASSERT_FALSE(line.overflowed());
+  line.beginLine("c").field("v", int32_t(3)).end();
+  TEST_ASSERT_EQUAL_STRING("c v=3", line.c_str());
+}
+
+void test_exact_fit()
+{
+  char buffer[6];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+  line.beginLine("a").field("v", int32_t(1)).end();
+  TEST_ASSERT_FALSE(line.overflowed());
+  TEST_ASSERT_EQUAL_STRING("a v=1", line.c_str());
+  TEST_ASSERT_EQUAL(0, line.capacityLeft());
+}
+
+// the 13 lines main.cpp writes per sample, with the longest room name the portal accepts
+void test_worst_case_sample_fits_its_share_of_the_batch()
+{
+  const size_t sampleLinesSize = 13 * 140;
+  const char *room = "                                       ";
+  const char *sizes[] = {"0.3", "0.5", "1.0", "2.5", "5.0", "10.0"};
+  const char *measurements[] = {"co2", "pm10_std", "pm25_std", "pm100_std", "pm10_env", "pm25_env", "pm100_env"};
+  static char buffer[2 * sampleLinesSize + 1];
+  LineProtocolWriter line(buffer, sizeof(buffer));
+
+  for (int sample = 0; sample < 2; sample++)
+  {
+    TEST_ASSERT_TRUE(line.capacityLeft() >= sampleLinesSize);
+    size_t before = line.length();
+    for (const char *measurement : measurements)
+    {
+      line.beginLine(measurement).tag("site", room).field("value", int32_t(-2147483647 - 1)).timestamp(UINT64_MAX / 1000000).end();
+    }
+    for (const char *size : sizes)
+    {
+      line.beginLine("particles").tag("site", room).tag("size", size).field("value", uint32_t(65535)).timestamp(UINT64_MAX / 1000000).end();
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(sampleLinesSize, line.length() - before);
+  }
+  TEST_ASSERT_FALSE(line.overflowed());
+  TEST_ASSERT_EQUAL(26, line.lineCount());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_single_line);
+  RUN_TEST(test_escapes_tags_and_measurement);
+  RUN_TEST(test_fields);
+  RUN_TEST(test_skips_non_finite_floats);
+  RUN_TEST(test_batches_lines);
+  RUN_TEST(test_discards_line_without_fields);
+  RUN_TEST(test_overflow_keeps_complete_lines);
+  RUN_TEST(test_exact_fit);
+  RUN_TEST(test_worst_case_sample_fits_its_share_of_the_batch);
+  return UNITY_END();
+}
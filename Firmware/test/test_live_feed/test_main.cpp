@@ -0,0 +1,104 @@
+#include <string.h>
+#include <unity.h>
+
+#include "LiveFeed.h"
+
+static char buffer[512];
+
+static const char *next(LiveFeed &feed, LiveFeed::Cursor &cursor, size_t capacity = sizeof(buffer) - 1)
+{
+  size_t length = feed.next(cursor, buffer, capacity);
+  buffer[length] = '\0';
+  return buffer;
+}
+
+static Sample sample(uint16_t pm25)
+{
+  Sample sample = {};
+  sample.timestamp = 1700000000123ULL;
+  sample.co2 = 612;
+  sample.co2Temp = 21;
+  sample.lux = 35.5f;
+  sample.pms.pm10_standard = pm25 / 2;
+  sample.pms.pm25_standard = pm25;
+  sample.pms.pm100_standard = pm25 * 2;
+  return sample;
+}
+
+void test_greets_and_waits_for_the_next_sample()
+{
+  LiveFeed feed(10000);
+  feed.publish(sample(8));
+  LiveFeed::Cursor cursor = {};
+  TEST_ASSERT_EQUAL_STRING("retry: 10000\nid: 1\ndata: hello\n\n", next(feed, cursor));
+  // the sample before the browser came isn't sent again
+  TEST_ASSERT_EQUAL_STRING("", next(feed, cursor));
+
+  feed.publish(sample(10));
+  TEST_ASSERT_EQUAL_STRING("id: 2\nevent: sample\n"
+                           "data: {\"time\":1700000000123,\"co2\":612,\"co2Temp\":21,\"lux\":35.5,\"pm10\":5,\"pm25\":10,\"pm100\":20}\n\n",
+                           next(feed, cursor));
+  TEST_ASSERT_EQUAL_STRING("", next(feed, cursor));
+  TEST_ASSERT_EQUAL_UINT32(1, feed.stats().events);
+  TEST_ASSERT_EQUAL_UINT32(0, feed.stats().skipped);
+}
+
+void test_greeting_before_any_sample()
+{
+  LiveFeed feed(5000);
+  LiveFeed::Cursor cursor = {};
+  TEST_ASSERT_EQUAL_STRING("retry: 5000\nid: 0\ndata: hello\n\n", next(feed, cursor));
+  TEST_ASSERT_EQUAL_STRING("", next(feed, cursor));
+  feed.publish(sample(3));
+  TEST_ASSERT_EQUAL(0, strncmp(next(feed, cursor), "id: 1\n", 6));
+}
+
+void test_slow_feed_only_gets_the_newest()
+{
+  LiveFeed feed(10000);
+  LiveFeed::Cursor fast = {};
+  LiveFeed::Cursor slow = {};
+  next(feed, fast);
+  next(feed, slow);
+
+  for (uint16_t pm25 = 1; pm25 <= 4; pm25++)
+  {
+    feed.publish(sample(pm25));
+    TEST_ASSERT_NOT_NULL(strstr(next(feed, fast), "\"pm25\":"));
+  }
+  const char *event = next(feed, slow);
+  TEST_ASSERT_EQUAL(0, strncmp(event, "id: 4\n", 6));
+  TEST_ASSERT_NOT_NULL(strstr(event, "\"pm25\":4,"));
+
+  TEST_ASSERT_EQUAL_UINT32(4, feed.stats().samples);
+  TEST_ASSERT_EQUAL_UINT32(5, feed.stats().events);
+  TEST_ASSERT_EQUAL_UINT32(3, feed.stats().skipped);
+}
+
+void test_waits_until_the_event_fits()
+{
+  LiveFeed feed(10000);
+  LiveFeed::Cursor cursor = {};
+  // not even the greeting fits
+  TEST_ASSERT_EQUAL_STRING("", next(feed, cursor, 8));
+  TEST_ASSERT_FALSE(cursor.greeted);
+  next(feed, cursor);
+
+  feed.publish(sample(8));
+  TEST_ASSERT_EQUAL_STRING("", next(feed, cursor, 40));
+  TEST_ASSERT_EQUAL_UINT32(0, cursor.sentId);
+  // every part is written whole, a chunk never ends in the middle of an event
+  size_t length = strlen(next(feed, cursor));
+  TEST_ASSERT_EQUAL(0, strcmp(buffer + length - 2, "\n\n"));
+  TEST_ASSERT_EQUAL_UINT32(1, cursor.sentId);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_greets_and_waits_for_the_next_sample);
+  RUN_TEST(test_greeting_before_any_sample);
+  RUN_TEST(test_slow_feed_only_gets_the_newest);
+  RUN_TEST(test_waits_until_the_event_fits);
+  return UNITY_END();
+}
@@ -0,0 +1,177 @@
+#include <unity.h>
+
+#include "ParticleChart.h"
+
+// every incremental frame has to leave the same pixels as drawing the chart from scratch
+struct Fixture
+{
+  ParticleHistory pm010;
+  ParticleHistory pm025;
+  ParticleHistory pm100;
+  uint32_t minute = 0;
+
+  // the bounds stay put as long as the lowest and highest values keep coming back,
+  // the lowest add up to less than 10 so no point falls below the plot
+  void addMinute(uint16_t spike = 0)
+  {
+    pm010.addMeasurement(1 + minute % 4);
+    pm025.addMeasurement(2 + minute * 7 % 6);
+    pm100.addMeasurement(spike ? spike : 3 + minute % 5);
+    minute++;
+  }
+
+  void addMinutes(uint32_t count)
+  {
+    for (uint32_t i = 0; i < count; i++)
+    {
+      addMinute();
+    }
+  }
+
+  // the same histories drawn on an empty sprite
+  std::vector<uint16_t> fresh()
+  {
+    TFT_eSPI display;
+    display.setRotation(1);
+    TFT_eSprite sprite(&display);
+    sprite.createSprite(display.width(), display.height());
+    ParticleChart chart(sprite, pm010, pm025, pm100);
+    chart.render();
+    return sprite.screen();
+  }
+};
+
+static void assertSameScreen(const std::vector<uint16_t> &expected, const std::vector<uint16_t> &actual, int16_t width)
+{
+  TEST_ASSERT_EQUAL(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++)
+  {
+    if (expected[i] != actual[i])
+    {
+      char message[64];
+      snprintf(message, sizeof(message), "pixel %d,%d differs", int(i % width), int(i / width));
+      TEST_ASSERT_EQUAL_MESSAGE(expected[i], actual[i], message);
+    }
+  }
+}
+
+void test_new_minute_scrolls_and_draws_few_columns()
+{
+  Fixture fixture;
+  fixture.addMinutes(150);
+  TFT_eSPI display;
+  display.setRotation(1);
+  TFT_eSprite sprite(&display);
+  sprite.createSprite(display.width(), display.height());
+  ParticleChart chart(sprite, fixture.pm010, fixture.pm025, fixture.pm100);
+  chart.setCanvas(sprite, &sprite);
+  chart.render();
+  TEST_ASSERT_TRUE(chart.stats().fullRedraw);
+
+  fixture.addMinute();
+  chart.render();
+  const ParticleChart::Stats &stats = chart.stats();
+  TEST_ASSERT_FALSE(stats.plotRedrawn);
+  TEST_ASSERT_GREATER_THAN(50, stats.scrolledColumns);
+  TEST_ASSERT_LESS_OR_EQUAL(10, stats.dirtyColumns);
+  assertSameScreen(fixture.fresh(), sprite.screen(), sprite.width());
+}
+
+void test_scrolled_frames_match_a_full_redraw()
+{
+  Fixture fixture;
+  fixture.addMinutes(30);
+  TFT_eSPI display;
+  display.setRotation(1);
+  TFT_eSprite sprite(&display);
+  sprite.createSprite(display.width(), display.height());
+  ParticleChart chart(sprite, fixture.pm010, fixture.pm025, fixture.pm100);
+  chart.setCanvas(sprite, &sprite);
+  chart.render();
+
+  // crosses hour boundaries, where the hour tier scrolls as well
+  uint32_t scrolled = 0;
+  for (int i = 0; i < 150; i++)
+  {
+    fixture.addMinute();
+    chart.render();
+    scrolled += chart.stats().scrolledColumns > 0;
+    assertSameScreen(fixture.fresh(), sprite.screen(), sprite.width());
+  }
+  TEST_ASSERT_GREATER_THAN(100, scrolled);
+}
+
+void test_skipped_minutes_and_bound_changes_match_a_full_redraw()
+{
+  Fixture fixture;
+  fixture.addMinutes(90);
+  TFT_eSPI display;
+  display.setRotation(1);
+  TFT_eSprite sprite(&display);
+  sprite.createSprite(display.width(), display.height());
+  ParticleChart chart(sprite, fixture.pm010, fixture.pm025, fixture.pm100);
+  chart.setCanvas(sprite, &sprite);
+  chart.render();
+
+  const uint32_t gaps[] = {3, 59, 60, 61, 200};
+  for (uint32_t gap : gaps)
+  {
+    fixture.addMinutes(gap);
+    chart.render();
+    assertSameScreen(fixture.fresh(), sprite.screen(), sprite.width());
+  }
+
+  fixture.addMinute(80);
+  chart.render();
+  TEST_ASSERT_TRUE(chart.stats().plotRedrawn);
+  assertSameScreen(fixture.fresh(), sprite.screen(), sprite.width());
+}
+
+// without a frame buffer nothing can be scrolled, the tier is drawn again
+void test_direct_drawing_matches_a_full_redraw()
+{
+  Fixture fixture;
+  fixture.addMinutes(100);
+  TFT_eSPI display;
+  display.setRotation(1);
+  ParticleChart chart(display, fixture.pm010, fixture.pm025, fixture.pm100);
+  chart.render();
+
+  for (int i = 0; i < 70; i++)
+  {
+    fixture.addMinute();
+    chart.render();
+    TEST_ASSERT_EQUAL(0, chart.stats().scrolledColumns);
+    assertSameScreen(fixture.fresh(), display.screen(), display.width());
+  }
+}
+
+void test_unchanged_history_draws_nothing()
+{
+  Fixture fixture;
+  fixture.addMinutes(100);
+  TFT_eSPI display;
+  display.setRotation(1);
+  TFT_eSprite sprite(&display);
+  sprite.createSprite(display.width(), display.height());
+  ParticleChart chart(sprite, fixture.pm010, fixture.pm025, fixture.pm100);
+  chart.setCanvas(sprite, &sprite);
+  chart.render();
+
+  uint32_t writes = sprite.pixelWrites;
+  chart.render();
+  int16_t top, bottom;
+  TEST_ASSERT_FALSE(chart.dirtyRows(top, bottom));
+  TEST_ASSERT_EQUAL(writes, sprite.pixelWrites);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_new_minute_scrolls_and_draws_few_columns);
+  RUN_TEST(test_scrolled_frames_match_a_full_redraw);
+  RUN_TEST(test_skipped_minutes_and_bound_changes_match_a_full_redraw);
+  RUN_TEST(test_direct_drawing_matches_a_full_redraw);
+  RUN_TEST(test_unchanged_history_draws_nothing);
+  return UNITY_END();
+}
@@ -0,0 +1,137 @@
+#include <unity.h>
+
+#include "FakeTransport.h"
+#include "PMS5003.h"
+
+// A PMS5003 stream in active mode with the faults seen on the wire: noise,
+// a corrupted checksum, a frame cut off by a sensor restart, a doubled start
+// byte, a broken header and a command answer between the data frames.
+static const uint8_t recording[] = {
+    // line noise before the first frame, a start byte without its second one
+    0x00, 0xFF, 0x4D, 0x42, 0x00,
+    // data frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09, 0x00, 0x05, 0x00, 0x08, 0x00, 0x09,
+    0x04, 0x53, 0x01, 0x4A, 0x00, 0x34, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x97, 0x00, 0x02, 0x4C,
+    // data frame with a corrupted checksum
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x0D, 0x00, 0x0F,
+    0x05, 0x78, 0x01, 0xA4, 0x00, 0x50, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x01, 0x97, 0x00, 0x03, 0x1F,
+    // data frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x09, 0x00, 0x0B, 0x00, 0x06, 0x00, 0x09, 0x00, 0x0B,
+    0x04, 0xA4, 0x01, 0x5F, 0x00, 0x3D, 0x00, 0x08, 0x00, 0x02, 0x00, 0x01, 0x97, 0x00, 0x02, 0xC6,
+    // the sensor restarted 10 bytes into a frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x0C,
+    // data frame, it starts inside the cut off one
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08,
+    0x04, 0x08, 0x01, 0x32, 0x00, 0x2F, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x97, 0x00, 0x01, 0xDE,
+    // a doubled start byte
+    0x42,
+    // data frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x0B, 0x00, 0x0E,
+    0x05, 0x19, 0x01, 0x85, 0x00, 0x4C, 0x00, 0x0B, 0x00, 0x03, 0x00, 0x01, 0x97, 0x00, 0x02, 0x81,
+    // header with an impossible length
+    0x42, 0x4D, 0x00, 0x40,
+    // answer to the change mode command
+    0x42, 0x4D, 0x00, 0x04, 0xE1, 0x00, 0x01, 0x74,
+    // data frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x05, 0x00, 0x09, 0x00, 0x0A,
+    0x04, 0x6B, 0x01, 0x56, 0x00, 0x3A, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x97, 0x00, 0x02, 0x7B,
+    // data frame
+    0x42, 0x4D, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x0C,
+    0x04, 0xDC, 0x01, 0x6F, 0x00, 0x42, 0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x97, 0x00, 0x03, 0x18,
+};
+
+// pm2.5 of the six data frames in order and the rounded mean of all fields
+static const uint16_t recordedPm25[] = {8, 9, 8, 11, 9, 10};
+static const PMSResult recordedMean = {6, 9, 11, 6, 9, 11, 1168, 348, 60, 8, 2, 0};
+
+static void assertResult(const PMSResult &expected, const PMSResult &actual)
+{
+  TEST_ASSERT_EQUAL_MEMORY(&expected, &actual, sizeof(PMSResult));
+}
+
+void test_parser_recovers_every_data_frame()
+{
+  PmsFrameParser parser;
+  uint8_t frames = 0;
+  for (uint8_t byte : recording)
+  {
+    if (parser.feed(byte))
+    {
+      TEST_ASSERT_LESS_THAN(6, frames);
+      TEST_ASSERT_EQUAL(recordedPm25[frames], parser.result().pm25_standard);
+      frames++;
+    }
+  }
+  TEST_ASSERT_EQUAL(6, frames);
+  TEST_ASSERT_EQUAL(6, parser.stats().frames);
+  TEST_ASSERT_EQUAL(2, parser.stats().checksumErrors);
+  TEST_ASSERT_EQUAL(1, parser.stats().otherFrames);
+  TEST_ASSERT_GREATER_THAN(0, parser.stats().skippedBytes);
+}
+
+void test_buffer_feed_counts_frames()
+{
+  PmsFrameParser parser;
+  TEST_ASSERT_EQUAL(6, parser.feed(recording, sizeof(recording)));
+  TEST_ASSERT_EQUAL(10, parser.result().pm25_standard);
+}
+
+// however the UART splits the stream, the driver reports the same mean
+void test_driver_averages_the_stream_in_any_chunks()
+{
+  const size_t chunkSizes[] = {1, 3, 7, 31, 32, 64, sizeof(recording)};
+  for (size_t chunkSize : chunkSizes)
+  {
+    FakeTransport transport(recording, sizeof(recording), chunkSize);
+    PMS5003 pms;
+    TEST_ASSERT_EQUAL(PMS5003::readSuccess, pms.begin(&transport));
+
+    PMSResult mean;
+    TEST_ASSERT_EQUAL(6, pms.takeAverage(mean));
+    assertResult(recordedMean, mean);
+    TEST_ASSERT_EQUAL(2, pms.stats().checksumErrors);
+    TEST_ASSERT_EQUAL(sizeof(recording), transport.stats().bytesRead);
+  }
+}
+
+void test_driver_switches_to_active_mode()
+{
+  FakeTransport transport(recording, sizeof(recording));
+  PMS5003 pms;
+  pms.begin(&transport);
+  const uint8_t activeMode[] = {0x42, 0x4D, 0xE1, 0x00, 0x01, 0x01, 0x71};
+  TEST_ASSERT_EQUAL(sizeof(activeMode), transport.sentLength());
+  TEST_ASSERT_EQUAL_MEMORY(activeMode, transport.sent(), sizeof(activeMode));
+}
+
+// without new frames the last one is reported again
+void test_average_without_frames_repeats_the_last()
+{
+  FakeTransport transport(recording, sizeof(recording));
+  PMS5003 pms;
+  pms.begin(&transport);
+  PMSResult result;
+  pms.takeAverage(result);
+  TEST_ASSERT_EQUAL(0, pms.takeAverage(result));
+  TEST_ASSERT_EQUAL(10, result.pm25_standard);
+}
+
+void test_missing_sensor_times_out()
+{
+  const uint8_t noise[] = {0x00, 0x42, 0x4D, 0x00};
+  FakeTransport transport(noise, sizeof(noise));
+  PMS5003 pms;
+  TEST_ASSERT_EQUAL(PMS5003::readTimeout, pms.begin(&transport, 100));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_parser_recovers_every_data_frame);
+  RUN_TEST(test_buffer_feed_counts_frames);
+  RUN_TEST(test_driver_averages_the_stream_in_any_chunks);
+  RUN_TEST(test_driver_switches_to_active_mode);
+  RUN_TEST(test_average_without_frames_repeats_the_last);
+  RUN_TEST(test_missing_sensor_times_out);
+  return UNITY_END();
+}
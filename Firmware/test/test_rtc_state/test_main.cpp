@@ -0,0 +1,175 @@
+#include <new>
+#include <string.h>
+#include <unity.h>
+
+#include "RtcState.h"
+
+static RtcState state;
+static HistoryRecord replayed[2000];
+static uint16_t replayedCount = 0;
+
+static void collect(const HistoryRecord &record)
+{
+  replayed[replayedCount++] = record;
+}
+
+// minute i carries i as its CO2 value, the other metrics follow it
+static void addMinutes(uint16_t first, uint16_t count)
+{
+  for (uint16_t i = first; i < first + count; i++)
+  {
+    state.addMinute({i, uint16_t(i + 1), uint16_t(i + 2), uint16_t(i + 3), i * 0.5f});
+  }
+}
+
+static void startOver()
+{
+  state.reset();
+  replayedCount = 0;
+}
+
+void test_seal_and_validate()
+{
+  startOver();
+  TEST_ASSERT_FALSE(state.valid());
+  state.seal();
+  TEST_ASSERT_TRUE(state.valid());
+
+  state.wakeups++;
+  TEST_ASSERT_FALSE(state.valid());
+  state.seal();
+  TEST_ASSERT_TRUE(state.valid());
+
+  // another layout is never taken for this one
+  state.layoutVersion = RtcState::version - 1;
+  state.seal();
+  TEST_ASSERT_FALSE(state.valid());
+}
+
+void test_keeps_the_clock_across_a_copy()
+{
+  startOver();
+  TimeSync sync;
+  sync.update(5000000, 1700000000000000ULL);
+  state.timeSync = sync.save();
+  state.clockBase = 65000000;
+  state.seal();
+
+  // what deep sleep does to RTC memory as far as the code can tell
+  static RtcState woken;
+  memcpy(&woken, &state, sizeof(RtcState));
+  TEST_ASSERT_TRUE(woken.valid());
+  TimeSync restored;
+  restored.restore(woken.timeSync);
+  TEST_ASSERT_TRUE(restored.synced());
+  TEST_ASSERT_EQUAL_UINT64(1700000060000000ULL, restored.toUnixMicros(woken.clockBase));
+}
+
+void test_boot_leaves_the_state_alone()
+{
+  alignas(RtcState) static unsigned char memory[sizeof(RtcState)];
+  RtcState *kept = reinterpret_cast<RtcState *>(memory);
+  kept->reset();
+  TimeSync sync;
+  sync.update(5000000, 1700000000000000ULL);
+  kept->timeSync = sync.save();
+  kept->pushPending(Sample());
+  kept->seal();
+
+  // what the startup code does with the RTC_DATA_ATTR variable on a wake up
+  kept = new (memory) RtcState;
+  TEST_ASSERT_TRUE(kept->valid());
+  TEST_ASSERT_EQUAL_UINT32(1, kept->timeSync.counters.syncs);
+  TEST_ASSERT_EQUAL_UINT8(1, kept->pendingCount);
+}
+
+void test_pending_drops_the_oldest()
+{
+  startOver();
+  for (uint8_t i = 0; i < RtcState::pendingCapacity + 3; i++)
+  {
+    Sample sample = {};
+    sample.co2 = i;
+    state.pushPending(sample);
+  }
+  TEST_ASSERT_EQUAL_UINT8(RtcState::pendingCapacity, state.pendingCount);
+  TEST_ASSERT_EQUAL_UINT32(3, state.droppedSamples);
+  TEST_ASSERT_EQUAL(3, state.pendingAt(0).co2);
+
+  // stamped in place, the stamp stays with the queued sample
+  state.pendingAt(0).timestamp = 42;
+  state.popPending(1);
+  TEST_ASSERT_EQUAL(4, state.pendingAt(0).co2);
+  state.popPending(100);
+  TEST_ASSERT_EQUAL_UINT8(0, state.pendingCount);
+}
+
+void test_replays_minutes_once()
+{
+  startOver();
+  addMinutes(0, 30);
+  state.replayHistory(collect);
+  TEST_ASSERT_EQUAL_UINT16(30, replayedCount);
+  for (uint16_t i = 0; i < 30; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(i, replayed[i].co2);
+    TEST_ASSERT_EQUAL_UINT16(i + 3, replayed[i].pm100);
+  }
+
+  replayedCount = 0;
+  state.replayHistory(collect);
+  TEST_ASSERT_EQUAL_UINT16(0, replayedCount);
+
+  addMinutes(30, 5);
+  state.replayHistory(collect);
+  TEST_ASSERT_EQUAL_UINT16(5, replayedCount);
+  TEST_ASSERT_EQUAL_UINT16(30, replayed[0].co2);
+}
+
+void test_replays_rolled_up_minutes_as_their_hour()
+{
+  startOver();
+  addMinutes(0, 150);
+  state.replayHistory(collect);
+  TEST_ASSERT_EQUAL_UINT16(150, replayedCount);
+
+  // minutes 0 to 59 are only left as the mean of their hour, the same for 60 to 89
+  for (uint16_t i = 0; i < 60; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(29, replayed[i].co2);
+  }
+  for (uint16_t i = 60; i < 90; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(89, replayed[i].co2);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 44.75f, replayed[i].lux);
+  }
+  for (uint16_t i = 90; i < 150; i++)
+  {
+    TEST_ASSERT_EQUAL_UINT16(i, replayed[i].co2);
+  }
+}
+
+void test_skips_minutes_older_than_the_hours()
+{
+  startOver();
+  addMinutes(0, 26 * 60 + 10);
+  state.replayHistory(collect);
+
+  // 24 hours and the 10 minutes of the open one, the first two hours are gone
+  TEST_ASSERT_EQUAL_UINT16(24 * 60 + 10, replayedCount);
+  TEST_ASSERT_EQUAL_UINT16(2 * 60 + 29, replayed[0].co2);
+  TEST_ASSERT_EQUAL_UINT16(26 * 60 + 9, replayed[replayedCount - 1].co2);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_seal_and_validate);
+  RUN_TEST(test_keeps_the_clock_across_a_copy);
+  RUN_TEST(test_boot_leaves_the_state_alone);
+  RUN_TEST(test_pending_drops_the_oldest);
+  RUN_TEST(test_replays_minutes_once);
+  RUN_TEST(test_replays_rolled_up_minutes_as_their_hour);
+  RUN_TEST(test_skips_minutes_older_than_the_hours);
+  return UNITY_END();
+}
@@ -0,0 +1,223 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include <unity.h>
+
+#include "SampleOutbox.h"
+
+const static uint8_t ram = SampleOutbox::ramCapacity;
+const static uint32_t flashCapacity = SampleOutbox::maxSegments * ram;
+
+static FS &flash()
+{
+  static char root[] = "/tmp/test_sample_outbox_XXXXXX";
+  static FS fs(mkdtemp(root));
+  return fs;
+}
+
+static void startOver()
+{
+  flash().restorePower();
+  flash().format();
+}
+
+// samples are numbered in their co2 field from first on
+static void push(SampleOutbox &outbox, int first, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++)
+  {
+    Sample sample = {};
+    sample.co2 = first + i;
+    outbox.push(sample);
+  }
+}
+
+// takes count samples off the front the way the publisher does and checks they are first, first + 1, ...
+static void expect(SampleOutbox &outbox, int first, uint32_t count)
+{
+  int next = first;
+  while (count > 0)
+  {
+    uint16_t batch = min<uint32_t>(outbox.available(), count);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, batch);
+    for (uint16_t i = 0; i < batch; i++)
+    {
+      Sample sample;
+      TEST_ASSERT_TRUE(outbox.peek(i, sample));
+      TEST_ASSERT_EQUAL(next++, sample.co2);
+    }
+    outbox.pop(batch);
+    count -= batch;
+  }
+}
+
+static uint32_t segmentFiles()
+{
+  uint32_t count = 0;
+  File dir = flash().open("/outbox");
+  for (File file = dir.openNextFile(); file; file = dir.openNextFile())
+  {
+    count++;
+  }
+  return count;
+}
+
+void test_ram_ring_stays_in_ram()
+{
+  startOver();
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  push(outbox, 1, ram);
+  TEST_ASSERT_EQUAL_UINT32(0, segmentFiles());
+  TEST_ASSERT_EQUAL_UINT32(ram, outbox.size());
+  TEST_ASSERT_EQUAL_UINT16(ram, outbox.available());
+  expect(outbox, 1, ram);
+  TEST_ASSERT_TRUE(outbox.empty());
+}
+
+void test_full_ring_spills_into_a_segment()
+{
+  startOver();
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  push(outbox, 1, 3 * ram + 5);
+  TEST_ASSERT_EQUAL_UINT32(3, segmentFiles());
+  TEST_ASSERT_EQUAL_UINT32(3 * ram + 5, outbox.size());
+  // a read never crosses from a segment into the next one
+  TEST_ASSERT_EQUAL_UINT16(ram, outbox.available());
+
+  // new samples queue up behind the spilled ones while the front is read
+  expect(outbox, 1, ram + 7);
+  push(outbox, 3 * ram + 6, 40);
+  expect(outbox, ram + 8, 2 * ram - 7 + 5 + 40);
+  TEST_ASSERT_TRUE(outbox.empty());
+  TEST_ASSERT_EQUAL_UINT32(0, segmentFiles());
+  TEST_ASSERT_EQUAL_UINT32(0, outbox.dropped());
+}
+
+void test_segment_cap_drops_the_oldest()
+{
+  startOver();
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  push(outbox, 1, flashCapacity + ram);
+  TEST_ASSERT_EQUAL_UINT32(SampleOutbox::maxSegments, segmentFiles());
+  TEST_ASSERT_EQUAL_UINT32(0, outbox.dropped());
+
+  // the next spill has no room left
+  push(outbox, flashCapacity + ram + 1, 1);
+  TEST_ASSERT_EQUAL_UINT32(SampleOutbox::maxSegments, segmentFiles());
+  TEST_ASSERT_EQUAL_UINT32(ram, outbox.dropped());
+  TEST_ASSERT_EQUAL_UINT32(ram, outbox.droppedAtFront());
+  TEST_ASSERT_EQUAL_UINT32(flashCapacity + 1, outbox.size());
+  expect(outbox, ram + 1, flashCapacity + 1);
+}
+
+void test_partly_read_segment_is_dropped_from_its_read_position()
+{
+  startOver();
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  push(outbox, 1, flashCapacity + ram);
+  expect(outbox, 1, 10);
+
+  // only what wasn't read yet is lost
+  push(outbox, flashCapacity + ram + 1, 1);
+  TEST_ASSERT_EQUAL_UINT32(ram - 10, outbox.droppedAtFront());
+  expect(outbox, ram + 1, flashCapacity + 1);
+}
+
+void test_ram_drops_count_at_the_front_only_without_flash()
+{
+  startOver();
+  SampleOutbox outbox;
+  outbox.begin(nullptr);
+  push(outbox, 1, ram + 3);
+  TEST_ASSERT_EQUAL_UINT32(3, outbox.dropped());
+  TEST_ASSERT_EQUAL_UINT32(3, outbox.droppedAtFront());
+  expect(outbox, 4, ram);
+
+  // with samples in flash the oldest in RAM are in the middle of the queue
+  SampleOutbox spilled;
+  spilled.begin(&flash());
+  push(spilled, 1, ram + 1);
+  flash().cutPowerAfter(0);
+  push(spilled, ram + 2, ram + 1);
+  flash().restorePower();
+  TEST_ASSERT_EQUAL_UINT32(2, spilled.dropped());
+  TEST_ASSERT_EQUAL_UINT32(0, spilled.droppedAtFront());
+  expect(spilled, 1, ram);
+  expect(spilled, ram + 3, ram);
+}
+
+void test_restart_replays_in_order()
+{
+  startOver();
+  {
+    SampleOutbox outbox;
+    outbox.begin(&flash());
+    push(outbox, 1, 5 * ram + 4);
+    expect(outbox, 1, 2 * ram);
+    // the samples in RAM don't survive the restart
+  }
+
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  TEST_ASSERT_EQUAL_UINT32(3 * ram, outbox.size());
+  push(outbox, 1000, 3);
+  expect(outbox, 2 * ram + 1, 3 * ram);
+  expect(outbox, 1000, 3);
+  TEST_ASSERT_TRUE(outbox.empty());
+}
+
+void test_restart_sends_a_partly_read_segment_again()
+{
+  startOver();
+  {
+    SampleOutbox outbox;
+    outbox.begin(&flash());
+    push(outbox, 1, 2 * ram + 1);
+    expect(outbox, 1, 10);
+  }
+
+  // the read position isn't kept, delivery is at least once
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  TEST_ASSERT_EQUAL_UINT32(2 * ram, outbox.size());
+  expect(outbox, 1, 2 * ram);
+}
+
+void test_segments_of_another_layout_are_discarded()
+{
+  startOver();
+  {
+    SampleOutbox outbox;
+    outbox.begin(&flash());
+    push(outbox, 1, 2 * ram + 1);
+  }
+  // a firmware with another Sample wrote the first segment
+  FILE *file = fopen(flash().hostPath("/outbox/1.bin").c_str(), "r+b");
+  fputc(0xFF, file);
+  fclose(file);
+
+  SampleOutbox outbox;
+  outbox.begin(&flash());
+  TEST_ASSERT_EQUAL_UINT32(ram, outbox.size());
+  TEST_ASSERT_FALSE(flash().exists("/outbox/1.bin"));
+  expect(outbox, ram + 1, ram);
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_ram_ring_stays_in_ram);
+  RUN_TEST(test_full_ring_spills_into_a_segment);
+  RUN_TEST(test_segment_cap_drops_the_oldest);
+  RUN_TEST(test_partly_read_segment_is_dropped_from_its_read_position);
+  RUN_TEST(test_ram_drops_count_at_the_front_only_without_flash);
+  RUN_TEST(test_restart_replays_in_order);
+  RUN_TEST(test_restart_sends_a_partly_read_segment_again);
+  RUN_TEST(test_segments_of_another_layout_are_discarded);
+  flash().format();
+  rmdir(flash().hostPath("").c_str());
+  return UNITY_END();
+}
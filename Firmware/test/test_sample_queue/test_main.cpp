@@ -0,0 +1,155 @@
+#include <freertos/task.h>
+#include <mutex>
+#include <unity.h>
+
+#include "SampleQueue.h"
+
+const static uint8_t queueLength = 10;
+// tells a consumer task to return
+const static int lastSample = -1;
+
+struct Consumer
+{
+  SampleQueue *queue;
+  std::vector<int> received;
+  // held by the test to stall the consumer after its first sample
+  std::mutex *stall;
+};
+
+static void consumerTask(void *parameter)
+{
+  Consumer &consumer = *(Consumer *)parameter;
+  Sample sample;
+  for (;;)
+  {
+    if (!consumer.queue->pop(sample, portMAX_DELAY))
+    {
+      continue;
+    }
+    if (consumer.stall)
+    {
+      std::lock_guard<std::mutex> wait(*consumer.stall);
+    }
+    if (sample.co2 == lastSample)
+    {
+      return;
+    }
+    consumer.received.push_back(sample.co2);
+  }
+}
+
+static Sample sample(int co2)
+{
+  Sample sample = {};
+  sample.co2 = co2;
+  return sample;
+}
+
+// what the scheduler task does with every completed sample
+static void handOff(SampleQueue &display, SampleQueue &publish, int co2)
+{
+  display.push(sample(co2));
+  publish.push(sample(co2));
+}
+
+// nothing is repeated or reordered, what didn't arrive was counted as dropped
+static void checkDelivery(const Consumer &consumer, int pushed)
+{
+  for (size_t i = 1; i < consumer.received.size(); i++)
+  {
+    TEST_ASSERT_GREATER_THAN(consumer.received[i - 1], consumer.received[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(pushed, consumer.received.size() + consumer.queue->dropped());
+  // the newest sample always gets through
+  TEST_ASSERT_EQUAL(pushed, consumer.received.back());
+}
+
+void test_full_queue_drops_the_oldest()
+{
+  SampleQueue queue(queueLength);
+  queue.begin();
+  for (int co2 = 1; co2 <= 15; co2++)
+  {
+    queue.push(sample(co2));
+  }
+  TEST_ASSERT_EQUAL_UINT32(5, queue.dropped());
+
+  Sample next;
+  for (int co2 = 6; co2 <= 15; co2++)
+  {
+    TEST_ASSERT_TRUE(queue.pop(next, 0));
+    TEST_ASSERT_EQUAL(co2, next.co2);
+  }
+  TEST_ASSERT_FALSE(queue.pop(next, 0));
+
+  // an empty queue lets the consumer wait out its timeout
+  TickType_t start = xTaskGetTickCount();
+  TEST_ASSERT_FALSE(queue.pop(next, 20));
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(20, xTaskGetTickCount() - start);
+}
+
+void test_both_tasks_get_every_sample()
+{
+  SampleQueue display(queueLength);
+  SampleQueue publish(queueLength);
+  display.begin();
+  publish.begin();
+  Consumer displayConsumer = {&display, {}, nullptr};
+  Consumer networkConsumer = {&publish, {}, nullptr};
+  xTaskCreatePinnedToCore(consumerTask, "display", 8192, &displayConsumer, 1, NULL, 1);
+  xTaskCreatePinnedToCore(consumerTask, "network", 8192, &networkConsumer, 2, NULL, 0);
+
+  // one sample every tick, far more often than on the chip
+  for (int co2 = 1; co2 <= 50; co2++)
+  {
+    handOff(display, publish, co2);
+    vTaskDelay(1);
+  }
+  handOff(display, publish, lastSample);
+  fakeJoinTasks();
+
+  checkDelivery(displayConsumer, 50);
+  checkDelivery(networkConsumer, 50);
+}
+
+void test_stalled_task_doesnt_hold_up_the_other()
+{
+  SampleQueue display(queueLength);
+  SampleQueue publish(queueLength);
+  display.begin();
+  publish.begin();
+  // the display task hangs in a redraw
+  std::mutex stall;
+  stall.lock();
+  Consumer displayConsumer = {&display, {}, &stall};
+  Consumer networkConsumer = {&publish, {}, nullptr};
+  xTaskCreatePinnedToCore(consumerTask, "display", 8192, &displayConsumer, 1, NULL, 1);
+  xTaskCreatePinnedToCore(consumerTask, "network", 8192, &networkConsumer, 2, NULL, 0);
+
+  TickType_t start = xTaskGetTickCount();
+  for (int co2 = 1; co2 <= 1000; co2++)
+  {
+    handOff(display, publish, co2);
+  }
+  // the producer never waited on the stalled queue
+  TEST_ASSERT_LESS_THAN_UINT32(500, xTaskGetTickCount() - start);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1000 - queueLength - 1, display.dropped());
+
+  stall.unlock();
+  handOff(display, publish, lastSample);
+  fakeJoinTasks();
+
+  checkDelivery(displayConsumer, 1000);
+  checkDelivery(networkConsumer, 1000);
+  // at most the sample it was drawing and a full queue
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(queueLength + 1, displayConsumer.received.size());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_full_queue_drops_the_oldest);
+  RUN_TEST(test_both_tasks_get_every_sample);
+  RUN_TEST(test_stalled_task_doesnt_hold_up_the_other);
+  return UNITY_END();
+}
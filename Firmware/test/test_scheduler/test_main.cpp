@@ -0,0 +1,174 @@
+#include <unity.h>
+
+#include "Scheduler.h"
+
+static uint32_t now = 0;
+// how long the next run of a job takes
+static uint32_t runtime = 0;
+static uint32_t runs = 0;
+
+static uint32_t fakeClock()
+{
+  return now;
+}
+
+static void job()
+{
+  runs++;
+  now += runtime;
+}
+
+static void startAt(uint32_t time)
+{
+  now = time;
+  runtime = 0;
+  runs = 0;
+}
+
+void test_runs_on_its_period()
+{
+  startAt(0);
+  Scheduler scheduler(fakeClock);
+  TEST_ASSERT_EQUAL(0, scheduler.addJob("job", 100, 10, job));
+  TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(1, runs);
+
+  now = 60;
+  TEST_ASSERT_EQUAL_UINT32(40, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(1, runs);
+  now = 100;
+  TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(2, runs);
+}
+
+void test_first_delay_and_the_nearest_job()
+{
+  startAt(1000);
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("slow", 500, 10, job, 300);
+  scheduler.addJob("fast", 100, 10, job, 50);
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(0, runs);
+  now = 1050;
+  TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue());
+  now = 1150;
+  TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue());
+  now = 1250;
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  now = 1300;
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(4, runs);
+}
+
+void test_millis_wraparound()
+{
+  startAt(UINT32_MAX - 150);
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("job", 100, 10, job);
+  scheduler.runDue();
+  now = UINT32_MAX - 50;
+  scheduler.runDue();
+  TEST_ASSERT_EQUAL_UINT32(2, runs);
+
+  // due at 49 after the wrap, not in 49 days
+  now = UINT32_MAX - 10;
+  TEST_ASSERT_EQUAL_UINT32(60, scheduler.runDue());
+  now = 49;
+  TEST_ASSERT_EQUAL_UINT32(100, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(3, runs);
+  TEST_ASSERT_EQUAL_UINT32(0, scheduler.jobStats(0).maxLatency);
+  TEST_ASSERT_EQUAL_UINT32(0, scheduler.jobStats(0).skipped);
+}
+
+void test_missed_periods_are_skipped()
+{
+  startAt(0);
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("job", 100, 10, job);
+  scheduler.runDue();
+
+  // the periods due at 100, 200 and 300 passed while something else held the CPU
+  now = 350;
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(2, runs);
+  TEST_ASSERT_EQUAL_UINT32(2, scheduler.jobStats(0).skipped);
+  TEST_ASSERT_EQUAL_UINT32(250, scheduler.jobStats(0).maxLatency);
+
+  // no burst to catch up, the job stays on its grid
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(2, runs);
+  now = 400;
+  scheduler.runDue();
+  TEST_ASSERT_EQUAL_UINT32(3, runs);
+}
+
+void test_overrun_and_latency()
+{
+  startAt(0);
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("job", 100, 20, job);
+  runtime = 15;
+  scheduler.runDue();
+  TEST_ASSERT_EQUAL_UINT32(0, scheduler.jobStats(0).overruns);
+  TEST_ASSERT_EQUAL_UINT32(15, scheduler.jobStats(0).maxRuntime);
+
+  // started 10 late and ran for 15, 5 past the deadline
+  now = 110;
+  scheduler.runDue();
+  const Scheduler::JobStats &stats = scheduler.jobStats(0);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.runs);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.overruns);
+  TEST_ASSERT_EQUAL_UINT32(10, stats.maxLatency);
+  TEST_ASSERT_EQUAL_UINT32(15, stats.maxRuntime);
+
+  // a run longer than the period skips the next one
+  now = 200;
+  runtime = 150;
+  TEST_ASSERT_EQUAL_UINT32(50, scheduler.runDue());
+  TEST_ASSERT_EQUAL_UINT32(2, stats.overruns);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.skipped);
+  TEST_ASSERT_EQUAL_UINT32(150, stats.maxRuntime);
+}
+
+void test_late_job_delays_the_next_one()
+{
+  startAt(0);
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("long", 1000, 500, job);
+  scheduler.addJob("short", 100, 20, job);
+  runtime = 40;
+  scheduler.runDue();
+  // the second job was due at 0 and only started when the first was done
+  TEST_ASSERT_EQUAL_UINT32(40, scheduler.jobStats(1).maxLatency);
+  TEST_ASSERT_EQUAL_UINT32(1, scheduler.jobStats(1).overruns);
+  TEST_ASSERT_EQUAL_UINT32(0, scheduler.jobStats(0).overruns);
+}
+
+void test_job_table_is_bounded()
+{
+  startAt(0);
+  Scheduler scheduler(fakeClock);
+  TEST_ASSERT_EQUAL(-1, scheduler.addJob("never", 0, 10, job));
+  for (uint8_t i = 0; i < Scheduler::maxJobs; i++)
+  {
+    TEST_ASSERT_EQUAL(i, scheduler.addJob("job", 100, 10, job));
+  }
+  TEST_ASSERT_EQUAL(-1, scheduler.addJob("one too many", 100, 10, job));
+  TEST_ASSERT_EQUAL_UINT8(Scheduler::maxJobs, scheduler.jobCount());
+  // nothing to wait for without jobs
+  Scheduler empty(fakeClock);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, empty.runDue());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_runs_on_its_period);
+  RUN_TEST(test_first_delay_and_the_nearest_job);
+  RUN_TEST(test_millis_wraparound);
+  RUN_TEST(test_missed_periods_are_skipped);
+  RUN_TEST(test_overrun_and_latency);
+  RUN_TEST(test_late_job_delays_the_next_one);
+  RUN_TEST(test_job_table_is_bounded);
+  return UNITY_END();
+}
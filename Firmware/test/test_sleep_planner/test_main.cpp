@@ -0,0 +1,155 @@
+#include <unity.h>
+
+#include "Scheduler.h"
+#include "SleepPlanner.h"
+
+static uint32_t fakeNow = 0;
+
+static uint32_t fakeClock()
+{
+  return fakeNow;
+}
+
+void test_no_deadline_blocks_forever()
+{
+  SleepPlanner planner;
+  planner.plan(100);
+  TEST_ASSERT_EQUAL_UINT32(SleepPlanner::never, planner.window());
+  planner.wakeIn(SleepPlanner::never);
+  TEST_ASSERT_EQUAL_UINT32(SleepPlanner::never, planner.window());
+}
+
+void test_earliest_deadline_wins()
+{
+  SleepPlanner planner;
+  planner.plan(1000);
+  planner.wakeIn(500);
+  planner.wakeAt(1200);
+  planner.wakeIn(800);
+  TEST_ASSERT_EQUAL_UINT32(200, planner.window());
+
+  // a new window forgets the deadlines of the last one
+  planner.woke(1200);
+  planner.plan(1200);
+  planner.wakeIn(800);
+  TEST_ASSERT_EQUAL_UINT32(800, planner.window());
+}
+
+void test_passed_deadline_gives_no_window()
+{
+  SleepPlanner planner;
+  planner.plan(1000);
+  planner.wakeIn(50);
+  planner.wakeAt(990);
+  TEST_ASSERT_EQUAL_UINT32(0, planner.window());
+}
+
+void test_deadlines_across_the_wrap()
+{
+  SleepPlanner planner;
+  planner.plan(UINT32_MAX - 99);
+  planner.wakeAt(200);
+  planner.wakeAt(UINT32_MAX - 9);
+  TEST_ASSERT_EQUAL_UINT32(90, planner.window());
+
+  planner.plan(UINT32_MAX - 99);
+  planner.wakeIn(300);
+  TEST_ASSERT_EQUAL_UINT32(300, planner.window());
+  planner.woke(200);
+  TEST_ASSERT_EQUAL_UINT64(300, planner.stats().idleMillis);
+  TEST_ASSERT_EQUAL_UINT32(0, planner.stats().earlyWakeups);
+}
+
+void test_accounts_awake_and_idle_time()
+{
+  SleepPlanner planner;
+  // the time before the first window is not accounted
+  planner.plan(5000);
+  planner.wakeIn(900);
+  planner.woke(5900);
+  planner.plan(6000);
+  planner.wakeIn(900);
+  planner.woke(6900);
+  planner.plan(7000);
+
+  const SleepPlanner::Stats &stats = planner.stats();
+  TEST_ASSERT_EQUAL_UINT64(200, stats.awakeMillis);
+  TEST_ASSERT_EQUAL_UINT64(1800, stats.idleMillis);
+  TEST_ASSERT_EQUAL_UINT32(2, stats.windows);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.earlyWakeups);
+  TEST_ASSERT_EQUAL_UINT16(900, planner.idleShare());
+}
+
+void test_counts_early_wakeups()
+{
+  SleepPlanner planner;
+  TEST_ASSERT_EQUAL_UINT16(0, planner.idleShare());
+
+  planner.plan(0);
+  planner.wakeIn(1000);
+  planner.woke(300);
+  planner.plan(300);
+  planner.woke(400);
+  planner.plan(400);
+  planner.wakeIn(0);
+  planner.woke(400);
+
+  const SleepPlanner::Stats &stats = planner.stats();
+  TEST_ASSERT_EQUAL_UINT32(3, stats.windows);
+  // without a deadline every wake up is early, a passed deadline never is
+  TEST_ASSERT_EQUAL_UINT32(2, stats.earlyWakeups);
+  TEST_ASSERT_EQUAL_UINT64(400, stats.idleMillis);
+}
+
+// the scheduler task loop with the jobs of a power saving build: no PMS polling,
+// the sensors every minute and OTA once a second, every job takes 2 ms
+static uint32_t runJobsFor(uint32_t otaPeriod, uint32_t duration, SleepPlanner &planner)
+{
+  static auto work = []() { fakeNow += 2; };
+  fakeNow = 0;
+  Scheduler scheduler(fakeClock);
+  scheduler.addJob("co2", 60000, 1000, work, 4000);
+  scheduler.addJob("lux", 60000, 1000, work, 4000);
+  scheduler.addJob("sample", 60000, 2000, work, 5000);
+  scheduler.addJob("ota", otaPeriod, otaPeriod, work);
+
+  uint32_t longest = 0;
+  while (fakeNow < duration)
+  {
+    uint32_t wait = scheduler.runDue();
+    planner.plan(fakeNow);
+    planner.wakeIn(wait);
+    uint32_t window = planner.window();
+    longest = window > longest ? window : longest;
+    fakeNow += window;
+    planner.woke(fakeNow);
+  }
+  return longest;
+}
+
+void test_ota_poll_leaves_long_windows()
+{
+  SleepPlanner planner;
+  uint32_t longest = runJobsFor(1000, 10 * 60 * 1000, planner);
+  TEST_ASSERT_EQUAL_UINT32(998, longest);
+  TEST_ASSERT_EQUAL_UINT32(0, planner.stats().earlyWakeups);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT16(997, planner.idleShare());
+
+  // polled every 50 ms the chip never gets a window worth a light sleep
+  SleepPlanner fastPoll;
+  TEST_ASSERT_EQUAL_UINT32(48, runJobsFor(50, 10 * 60 * 1000, fastPoll));
+  TEST_ASSERT_LESS_THAN_UINT16(970, fastPoll.idleShare());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_no_deadline_blocks_forever);
+  RUN_TEST(test_earliest_deadline_wins);
+  RUN_TEST(test_passed_deadline_gives_no_window);
+  RUN_TEST(test_deadlines_across_the_wrap);
+  RUN_TEST(test_accounts_awake_and_idle_time);
+  RUN_TEST(test_counts_early_wakeups);
+  RUN_TEST(test_ota_poll_leaves_long_windows);
+  return UNITY_END();
+}
@@ -0,0 +1,98 @@
+#include <unity.h>
+
+#include "TimeSync.h"
+
+const static uint64_t second = 1000 * 1000;
+const static uint64_t epoch = 1700000000ULL * second;
+
+void test_no_time_before_the_first_update()
+{
+  TimeSync sync;
+  TEST_ASSERT_FALSE(sync.synced());
+  TEST_ASSERT_EQUAL_UINT64(0, sync.toUnixMicros(5 * second));
+}
+
+void test_first_update_is_a_step()
+{
+  TimeSync sync;
+  sync.update(5 * second, epoch);
+  TEST_ASSERT_TRUE(sync.synced());
+  TEST_ASSERT_EQUAL_UINT32(1, sync.stats().syncs);
+  TEST_ASSERT_EQUAL_UINT32(1, sync.stats().steps);
+  TEST_ASSERT_EQUAL_INT32(0, sync.stats().driftPpb);
+  // samples taken before the update are stamped as well
+  TEST_ASSERT_EQUAL_UINT64(epoch - 2 * second, sync.toUnixMicros(3 * second));
+  TEST_ASSERT_EQUAL_UINT64(epoch + 10 * second, sync.toUnixMicros(15 * second));
+}
+
+void test_estimates_the_drift()
+{
+  TimeSync sync;
+  sync.update(0, epoch);
+  // the servers run 100 ppm faster than the monotonic clock
+  sync.update(120 * second, epoch + 120 * second + 12000);
+  TEST_ASSERT_EQUAL_UINT32(1, sync.stats().steps);
+  TEST_ASSERT_EQUAL_INT64(12000, sync.stats().lastErrorMicros);
+  TEST_ASSERT_EQUAL_INT32(100000, sync.stats().driftPpb);
+  TEST_ASSERT_EQUAL_UINT64(epoch + 180 * second + 18000, sync.toUnixMicros(180 * second));
+
+  // later estimates only move a quarter of the way
+  sync.update(240 * second, epoch + 240 * second + 36000);
+  TEST_ASSERT_EQUAL_INT64(12000, sync.stats().lastErrorMicros);
+  TEST_ASSERT_EQUAL_INT32(125000, sync.stats().driftPpb);
+}
+
+void test_short_intervals_keep_the_reference()
+{
+  TimeSync sync;
+  sync.update(0, epoch);
+  sync.update(10 * second, epoch + 10 * second + 500);
+  TEST_ASSERT_EQUAL_UINT32(2, sync.stats().syncs);
+  TEST_ASSERT_EQUAL_UINT32(1, sync.stats().steps);
+  TEST_ASSERT_EQUAL_INT32(0, sync.stats().driftPpb);
+  TEST_ASSERT_EQUAL_UINT64(epoch + 10 * second, sync.toUnixMicros(10 * second));
+
+  // the baseline still starts at the first update
+  sync.update(60 * second, epoch + 60 * second + 3000);
+  TEST_ASSERT_EQUAL_INT32(50000, sync.stats().driftPpb);
+}
+
+void test_large_errors_step_the_clock()
+{
+  TimeSync sync;
+  sync.update(0, epoch);
+  sync.update(120 * second, epoch + 120 * second + 12000);
+  sync.update(180 * second, epoch + 3600 * second);
+  TEST_ASSERT_EQUAL_UINT32(2, sync.stats().steps);
+  // the drift of the crystal didn't change with the time
+  TEST_ASSERT_EQUAL_INT32(100000, sync.stats().driftPpb);
+  TEST_ASSERT_EQUAL_UINT64(epoch + 3600 * second, sync.toUnixMicros(180 * second));
+
+  // a monotonic clock that went back is no reference either
+  sync.update(60 * second, epoch + 4000 * second);
+  TEST_ASSERT_EQUAL_UINT32(3, sync.stats().steps);
+  TEST_ASSERT_EQUAL_UINT64(epoch + 4000 * second, sync.toUnixMicros(60 * second));
+}
+
+void test_ignores_an_impossible_drift()
+{
+  TimeSync sync;
+  sync.update(0, epoch);
+  // 500 ms in a minute is far beyond any crystal
+  sync.update(60 * second, epoch + 60 * second + 500000);
+  TEST_ASSERT_EQUAL_UINT32(1, sync.stats().steps);
+  TEST_ASSERT_EQUAL_INT32(0, sync.stats().driftPpb);
+  TEST_ASSERT_EQUAL_UINT64(epoch + 60 * second + 500000, sync.toUnixMicros(60 * second));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_no_time_before_the_first_update);
+  RUN_TEST(test_first_update_is_a_step);
+  RUN_TEST(test_estimates_the_drift);
+  RUN_TEST(test_short_intervals_keep_the_reference);
+  RUN_TEST(test_large_errors_step_the_clock);
+  RUN_TEST(test_ignores_an_impossible_drift);
+  return UNITY_END();
+}
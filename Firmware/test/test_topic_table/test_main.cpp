@@ -0,0 +1,117 @@
+#include <string.h>
+#include <unity.h>
+
+#include "TopicTable.h"
+
+static char expected[256];
+
+static const char *names[TopicTable::topicCount] = {"co2", "pm10", "pm25", "pm100"};
+
+// every string the table hands out lies inside it and ends there
+static void checkTerminated(const TopicTable &table, const char *text)
+{
+  const char *begin = (const char *)&table;
+  const char *end = begin + sizeof(TopicTable);
+  TEST_ASSERT_TRUE(text >= begin && text < end);
+  TEST_ASSERT_NOT_NULL(memchr(text, '\0', end - text));
+}
+
+static void checkIntact(const TopicTable &table, const char *prefix, const char *room)
+{
+  for (uint8_t topic = 0; topic < TopicTable::topicCount; topic++)
+  {
+    snprintf(expected, sizeof(expected), "%s/%s/%s", prefix, room, names[topic]);
+    TEST_ASSERT_EQUAL_STRING(expected, table.topic((TopicTable::Topic)topic));
+    snprintf(expected, sizeof(expected), "%s/%s/%s/summary", prefix, room, names[topic]);
+    TEST_ASSERT_EQUAL_STRING(expected, table.summaryTopic((TopicTable::Topic)topic));
+  }
+  snprintf(expected, sizeof(expected), "AtmoNode-%s", room);
+  TEST_ASSERT_EQUAL_STRING(expected, table.clientId());
+}
+
+void test_renders_every_topic()
+{
+  TopicTable table;
+  TEST_ASSERT_TRUE(table.render("atmonode", "kitchen"));
+  TEST_ASSERT_EQUAL_STRING("atmonode/kitchen/pm25", table.topic(TopicTable::pm25));
+  TEST_ASSERT_EQUAL_STRING("atmonode/kitchen/pm100/summary", table.summaryTopic(TopicTable::pm100));
+  checkIntact(table, "atmonode", "kitchen");
+}
+
+void test_longest_room_fits()
+{
+  // the configuration portal takes 39 characters
+  const char *room = "a-room-name-of-thirty-nine-characters-x";
+  TEST_ASSERT_EQUAL(39, strlen(room));
+  TopicTable table;
+  TEST_ASSERT_TRUE(table.render("atmonode", room));
+  checkIntact(table, "atmonode", room);
+}
+
+void test_topic_that_no_longer_fits()
+{
+  char room[101];
+  memset(room, 'r', 100);
+  room[100] = '\0';
+  TopicTable table;
+  table.render("atmonode", "kitchen");
+
+  // co2 and pm10 with their summaries fit, pm25 is cut off at the end of the arena
+  TEST_ASSERT_FALSE(table.render("atmonode", room));
+  for (uint8_t topic = TopicTable::co2; topic <= TopicTable::pm10; topic++)
+  {
+    snprintf(expected, sizeof(expected), "atmonode/%s/%s", room, names[topic]);
+    TEST_ASSERT_EQUAL_STRING(expected, table.topic((TopicTable::Topic)topic));
+    snprintf(expected, sizeof(expected), "atmonode/%s/%s/summary", room, names[topic]);
+    TEST_ASSERT_EQUAL_STRING(expected, table.summaryTopic((TopicTable::Topic)topic));
+  }
+  const char *truncated = table.topic(TopicTable::pm25);
+  checkTerminated(table, truncated);
+  TEST_ASSERT_GREATER_THAN(0, strlen(truncated));
+  snprintf(expected, sizeof(expected), "atmonode/%s/pm25", room);
+  TEST_ASSERT_TRUE(strlen(truncated) < strlen(expected));
+  TEST_ASSERT_EQUAL(0, strncmp(expected, truncated, strlen(truncated)));
+
+  // nothing is left over from the room before
+  TEST_ASSERT_EQUAL_STRING("", table.summaryTopic(TopicTable::pm25));
+  TEST_ASSERT_EQUAL_STRING("", table.topic(TopicTable::pm100));
+  TEST_ASSERT_EQUAL_STRING("", table.summaryTopic(TopicTable::pm100));
+  TEST_ASSERT_EQUAL_STRING("", table.clientId());
+  for (uint8_t topic = 0; topic < TopicTable::topicCount; topic++)
+  {
+    checkTerminated(table, table.topic((TopicTable::Topic)topic));
+    checkTerminated(table, table.summaryTopic((TopicTable::Topic)topic));
+  }
+  checkTerminated(table, table.clientId());
+
+  // a shorter room renders completely again
+  TEST_ASSERT_TRUE(table.render("atmonode", "hall"));
+  checkIntact(table, "atmonode", "hall");
+}
+
+void test_client_id_that_no_longer_fits()
+{
+  // with a room of 50 characters the topics take 552 bytes, the client id needs 60 more
+  char room[51];
+  memset(room, 'r', 50);
+  room[50] = '\0';
+  TopicTable table;
+  TEST_ASSERT_FALSE(table.render("atmonode", room));
+  for (uint8_t topic = 0; topic < TopicTable::topicCount; topic++)
+  {
+    snprintf(expected, sizeof(expected), "atmonode/%s/%s/summary", room, names[topic]);
+    TEST_ASSERT_EQUAL_STRING(expected, table.summaryTopic((TopicTable::Topic)topic));
+  }
+  checkTerminated(table, table.clientId());
+  TEST_ASSERT_EQUAL_STRING("AtmoNode-rrrrrrrrrrrrrr", table.clientId());
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_renders_every_topic);
+  RUN_TEST(test_longest_room_fits);
+  RUN_TEST(test_topic_that_no_longer_fits);
+  RUN_TEST(test_client_id_that_no_longer_fits);
+  return UNITY_END();
+}
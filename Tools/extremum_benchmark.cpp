@@ -0,0 +1,114 @@
+// Shows how the chart bounds scale with the history length on the host: the
+// SlidingExtremum pair of TieredHistory against a linear scan of a ring buffer,
+// which is what ValueHistory::getMinValue()/getMaxValue() did. Each round adds
+// one measurement and then asks for the minimum and the maximum, like a redraw.
+//
+// built from the Tools directory with
+// g++ -O2 -std=gnu++17 -I../Firmware/src extremum_benchmark.cpp -o extremum_benchmark
+
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "SlidingExtremum.h"
+
+const static int rounds = 200000;
+
+// noisy particle counts with slow trends, so the deque sees both rising and falling runs
+static uint16_t measurement(uint32_t i)
+{
+  uint32_t state = i * 2654435761u;
+  uint32_t trend = (i / 700) % 2 ? i % 700 : 700 - i % 700;
+  return uint16_t(trend + (state >> 16) % 200);
+}
+
+template <uint16_t Window>
+struct LinearScan
+{
+  void push(uint16_t value)
+  {
+    values[next] = value;
+    next = (next + 1) % Window;
+    if (count < Window)
+    {
+      count++;
+    }
+  }
+  uint16_t minimum() const
+  {
+    uint16_t result = UINT16_MAX;
+    for (uint16_t i = 0; i < count; i++)
+    {
+      result = values[i] < result ? values[i] : result;
+    }
+    return result;
+  }
+  uint16_t maximum() const
+  {
+    uint16_t result = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+      result = values[i] > result ? values[i] : result;
+    }
+    return result;
+  }
+
+  uint16_t values[Window];
+  uint16_t next = 0;
+  uint16_t count = 0;
+};
+
+template <uint16_t Window>
+struct Deques
+{
+  void push(uint16_t value)
+  {
+    min.push(value);
+    max.push(value);
+  }
+  uint16_t minimum() const { return min.value(); }
+  uint16_t maximum() const { return max.value(); }
+
+  SlidingExtremum<uint16_t, Window, false> min;
+  SlidingExtremum<uint16_t, Window, true> max;
+};
+
+template <typename History>
+static double nanosPerRound(uint32_t &checksum)
+{
+  static History history;
+  history = History();
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++)
+  {
+    history.push(measurement(round));
+    checksum += history.minimum() + history.maximum();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / rounds;
+}
+
+template <uint16_t Window>
+static bool measure()
+{
+  uint32_t scanned = 0;
+  uint32_t tracked = 0;
+  double scan = nanosPerRound<LinearScan<Window>>(scanned);
+  double deque = nanosPerRound<Deques<Window>>(tracked);
+  // both see the same measurements, so they have to agree on every bound
+  if (scanned != tracked)
+  {
+    fprintf(stderr, "window %u: the bounds differ\n", Window);
+    return false;
+  }
+  printf("%8u %14.1f %14.1f %10.1fx\n", Window, scan, deque, scan / deque);
+  return true;
+}
+
+int main()
+{
+  printf("%d rounds, ns per measurement and min/max query\n", rounds);
+  printf("%8s %14s %14s %11s\n", "length", "linear scan", "deque", "speedup");
+  bool ok = measure<16>() && measure<60>() && measure<240>() && measure<1024>() && measure<4096>() && measure<16384>();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+// Compares LineProtocolWriter with the createInfluxMessage()/createParticleMessage() functions
+// it replaced: strncpy + strlen into a fixed 50 byte buffer and an Arduino String per value.
+// Reports the time per message and the heap allocations per message of both.
+//
+// built from the Tools directory with
+// g++ -O2 -std=gnu++17 -I../Firmware/src line_protocol_benchmark.cpp ../Firmware/src/LineProtocol.cpp -o line_protocol_benchmark
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "LineProtocol.h"
+
+const static char *room = "living room";
+const static int rounds = 200000;
+
+static size_t allocations = 0;
+
+void *operator new(size_t size)
+{
+  allocations++;
+  if (void *memory = malloc(size))
+  {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+  free(memory);
+}
+
+// just enough of Arduino's WString: the text lives on the heap, sized to fit
+class String
+{
+public:
+  String(float value, unsigned char decimals = 2)
+  {
+    char text[33];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    copy(text);
+  }
+  String(uint16_t value)
+  {
+    char text[8];
+    snprintf(text, sizeof(text), "%u", value);
+    copy(text);
+  }
+  ~String() { delete[] buffer; }
+  const char *c_str() const { return buffer; }
+  size_t length() const { return len; }
+
+private:
+  void copy(const char *text)
+  {
+    len = strlen(text);
+    buffer = new char[len + 1];
+    memcpy(buffer, text, len + 1);
+  }
+
+  char *buffer;
+  size_t len;
+};
+
+// the functions as they were in main.cpp before LineProtocolWriter
+static void createInfluxMessage(char *dst, uint8_t len, const char *topic, float value)
+{
+  uint8_t pos = 0;
+  strncpy(dst + pos, topic, len - pos);
+  pos += strlen(topic);
+  strncpy(dst + pos, ",site=", len - pos);
+  pos += 6;
+  strncpy(dst + pos, room, len - pos);
+  pos += strlen(room);
+  strncpy(dst + pos, " value=", len - pos);
+  pos += 7;
+  String val_str = String(value);
+  strncpy(dst + pos, val_str.c_str(), len - pos);
+}
+
+static void createParticleMessage(char *dst, uint8_t len, const char *topic, uint16_t value, float size)
+{
+  uint8_t pos = 0;
+
+  strncpy(dst + pos, topic, len - pos);
+  pos += strlen(topic);
+
+  strncpy(dst + pos, ",site=", len - pos);
+  pos += 6;
+
+  strncpy(dst + pos, room, len - pos);
+  pos += strlen(room);
+
+  strncpy(dst + pos, ",size=", len - pos);
+  pos += 6;
+
+  String sizeStr = String(size, 1);
+  strncpy(dst + pos, sizeStr.c_str(), len - pos);
+  pos += sizeStr.length();
+
+  strncpy(dst + pos, " value=", len - pos);
+  pos += 7;
+
+  String val_str = String(value);
+  strncpy(dst + pos, val_str.c_str(), len - pos);
+}
+
+struct Result
+{
+  double nanosPerMessage;
+  double allocationsPerMessage;
+};
+
+template <typename Function>
+static Result measure(Function function)
+{
+  size_t allocationsBefore = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++)
+  {
+    function(round);
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return {elapsed.count() / rounds, double(allocations - allocationsBefore) / rounds};
+}
+
+int main()
+{
+  char message[50];
+  uint32_t checksum = 0;
+
+  // the same points, except that the writer escapes the space in the room name
+  createInfluxMessage(message, sizeof(message), "co2", 412);
+  char line[50];
+  LineProtocolWriter writer(line, sizeof(line));
+  writer.beginLine("co2").tag("site", room).field("value", 412.0f).end();
+  if (strcmp(message, "co2,site=living room value=412.00") != 0 ||
+      strcmp(line, "co2,site=living\\ room value=412.00") != 0)
+  {
+    fprintf(stderr, "unexpected value messages: \"%s\" and \"%s\"\n", message, line);
+    return 1;
+  }
+  createParticleMessage(message, sizeof(message), "particles", 1234, 2.5);
+  writer.clear();
+  writer.beginLine("particles").tag("site", room).tag("size", "2.5").field("value", uint32_t(1234)).end();
+  if (strcmp(message, "particles,site=living room,size=2.5 value=1234") != 0 ||
+      strcmp(line, "particles,site=living\\ room,size=2.5 value=1234") != 0)
+  {
+    fprintf(stderr, "unexpected particle messages: \"%s\" and \"%s\"\n", message, line);
+    return 1;
+  }
+
+  Result oldValue = measure([&](int round) {
+    createInfluxMessage(message, sizeof(message), "pm25_std", float(round % 500));
+    checksum += message[20];
+  });
+  Result newValue = measure([&](int round) {
+    writer.clear();
+    writer.beginLine("pm25_std").tag("site", room).field("value", int32_t(round % 500)).end();
+    checksum += line[20];
+  });
+  Result oldParticles = measure([&](int round) {
+    createParticleMessage(message, sizeof(message), "particles", uint16_t(round % 3000), 2.5);
+    checksum += message[20];
+  });
+  Result newParticles = measure([&](int round) {
+    writer.clear();
+    writer.beginLine("particles").tag("site", room).tag("size", "2.5").field("value", uint32_t(round % 3000)).end();
+    checksum += line[20];
+  });
+
+  printf("%d rounds (checksum %u)\n", rounds, checksum);
+  printf("%-24s %12s %14s\n", "message", "ns", "allocations");
+  printf("%-24s %12.1f %14.1f\n", "createInfluxMessage", oldValue.nanosPerMessage, oldValue.allocationsPerMessage);
+  printf("%-24s %12.1f %14.1f\n", "writer, value", newValue.nanosPerMessage, newValue.allocationsPerMessage);
+  printf("%-24s %12.1f %14.1f\n", "createParticleMessage", oldParticles.nanosPerMessage, oldParticles.allocationsPerMessage);
+  printf("%-24s %12.1f %14.1f\n", "writer, particles", newParticles.nanosPerMessage, newParticles.allocationsPerMessage);
+  return 0;
+}
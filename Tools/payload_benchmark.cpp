@@ -0,0 +1,175 @@
+// Compares the influx lines with the CBOR records of SampleCodec on the host:
+// bytes per sample, encode time and decode time.
+// Decodes a message given on the command line instead, e.g. one saved by
+//   mosquitto_sub -t atmonode/cbor -C 1 > message.cbor
+//
+// built from the Tools directory with
+// g++ -O2 -std=gnu++17 -I../Firmware/src payload_benchmark.cpp ../Firmware/src/SampleCodec.cpp ../Firmware/src/LineProtocol.cpp -o payload_benchmark
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include <vector>
+
+#include "LineProtocol.h"
+#include "SampleCodec.h"
+
+const static char *room = "living room";
+const static int samplesPerBatch = 5;
+const static int rounds = 20000;
+
+// the lines of appendInfluxLines() in main.cpp
+static void appendInfluxLines(LineProtocolWriter &line, const Sample &sample)
+{
+  const struct
+  {
+    const char *measurement;
+    const char *size;
+    int32_t value;
+  } points[] = {
+      {"co2", nullptr, sample.co2},
+      {"pm10_std", nullptr, sample.pms.pm10_standard},
+      {"pm25_std", nullptr, sample.pms.pm25_standard},
+      {"pm100_std", nullptr, sample.pms.pm100_standard},
+      {"pm10_env", nullptr, sample.pms.pm10_env},
+      {"pm25_env", nullptr, sample.pms.pm25_env},
+      {"pm100_env", nullptr, sample.pms.pm100_env},
+      {"particles", "0.3", sample.pms.particles_03um},
+      {"particles", "0.5", sample.pms.particles_05um},
+      {"particles", "1.0", sample.pms.particles_10um},
+      {"particles", "2.5", sample.pms.particles_25um},
+      {"particles", "5.0", sample.pms.particles_50um},
+      {"particles", "10.0", sample.pms.particles_100um},
+  };
+  for (const auto &point : points)
+  {
+    line.beginLine(point.measurement).tag("site", room);
+    if (point.size)
+    {
+      line.tag("size", point.size);
+    }
+    line.field("value", point.value).timestamp(sample.timestamp).end();
+  }
+}
+
+static Sample makeSample(int i)
+{
+  Sample sample = {};
+  sample.pms = {uint16_t(3 + i % 4), uint16_t(5 + i % 7), uint16_t(8 + i % 9), uint16_t(3 + i % 4),
+                uint16_t(5 + i % 7), uint16_t(8 + i % 9), uint16_t(900 + i * 13 % 400), uint16_t(270 + i * 7 % 90),
+                uint16_t(40 + i % 30), uint16_t(6 + i % 5), uint16_t(1 + i % 3), uint16_t(i % 2)};
+  sample.co2 = 420 + i * 17 % 900;
+  sample.co2Temp = 21;
+  sample.lux = 120.5f + i;
+  sample.timestamp = 1700000000000ULL + 60000ULL * i;
+  return sample;
+}
+
+template <typename Function>
+static double microsPerRound(Function function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int round = 0; round < rounds; round++)
+  {
+    function(round);
+  }
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / rounds;
+}
+
+static int decodeFile(const char *path)
+{
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> message((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  SampleDecoder decoder(message.data(), message.size());
+  char decodedRoom[40];
+  if (!decoder.begin(decodedRoom, sizeof(decodedRoom)))
+  {
+    fprintf(stderr, "%s: not a schema %u sample message\n", path, SampleEncoder::schemaVersion);
+    return 1;
+  }
+  Sample sample;
+  while (decoder.next(sample))
+  {
+    printf("%s %llu co2=%d temp=%d lux=%.2f pm1=%u pm2.5=%u pm10=%u\n", decodedRoom,
+           (unsigned long long)sample.timestamp, sample.co2, sample.co2Temp, sample.lux,
+           sample.pms.pm10_standard, sample.pms.pm25_standard, sample.pms.pm100_standard);
+  }
+  return decoder.failed() ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1)
+  {
+    return decodeFile(argv[1]);
+  }
+
+  Sample samples[samplesPerBatch];
+  for (int i = 0; i < samplesPerBatch; i++)
+  {
+    samples[i] = makeSample(i);
+  }
+
+  static char lines[samplesPerBatch * 13 * 140 + 1];
+  LineProtocolWriter influx(lines, sizeof(lines));
+  double influxEncode = microsPerRound([&](int) {
+    influx.clear();
+    for (const Sample &sample : samples)
+    {
+      appendInfluxLines(influx, sample);
+    }
+  });
+
+  static uint8_t binary[samplesPerBatch * SampleEncoder::maxRecordSize + 64];
+  SampleEncoder encoder(binary, sizeof(binary));
+  double cborEncode = microsPerRound([&](int) {
+    encoder.begin(room);
+    for (const Sample &sample : samples)
+    {
+      encoder.add(sample);
+    }
+    encoder.finish();
+  });
+
+  uint32_t checksum = 0;
+  double cborDecode = microsPerRound([&](int) {
+    SampleDecoder decoder(encoder.data(), encoder.length());
+    char decodedRoom[40];
+    Sample sample;
+    decoder.begin(decodedRoom, sizeof(decodedRoom));
+    while (decoder.next(sample))
+    {
+      checksum += sample.co2;
+    }
+  });
+
+  // a round trip has to give back every encoded field
+  SampleDecoder decoder(encoder.data(), encoder.length());
+  char decodedRoom[40];
+  decoder.begin(decodedRoom, sizeof(decodedRoom));
+  Sample sample;
+  int matching = 0;
+  while (decoder.next(sample))
+  {
+    const Sample &original = samples[matching];
+    if (sample.timestamp != original.timestamp || sample.co2 != original.co2 || sample.lux != original.lux ||
+        sample.pms.particles_03um != original.pms.particles_03um || sample.pms.particles_100um != original.pms.particles_100um)
+    {
+      break;
+    }
+    matching++;
+  }
+  if (matching != samplesPerBatch || decoder.failed())
+  {
+    fprintf(stderr, "round trip failed after %d records\n", matching);
+    return 1;
+  }
+
+  printf("%d samples per batch, %d rounds (checksum %u)\n", samplesPerBatch, rounds, checksum);
+  printf("%-8s %10s %12s %12s\n", "format", "bytes", "encode us", "decode us");
+  printf("%-8s %10zu %12.2f %12s\n", "influx", influx.length(), influxEncode, "-");
+  printf("%-8s %10zu %12.2f %12.2f\n", "cbor", encoder.length(), cborEncode, cborDecode);
+  return 0;
+}